@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "libvol/models/american.hpp"
+#include "libvol/models/binom.hpp"
+#include "libvol/math/root_finders.hpp"
+
+namespace {
+
+// Random American book: S = 100, K 70..130, T 1M..3Y, vol 10%..60%, r 1%..8%, q 0..4%
+struct Quote {
+    double K, r, q, T, vol;
+    bool is_call;
+};
+
+const std::vector<Quote>& book() {
+    static const std::vector<Quote> b = [] {
+        std::mt19937_64 rng(5);
+        std::uniform_real_distribution<double> U(0.0, 1.0);
+        std::vector<Quote> out;
+        for (int i = 0; i < 64; ++i) {
+            out.push_back({70.0 + 60.0 * U(rng), 0.01 + 0.07 * U(rng), 0.04 * U(rng), 1.0 / 12.0 + 3.0 * U(rng),
+                           0.1 + 0.5 * U(rng), i % 2 == 1});
+        }
+        return out;
+    }();
+    return b;
+}
+
+const std::vector<double>& reference() {
+    static const std::vector<double> ref = [] {
+        std::vector<double> out;
+        for (const Quote& c : book()) {
+            out.push_back(vol::american::price(100.0, c.K, c.r, c.q, c.T, c.vol, c.is_call, vol::american::HIGH));
+        }
+        return out;
+    }();
+    return ref;
+}
+
+const vol::american::Scheme SCHEMES[] = {vol::american::FAST, vol::american::ACCURATE, vol::american::HIGH};
+const char* SCHEME_NAMES[] = {"FAST", "ACCURATE", "HIGH"};
+
+} // namespace
+
+// ALO collocation per preset; max_abs_err against HIGH over the book
+static void BM_American_ALO_Price(benchmark::State& state) {
+    const auto& b = book();
+    const auto& scheme = SCHEMES[state.range(0)];
+    std::vector<double> out(b.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            out[i] = vol::american::price(100.0, b[i].K, b[i].r, b[i].q, b[i].T, b[i].vol, b[i].is_call, scheme);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    double err = 0.0;
+    for (std::size_t i = 0; i < b.size(); ++i) err = std::max(err, std::abs(out[i] - reference()[i]));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(b.size()));
+    state.counters["max_abs_err"] = err;
+    state.SetLabel(SCHEME_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_American_ALO_Price)->DenseRange(0, 2);
+
+static void BM_American_ALO_Greeks(benchmark::State& state) {
+    const auto& b = book();
+    const auto& scheme = SCHEMES[state.range(0)];
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (const Quote& c : b) {
+            sum += vol::american::price_greeks(100.0, c.K, c.r, c.q, c.T, c.vol, c.is_call, scheme).delta;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(b.size()));
+    state.SetLabel(SCHEME_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_American_ALO_Greeks)->DenseRange(0, 2);
+
+// CRR tree on the same book, for the steps needed to reach a given error
+static void BM_American_Binom_Price(benchmark::State& state) {
+    const auto& b = book();
+    const int steps = static_cast<int>(state.range(0));
+    std::vector<double> out(b.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            out[i] = vol::binom::price(100.0, b[i].K, b[i].r, b[i].q, b[i].T, b[i].vol, steps, b[i].is_call, true);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    double err = 0.0;
+    for (std::size_t i = 0; i < b.size(); ++i) err = std::max(err, std::abs(out[i] - reference()[i]));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(b.size()));
+    state.counters["max_abs_err"] = err;
+    state.counters["steps"] = steps;
+}
+BENCHMARK(BM_American_Binom_Price)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+// IV inversion of the HIGH prices: ALO solver per quote, chain batch over threads, and the
+// Brent-over-tree approach it replaces
+static void BM_American_IV(benchmark::State& state) {
+    const auto& b = book();
+    const auto& scheme = SCHEMES[state.range(0)];
+    std::vector<vol::bs::IVResult> out(b.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            out[i] = vol::american::implied_vol(100.0, b[i].K, b[i].r, b[i].q, b[i].T, reference()[i], b[i].is_call,
+                                                scheme);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    double err = 0.0, steps = 0.0;
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        err = std::max(err, std::abs(out[i].iv - b[i].vol));
+        steps += out[i].newton_iters + out[i].brent_iters;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(b.size()));
+    state.counters["max_vol_err"] = err;
+    state.counters["prices_per_iv"] = steps / static_cast<double>(b.size());
+    state.SetLabel(SCHEME_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_American_IV)->DenseRange(0, 1);
+
+static void BM_American_IV_Chain(benchmark::State& state) {
+    // one expiry of the book's shape, puts below the forward and calls above
+    const auto ex = vol::make_expiry(100.0, 0.04, 0.01, 0.75);
+    std::vector<double> strikes;
+    std::vector<std::uint8_t> is_call;
+    for (int i = 0; i < 64; ++i) {
+        strikes.push_back(70.0 + i);
+        is_call.push_back(strikes.back() >= ex.forward);
+    }
+    const auto chain = vol::make_chain(ex, strikes, is_call);
+    std::vector<double> prices;
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        prices.push_back(vol::american::price(ex.S, chain.K[i], ex.r, ex.q, ex.T, 0.25 - 0.2 * chain.k[i],
+                                              chain.is_call[i] != 0));
+    }
+    std::vector<vol::bs::IVResult> out(chain.size());
+    const int threads = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        vol::american::implied_vol(chain, prices, out, vol::american::ACCURATE, threads);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(chain.size()));
+    state.counters["threads"] = threads;
+}
+BENCHMARK(BM_American_IV_Chain)->Arg(1)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_American_IV_BrentTree(benchmark::State& state) {
+    const auto& b = book();
+    const int steps = static_cast<int>(state.range(0));
+    std::vector<double> out(b.size());
+    int evals = 0;
+    for (auto _ : state) {
+        evals = 0;
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            const Quote& c = b[i];
+            auto f = [&](double v) {
+                ++evals;
+                return vol::binom::price(100.0, c.K, c.r, c.q, c.T, v, steps, c.is_call, true) - reference()[i];
+            };
+            out[i] = vol::root::brent(f, 0.01, 2.0, 1e-8, 100).x;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    double err = 0.0;
+    for (std::size_t i = 0; i < b.size(); ++i) err = std::max(err, std::abs(out[i] - b[i].vol));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(b.size()));
+    state.counters["max_vol_err"] = err;
+    state.counters["prices_per_iv"] = evals / static_cast<double>(b.size());
+    state.counters["steps"] = steps;
+}
+BENCHMARK(BM_American_IV_BrentTree)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -101,4 +101,25 @@ static void BM_Binom_Error_vs_BS(benchmark::State& state) {
 }
 BENCHMARK(BM_Binom_Error_vs_BS)->RangeMultiplier(2)->Range(50, 1024);
 
+// -------- Very large trees: serial vs tiled parallel lattice, American put ----------
+// range(0) = steps; range(1) = threads (0: the serial price_w_info)
+static void BM_Binom_Lattice_Amer_Put(benchmark::State& state) {
+    Params p; p.q = 0.0;
+    const int steps = static_cast<int>(state.range(0));
+    const int threads = static_cast<int>(state.range(1));
+    vol::binom::LatticeConfig cfg;
+    cfg.n_threads = threads;
+    for (auto _ : state) {
+        auto res = threads == 0
+            ? vol::binom::price_w_info(p.S, p.K, p.r, p.q, p.T, p.vol, steps, false, true)
+            : vol::binom::price_w_info_parallel(p.S, p.K, p.r, p.q, p.T, p.vol, steps, false, true, cfg);
+        benchmark::DoNotOptimize(res);
+    }
+    state.counters["steps"] = steps;
+    state.counters["threads"] = threads;
+}
+BENCHMARK(BM_Binom_Lattice_Amer_Put)
+    ->ArgsProduct({{10000, 50000, 100000}, {0, 1, 2, 4}})
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 #include "libvol/models/black_scholes.hpp"
+#include <cstdint>
+#include <vector>
 
 // Benchmark single price calculation (typical ATM call)
 static void BM_Price_ATM(benchmark::State& state) {
@@ -65,4 +67,102 @@ static void BM_Price_Put(benchmark::State& state) {
 }
 BENCHMARK(BM_Price_Put);
 
+// --- Chain workloads: one expiry, 100 strikes (70..130), per-quote vs ExpiryContext ---
+namespace {
+constexpr int CHAIN_N = 100;
+
+std::vector<double> chain_strikes() {
+    std::vector<double> K(CHAIN_N);
+    for (int i = 0; i < CHAIN_N; ++i) K[i] = 70.0 + 0.6 * i;
+    return K;
+}
+
+vol::Chain make_bench_chain() {
+    const auto K = chain_strikes();
+    const std::vector<std::uint8_t> calls(K.size(), 1);
+    return vol::make_chain(vol::make_expiry(100.0, 0.05, 0.02, 1.0), K, calls);
+}
+}
+
+static void BM_Chain_Price_PerQuote(benchmark::State& state) {
+    const auto K = chain_strikes();
+    std::vector<double> out(K.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < K.size(); ++i) {
+            out[i] = vol::bs::price(100.0, K[i], 0.05, 0.02, 1.0, 0.25, true);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * CHAIN_N);
+}
+BENCHMARK(BM_Chain_Price_PerQuote);
+
+static void BM_Chain_Price_Context(benchmark::State& state) {
+    const auto chain = make_bench_chain();
+    const std::vector<double> vols(chain.size(), 0.25);
+    std::vector<double> out(chain.size());
+    for (auto _ : state) {
+        vol::bs::price(chain, vols, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * CHAIN_N);
+}
+BENCHMARK(BM_Chain_Price_Context);
+
+static void BM_Chain_Greeks_PerQuote(benchmark::State& state) {
+    const auto K = chain_strikes();
+    for (auto _ : state) {
+        double total = 0.0;
+        for (double k : K) total += vol::bs::price_greeks(100.0, k, 0.05, 0.02, 1.0, 0.25, true).vega;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * CHAIN_N);
+}
+BENCHMARK(BM_Chain_Greeks_PerQuote);
+
+static void BM_Chain_Greeks_Context(benchmark::State& state) {
+    const auto chain = make_bench_chain();
+    for (auto _ : state) {
+        double total = 0.0;
+        for (std::size_t i = 0; i < chain.size(); ++i) {
+            total += vol::bs::price_greeks(chain.expiry, chain.K[i], chain.k[i], 0.25, true).vega;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * CHAIN_N);
+}
+BENCHMARK(BM_Chain_Greeks_Context);
+
+static void BM_Chain_IV_PerQuote(benchmark::State& state) {
+    const auto K = chain_strikes();
+    std::vector<double> px(K.size());
+    for (std::size_t i = 0; i < K.size(); ++i) px[i] = vol::bs::price(100.0, K[i], 0.05, 0.02, 1.0, 0.25, true);
+    for (auto _ : state) {
+        double total = 0.0;
+        for (std::size_t i = 0; i < K.size(); ++i) {
+            total += vol::bs::implied_vol(100.0, K[i], 0.05, 0.02, 1.0, px[i], true).iv;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * CHAIN_N);
+}
+BENCHMARK(BM_Chain_IV_PerQuote);
+
+static void BM_Chain_IV_Context(benchmark::State& state) {
+    const auto chain = make_bench_chain();
+    const std::vector<double> vols(chain.size(), 0.25);
+    std::vector<double> px(chain.size());
+    vol::bs::price(chain, vols, px);
+    std::vector<vol::bs::IVResult> iv(chain.size());
+    for (auto _ : state) {
+        vol::bs::implied_vol(chain, px, iv);
+        benchmark::DoNotOptimize(iv.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * CHAIN_N);
+}
+BENCHMARK(BM_Chain_IV_Context);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/io/chain_snapshot.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using vol::OptionSpec;
+
+namespace {
+
+// Synthetic end-of-day chain: underlyings x expiries x strikes, SVI smiles
+constexpr int N_UNDERLYINGS = 100;
+constexpr int N_EXPIRIES = 8;
+constexpr int N_STRIKES = 40;
+
+struct Files {
+    std::string csv;
+    std::string snapshot;
+};
+
+const Files& files() {
+    static const Files f = [] {
+        const auto dir = std::filesystem::temp_directory_path();
+        Files out{(dir / "libvol_bench_chain.csv").string(), (dir / "libvol_bench_chain.snap").string()};
+        std::ofstream csv(out.csv);
+        csv.precision(17);
+        csv << "underlying,S,K,r,q,T,is_call,bid,ask,mid\n";
+        vol::io::SnapshotWriter writer;
+        const double r = 0.02, q = 0.01;
+        for (int u = 0; u < N_UNDERLYINGS; ++u) {
+            const double S = 50.0 + u;
+            for (int e = 0; e < N_EXPIRIES; ++e) {
+                const double T = 0.05 + 0.25 * e;
+                const vol::svi::Params p{0.01 + 0.02 * T, 0.15, -0.3, -0.02, 0.2};
+                const double F = S * std::exp((r - q) * T);
+                std::vector<double> K, bid, ask, mid;
+                std::vector<std::uint8_t> call;
+                for (int i = 0; i < N_STRIKES; ++i) {
+                    const double k = -0.6 + 1.2 * i / (N_STRIKES - 1);
+                    const double strike = F * std::exp(k);
+                    const bool is_call = k >= 0.0;
+                    const double px = vol::bs::price(S, strike, r, q, T, std::sqrt(vol::svi::total_variance(k, p) / T), is_call);
+                    K.push_back(strike);
+                    mid.push_back(px);
+                    bid.push_back(px * 0.99);
+                    ask.push_back(px * 1.01);
+                    call.push_back(is_call ? 1 : 0);
+                    csv << u << ',' << S << ',' << strike << ',' << r << ',' << q << ',' << T << ','
+                        << (is_call ? 1 : 0) << ',' << bid.back() << ',' << ask.back() << ',' << px << '\n';
+                }
+                writer.add_slice(static_cast<std::uint32_t>(u), T, F, std::exp(-r * T), K, bid, ask, mid, call);
+            }
+        }
+        writer.write(out.snapshot);
+        return out;
+    }();
+    return f;
+}
+
+struct RowSlice {
+    std::vector<OptionSpec> opts;
+    std::vector<double> mids;
+};
+
+// Current path: text rows -> OptionSpec + mids, grouped by (underlying, expiry)
+std::vector<RowSlice> load_csv(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line); // header
+    std::vector<RowSlice> slices;
+    long last_u = -1;
+    double last_T = -1.0;
+    while (std::getline(in, line)) {
+        const char* p = line.c_str();
+        char* end = nullptr;
+        const long u = std::strtol(p, &end, 10);
+        double v[9];
+        for (double& x : v) {
+            x = std::strtod(end + 1, &end);
+        }
+        if (u != last_u || v[4] != last_T) {
+            slices.emplace_back();
+            last_u = u;
+            last_T = v[4];
+        }
+        slices.back().opts.push_back(OptionSpec{v[0], v[1], v[2], v[3], v[4], v[5] != 0.0});
+        slices.back().mids.push_back(v[8]);
+    }
+    return slices;
+}
+
+} // namespace
+
+static void BM_Chain_Load_CSV(benchmark::State& state) {
+    const auto& f = files();
+    std::size_t rows = 0;
+    for (auto _ : state) {
+        auto slices = load_csv(f.csv);
+        rows = 0;
+        for (const auto& s : slices) rows += s.opts.size();
+        benchmark::DoNotOptimize(slices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rows));
+}
+BENCHMARK(BM_Chain_Load_CSV)->Unit(benchmark::kMillisecond);
+
+static void BM_Chain_Load_Snapshot(benchmark::State& state) {
+    const auto& f = files();
+    std::size_t rows = 0;
+    for (auto _ : state) {
+        const auto snap = vol::io::ChainSnapshot::open(f.snapshot);
+        double sum = 0.0; // touch every strike/mid so the pages are actually read
+        for (std::size_t i = 0; i < snap.slices(); ++i) {
+            const auto v = snap.slice(i);
+            for (std::size_t j = 0; j < v.strike.size(); ++j) sum += v.strike[j] + v.mid[j];
+        }
+        rows = snap.rows();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rows));
+}
+BENCHMARK(BM_Chain_Load_Snapshot)->Unit(benchmark::kMillisecond);
+
+static void BM_Chain_LoadCalibrate_CSV(benchmark::State& state) {
+    const auto& f = files();
+    for (auto _ : state) {
+        const auto slices = load_csv(f.csv);
+        double acc = 0.0;
+        for (const auto& s : slices) {
+            acc += vol::svi::calibrate_slice_from_prices(s.opts, s.mids)[0];
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * N_UNDERLYINGS * N_EXPIRIES);
+}
+BENCHMARK(BM_Chain_LoadCalibrate_CSV)->Unit(benchmark::kMillisecond);
+
+static void BM_Chain_LoadCalibrate_Snapshot(benchmark::State& state) {
+    const auto& f = files();
+    for (auto _ : state) {
+        const auto snap = vol::io::ChainSnapshot::open(f.snapshot);
+        double acc = 0.0;
+        for (std::size_t i = 0; i < snap.slices(); ++i) {
+            const auto v = snap.slice(i);
+            acc += vol::svi::calibrate_slice({v.T, v.forward, v.discount, v.strike, v.mid, v.is_call})[0];
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * N_UNDERLYINGS * N_EXPIRIES);
+}
+BENCHMARK(BM_Chain_LoadCalibrate_Snapshot)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
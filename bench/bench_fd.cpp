@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "libvol/models/american.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/fd.hpp"
+
+namespace {
+
+// One expiry smile: S = 100, K 70..133, puts below 100 and calls above, skewed vols
+struct Smile {
+    std::vector<double> K, vols;
+    std::vector<std::uint8_t> is_call;
+};
+
+const Smile& smile() {
+    static const Smile s = [] {
+        Smile out;
+        for (int i = 0; i < 64; ++i) {
+            out.K.push_back(70.0 + i);
+            out.vols.push_back(0.25 - 0.2 * std::log(out.K.back() / 100.0));
+            out.is_call.push_back(out.K.back() >= 100.0);
+        }
+        return out;
+    }();
+    return s;
+}
+
+constexpr double R = 0.05, Q = 0.02, T = 0.5;
+
+double reference(std::size_t i, bool american) {
+    const Smile& s = smile();
+    const bool call = s.is_call[i] != 0;
+    return american ? vol::american::price(100.0, s.K[i], R, Q, T, s.vols[i], call, vol::american::HIGH)
+                    : vol::bs::price(100.0, s.K[i], R, Q, T, s.vols[i], call);
+}
+
+vol::fd::Config grid(int space_steps) {
+    vol::fd::Config cfg;
+    cfg.space_steps = space_steps;
+    cfg.time_steps = space_steps / 2;
+    return cfg;
+}
+
+} // namespace
+
+// Strike by strike, price only; arg = space steps, American flag
+static void BM_FD_Price(benchmark::State& state) {
+    const Smile& s = smile();
+    const auto cfg = grid(static_cast<int>(state.range(0)));
+    const bool american = state.range(1) != 0;
+    std::vector<double> out(s.K.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < s.K.size(); ++i) {
+            out[i] = vol::fd::price(100.0, s.K[i], R, Q, T, s.vols[i], s.is_call[i] != 0, american, cfg);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    double err = 0.0;
+    for (std::size_t i = 0; i < s.K.size(); ++i) err = std::max(err, std::abs(out[i] - reference(i, american)));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(s.K.size()));
+    state.counters["max_abs_err"] = err;
+}
+BENCHMARK(BM_FD_Price)->ArgsProduct({{100, 200, 400}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Full greeks (five solves per strike): one strike at a time against the batched solve
+static void BM_FD_Greeks_Scalar(benchmark::State& state) {
+    const Smile& s = smile();
+    const auto cfg = grid(static_cast<int>(state.range(0)));
+    std::vector<vol::fd::PriceGreeks> out(s.K.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < s.K.size(); ++i) {
+            out[i] = vol::fd::price_greeks(100.0, s.K[i], R, Q, T, s.vols[i], s.is_call[i] != 0, true, cfg);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(s.K.size()));
+}
+BENCHMARK(BM_FD_Greeks_Scalar)->Arg(200)->Arg(400)->Unit(benchmark::kMillisecond);
+
+static void BM_FD_Greeks_Batch(benchmark::State& state) {
+    const Smile& s = smile();
+    const auto cfg = grid(static_cast<int>(state.range(0)));
+    std::vector<vol::fd::PriceGreeks> out(s.K.size());
+    for (auto _ : state) {
+        vol::fd::price_greeks_batch(100.0, R, Q, T, s.K, s.vols, s.is_call, true, out, cfg);
+        benchmark::DoNotOptimize(out.data());
+    }
+    double err = 0.0;
+    for (std::size_t i = 0; i < s.K.size(); ++i) err = std::max(err, std::abs(out[i].price - reference(i, true)));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(s.K.size()));
+    state.counters["max_abs_err"] = err;
+}
+BENCHMARK(BM_FD_Greeks_Batch)->Arg(200)->Arg(400)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,14 +1,73 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <string>
+#include <vector>
 
 #include "libvol/models/heston.hpp"
+#include "libvol/models/heston_cf.hpp"
+#include "libvol/models/heston_proxy.hpp"
+#include "libvol/calib/least_squares.hpp"
 
 namespace {
 
 constexpr vol::heston::Params ATM_PARAMS{1.5, 0.04, 0.5, -0.7, 0.04};
 constexpr vol::heston::Params STRESSED_PARAMS{2.5, 0.09, 0.7, -0.5, 0.08};
 
+double reference_price(double K, double T, const vol::heston::Params& params) {
+    vol::heston::AdaptiveConfig cfg;
+    cfg.tol = 1e-12;
+    cfg.max_nodes = 4097;
+    return vol::heston::price_cf_adaptive(100.0, K, 0.01, 0.0, T, params, true, cfg).price;
+}
+
+// 1M..2Y x 80%..120% strikes, calm and stressed parameters
+struct SurfacePoint { double K, T; vol::heston::Params params; double ref; };
+
+std::vector<SurfacePoint> make_surface() {
+    std::vector<SurfacePoint> pts;
+    const double tenors[] = {1.0 / 12.0, 0.25, 0.5, 1.0, 2.0};
+    const double strikes[] = {80, 90, 95, 100, 105, 110, 120};
+    for (const auto& params : {ATM_PARAMS, STRESSED_PARAMS}) {
+        for (double T : tenors) {
+            for (double K : strikes) {
+                pts.push_back({K, T, params, reference_price(K, T, params)});
+            }
+        }
+    }
+    return pts;
+}
+
+const std::vector<SurfacePoint>& surface() {
+    static const std::vector<SurfacePoint> pts = make_surface();
+    return pts;
+}
+
+// std::complex version of the CF (the form price_cf used before the batch kernel),
+// kept here as the baseline for the CF throughput benchmarks
+std::complex<double> scalar_cf(std::complex<double> u, double x0, double T, const vol::heston::Params& p) {
+    using C = std::complex<double>;
+    const C iu = C(0.0, 1.0) * u;
+    const double s2 = p.sigma * p.sigma;
+    const C beta = p.kappa - p.rho * p.sigma * iu;
+    const C d = std::sqrt(beta * beta + s2 * (iu + u * u));
+    const C g = (beta - d) / (beta + d);
+    const C e = std::exp(-d * T);
+    const C Cc = (p.kappa * p.theta / s2) * ((beta - d) * T - 2.0 * std::log((1.0 - g * e) / (1.0 - g)));
+    const C D = (beta - d) / s2 * ((1.0 - e) / (1.0 - g * e));
+    return std::exp(Cc + D * p.v0 + iu * x0);
+}
+
+std::vector<double> cf_nodes(std::size_t n) {
+    std::vector<double> u(n);
+    for (std::size_t j = 0; j < n; ++j) {
+        u[j] = 0.05 + 40.0 * static_cast<double>(j) / static_cast<double>(n);
+    }
+    return u;
+}
+
 } // namespace
 
 static void BM_Heston_ATM_Call64(benchmark::State& state) {
@@ -60,8 +119,306 @@ static void BM_Heston_GaussLaguerreOrder(benchmark::State& state) {
             100.0, 90.0, 0.01, 0.0, 0.5, STRESSED_PARAMS, true, n_gl);
         benchmark::DoNotOptimize(price);
     }
+    const double last = vol::heston::price_cf(100.0, 90.0, 0.01, 0.0, 0.5, STRESSED_PARAMS, true, n_gl);
+    state.counters["abs_err"] = std::abs(last - reference_price(90.0, 0.5, STRESSED_PARAMS));
+    state.counters["nodes"] = n_gl;
     state.SetLabel("n_gl=" + std::to_string(n_gl));
 }
 BENCHMARK(BM_Heston_GaussLaguerreOrder)->Arg(32)->Arg(64)->Arg(96);
 
+// Same option as above, adaptive mode; arg = -log10(tol)
+static void BM_Heston_Adaptive(benchmark::State& state) {
+    vol::heston::AdaptiveConfig cfg;
+    cfg.tol = std::pow(10.0, -static_cast<double>(state.range(0)));
+    vol::heston::CFResult res{};
+    for (auto _ : state) {
+        res = vol::heston::price_cf_adaptive(100.0, 90.0, 0.01, 0.0, 0.5, STRESSED_PARAMS, true, cfg);
+        benchmark::DoNotOptimize(res);
+    }
+    state.counters["abs_err"] = std::abs(res.price - reference_price(90.0, 0.5, STRESSED_PARAMS));
+    state.counters["err_est"] = res.error_estimate;
+    state.counters["nodes"] = res.nodes;
+}
+BENCHMARK(BM_Heston_Adaptive)->Arg(4)->Arg(6)->Arg(8);
+
+// Whole surface at fixed Gauss-Laguerre order: per-price time, worst error
+static void BM_Heston_Surface_GaussLaguerre(benchmark::State& state) {
+    const int n_gl = static_cast<int>(state.range(0));
+    const auto& pts = surface();
+    double max_err = 0.0;
+    for (auto _ : state) {
+        for (const auto& p : pts) {
+            const double px = vol::heston::price_cf(100.0, p.K, 0.01, 0.0, p.T, p.params, true, n_gl);
+            benchmark::DoNotOptimize(px);
+            max_err = std::max(max_err, std::abs(px - p.ref));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(pts.size()));
+    state.counters["avg_nodes"] = n_gl;
+    state.counters["max_abs_err"] = max_err;
+}
+BENCHMARK(BM_Heston_Surface_GaussLaguerre)->Arg(64)->Arg(128);
+
+// Whole surface in adaptive mode; arg = -log10(tol)
+static void BM_Heston_Surface_Adaptive(benchmark::State& state) {
+    vol::heston::AdaptiveConfig cfg;
+    cfg.tol = std::pow(10.0, -static_cast<double>(state.range(0)));
+    const auto& pts = surface();
+    double max_err = 0.0;
+    double node_sum = 0.0;
+    for (auto _ : state) {
+        node_sum = 0.0;
+        for (const auto& p : pts) {
+            const auto res = vol::heston::price_cf_adaptive(100.0, p.K, 0.01, 0.0, p.T, p.params, true, cfg);
+            benchmark::DoNotOptimize(res);
+            max_err = std::max(max_err, std::abs(res.price - p.ref));
+            node_sum += res.nodes;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(pts.size()));
+    state.counters["avg_nodes"] = node_sum / static_cast<double>(pts.size());
+    state.counters["max_abs_err"] = max_err;
+}
+BENCHMARK(BM_Heston_Surface_Adaptive)->Arg(6)->Arg(8);
+
+// Whole surface with the damped-contour / control-variate pricer; arg = Gauss-Laguerre order
+static void BM_Heston_Surface_Damped(benchmark::State& state) {
+    const int n_nodes = static_cast<int>(state.range(0));
+    const auto& pts = surface();
+    double max_err = 0.0;
+    for (auto _ : state) {
+        for (const auto& p : pts) {
+            const double px = vol::heston::price_cf_damped(100.0, p.K, 0.01, 0.0, p.T, p.params, true, n_nodes);
+            benchmark::DoNotOptimize(px);
+            max_err = std::max(max_err, std::abs(px - p.ref));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(pts.size()));
+    state.counters["avg_nodes"] = n_nodes;
+    state.counters["max_abs_err"] = max_err;
+}
+BENCHMARK(BM_Heston_Surface_Damped)->Arg(16)->Arg(20)->Arg(24)->Arg(32)->Arg(40);
+
+// Deep OTM short-dated call (K = 160, T = 3M): relative error, GL64 (arg 0) vs damped 32 (arg 1)
+static void BM_Heston_DeepOTM(benchmark::State& state) {
+    const bool damped = state.range(0) != 0;
+    auto price = [&] {
+        return damped
+            ? vol::heston::price_cf_damped(100.0, 160.0, 0.01, 0.0, 0.25, STRESSED_PARAMS, true)
+            : vol::heston::price_cf(100.0, 160.0, 0.01, 0.0, 0.25, STRESSED_PARAMS, true, 64);
+    };
+    double px = 0.0;
+    for (auto _ : state) {
+        px = price();
+        benchmark::DoNotOptimize(px);
+    }
+    const double ref = reference_price(160.0, 0.25, STRESSED_PARAMS);
+    state.counters["price"] = ref;
+    state.counters["rel_err"] = std::abs(px - ref) / ref;
+    state.SetLabel(damped ? "damped32" : "gl64");
+}
+BENCHMARK(BM_Heston_DeepOTM)->Arg(0)->Arg(1);
+
+// CF evaluations per second (items_per_second); arg = nodes per call
+static void BM_Heston_CF_Scalar(benchmark::State& state) {
+    const auto u_re = cf_nodes(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::complex<double>> out(u_re.size());
+    for (auto _ : state) {
+        for (std::size_t j = 0; j < u_re.size(); ++j) {
+            out[j] = scalar_cf({u_re[j], -1.0}, std::log(100.0), 1.0, STRESSED_PARAMS);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Heston_CF_Scalar)->Arg(64)->Arg(1024);
+
+static void BM_Heston_CF_Batch(benchmark::State& state) {
+    const auto u_re = cf_nodes(static_cast<std::size_t>(state.range(0)));
+    const std::vector<double> u_im(u_re.size(), -1.0);
+    std::vector<double> re(u_re.size());
+    std::vector<double> im(u_re.size());
+    for (auto _ : state) {
+        vol::heston::characteristic_batch(u_re.data(), u_im.data(), u_re.size(), std::log(100.0), 0.0, 1.0,
+                                          STRESSED_PARAMS, re.data(), im.data());
+        benchmark::DoNotOptimize(re.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Heston_CF_Batch)->Arg(64)->Arg(1024);
+
+// Every first-order sensitivity of one ATM call: adjoint sweep against central bumps of
+// the ten inputs (20 prices); compare both with BM_Heston_ATM_Call64
+static void BM_Heston_Sensitivities_Adjoint(benchmark::State& state) {
+    for (auto _ : state) {
+        const auto s = vol::heston::price_cf_sensitivities(100.0, 100.0, 0.01, 0.0, 1.0, ATM_PARAMS, true, 64);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(BM_Heston_Sensitivities_Adjoint);
+
+static void BM_Heston_Sensitivities_Bumped(benchmark::State& state) {
+    constexpr double h = 1e-5;
+    for (auto _ : state) {
+        double inputs[10] = {100.0, 100.0, 0.01, 0.0, 1.0, ATM_PARAMS.kappa, ATM_PARAMS.theta,
+                             ATM_PARAMS.sigma, ATM_PARAMS.rho, ATM_PARAMS.v0};
+        double grad[10];
+        for (int i = 0; i < 10; ++i) {
+            double up = 0.0, down = 0.0;
+            for (double sgn : {1.0, -1.0}) {
+                double x[10];
+                std::copy(inputs, inputs + 10, x);
+                x[i] += sgn * h;
+                const double v = vol::heston::price_cf(x[0], x[1], x[2], x[3], x[4],
+                                                       {x[5], x[6], x[7], x[8], x[9]}, true, 64);
+                (sgn > 0.0 ? up : down) = v;
+            }
+            grad[i] = (up - down) / (2.0 * h);
+        }
+        benchmark::DoNotOptimize(grad);
+    }
+}
+BENCHMARK(BM_Heston_Sensitivities_Bumped);
+
+// Objective and exact parameter gradient over the calm half of the bench surface
+static void BM_Heston_CalibrationObjective(benchmark::State& state) {
+    const bool with_grad = state.range(0) != 0;
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+    for (const auto& pt : surface()) {
+        if (pt.params.kappa != ATM_PARAMS.kappa) continue;
+        opts.push_back({100.0, pt.K, 0.01, 0.0, pt.T, true});
+        mids.push_back(pt.ref);
+    }
+    const vol::heston::Params guess{2.0, 0.05, 0.6, -0.6, 0.05};
+    vol::heston::Params grad{};
+    for (auto _ : state) {
+        const double f = vol::heston::calibration_objective(opts, mids, {}, guess, with_grad ? &grad : nullptr);
+        benchmark::DoNotOptimize(f);
+        benchmark::DoNotOptimize(grad);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(opts.size()));
+}
+BENCHMARK(BM_Heston_CalibrationObjective)->Arg(0)->Arg(1);
+
+namespace {
+
+// Seven-axis proxy over the calm surface's 3M..2Y tenors and a box around ATM_PARAMS:
+// 12 x 8 (K/S, T) x 4^5 parameter nodes = 98k price_cf calls, built once per process
+const vol::heston::ChebyshevProxy& surface_proxy() {
+    static const vol::heston::ChebyshevProxy proxy = [] {
+        using vol::heston::ProxyDim;
+        vol::heston::ProxyConfig cfg;
+        cfg.axes = {{ProxyDim::Moneyness, 0.8, 1.2, 12}, {ProxyDim::T, 0.25, 2.0, 8},
+                    {ProxyDim::Kappa, 1.0, 3.0, 4},      {ProxyDim::Theta, 0.02, 0.08, 4},
+                    {ProxyDim::Sigma, 0.3, 0.8, 4},      {ProxyDim::Rho, -0.9, -0.4, 4},
+                    {ProxyDim::V0, 0.02, 0.08, 4}};
+        cfg.r = 0.01;
+        cfg.n_gl = 64;
+        cfg.check_points = 500;
+        return vol::heston::ChebyshevProxy::build(cfg);
+    }();
+    return proxy;
+}
+
+void proxy_counters(benchmark::State& state) {
+    const auto& proxy = surface_proxy();
+    state.counters["nodes"] = static_cast<double>(proxy.nodes());
+    state.counters["build_s"] = proxy.build_seconds();
+    state.counters["max_err"] = proxy.max_abs_error();
+    state.counters["tail"] = proxy.tail_estimate();
+}
+
+// Calm-parameter quotes inside the proxy's tenor range (3M..2Y x 80%..120%)
+void proxy_quotes(std::vector<vol::OptionSpec>& opts, std::vector<double>& mids) {
+    for (const auto& pt : surface()) {
+        if (pt.params.kappa != ATM_PARAMS.kappa || pt.T < 0.25) continue;
+        opts.push_back({100.0, pt.K, 0.01, 0.0, pt.T, true});
+        mids.push_back(pt.ref);
+    }
+}
+
+std::vector<double> to_vec(const vol::heston::Params& p) {
+    return {p.kappa, p.theta, p.sigma, p.rho, p.v0};
+}
+
+vol::heston::Params from_vec(const std::vector<double>& x) {
+    return {x[0], x[1], x[2], x[3], x[4]};
+}
+
+} // namespace
+
+// One full seven-axis contraction per price (no bind): the worst case for the proxy
+static void BM_Heston_Proxy_Price(benchmark::State& state) {
+    const auto& proxy = surface_proxy();
+    const vol::heston::Params p{2.0, 0.05, 0.6, -0.6, 0.05};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(proxy.price(100.0, 95.0, 1.0, p));
+    }
+    proxy_counters(state);
+}
+BENCHMARK(BM_Heston_Proxy_Price);
+
+// Proxy objective (+ interpolant gradient) over the same quotes as the exact objective
+// below: one bind per call, then a 96-node tensor per quote
+static void BM_Heston_Proxy_Objective(benchmark::State& state) {
+    const bool with_grad = state.range(0) != 0;
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+    proxy_quotes(opts, mids);
+    const auto& proxy = surface_proxy();
+    const vol::heston::Params guess{2.0, 0.05, 0.6, -0.6, 0.05};
+    vol::heston::Params grad{};
+    for (auto _ : state) {
+        const double f = vol::heston::calibration_objective(proxy, opts, mids, {}, guess, with_grad ? &grad : nullptr);
+        benchmark::DoNotOptimize(f);
+        benchmark::DoNotOptimize(grad);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(opts.size()));
+    proxy_counters(state);
+}
+BENCHMARK(BM_Heston_Proxy_Objective)->Arg(0)->Arg(1);
+
+// Calibration from a distant start with calib::lbfgsb: exact objective throughout (0) vs
+// proxy coarse stage + a short exact polish (1). Reports the final price rmse against the
+// quotes and the exact-objective calls made; the proxy build is not included.
+static void BM_Heston_Proxy_Calibration(benchmark::State& state) {
+    const bool use_proxy = state.range(0) != 0;
+    constexpr int COARSE_ITERS = 200, POLISH_ITERS = 20;
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+    proxy_quotes(opts, mids);
+    const auto& proxy = surface_proxy();
+    const std::vector<double> lb{1.0, 0.02, 0.3, -0.9, 0.02}, ub{3.0, 0.08, 0.8, -0.4, 0.08};
+    const std::vector<double> x0{2.5, 0.07, 0.7, -0.45, 0.07};
+    int exact_calls = 0;
+    auto exact = [&](const std::vector<double>& x, double& f, std::vector<double>& g) {
+        vol::heston::Params grad{};
+        f = vol::heston::calibration_objective(opts, mids, {}, from_vec(x), &grad);
+        g = to_vec(grad);
+        ++exact_calls;
+    };
+    auto coarse = [&](const std::vector<double>& x, double& f, std::vector<double>& g) {
+        vol::heston::Params grad{};
+        f = vol::heston::calibration_objective(proxy, opts, mids, {}, from_vec(x), &grad);
+        g = to_vec(grad);
+    };
+    vol::calib::LSQResult res;
+    for (auto _ : state) {
+        exact_calls = 0;
+        if (use_proxy) {
+            const auto c = vol::calib::lbfgsb(x0, lb, ub, coarse, COARSE_ITERS);
+            res = vol::calib::lbfgsb(c.x, lb, ub, exact, POLISH_ITERS);
+        } else {
+            res = vol::calib::lbfgsb(x0, lb, ub, exact, COARSE_ITERS + POLISH_ITERS);
+        }
+    }
+    state.counters["rmse"] = std::sqrt(2.0 * res.obj / static_cast<double>(opts.size()));
+    state.counters["exact_calls"] = exact_calls;
+    proxy_counters(state);
+}
+BENCHMARK(BM_Heston_Proxy_Calibration)->Arg(0)->Arg(1)->Iterations(1)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,168 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "libvol/calib/differential_evolution.hpp"
+#include "libvol/calib/least_squares.hpp"
+#include "libvol/models/heston.hpp"
+#include "libvol/models/heston_objective.hpp"
+
+namespace {
+
+// Synthetic surfaces: 5 tenors x 9 strikes priced with price_cf (GL64) at known parameters.
+// Case 1 is the hard one: slow mean reversion with high vol-of-vol, where (kappa, sigma)
+// trade off along a long valley.
+constexpr vol::heston::Params TRUTH[] = {
+    {1.5, 0.04, 0.5, -0.7, 0.04},
+    {0.4, 0.09, 0.9, -0.5, 0.03},
+    {3.5, 0.03, 0.35, -0.85, 0.06},
+};
+
+const std::vector<double> LB{0.1, 0.01, 0.1, -0.95, 0.01};
+const std::vector<double> UB{5.0, 0.20, 1.0, 0.0, 0.20};
+
+// price rmse target at S = 100 (about 0.3 vol points ATM at 1Y)
+constexpr double TARGET_RMSE = 1e-2;
+
+struct Surface {
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+};
+
+Surface make_surface(const vol::heston::Params& p) {
+    Surface s;
+    for (double T : {0.1, 0.25, 0.5, 1.0, 2.0}) {
+        for (double K = 80.0; K <= 120.0; K += 5.0) {
+            s.opts.push_back({100.0, K, 0.01, 0.0, T, true});
+            s.mids.push_back(vol::heston::price_cf(100.0, K, 0.01, 0.0, T, p, true));
+        }
+    }
+    return s;
+}
+
+vol::heston::Params from_vec(const std::vector<double>& x) {
+    return {x[0], x[1], x[2], x[3], x[4]};
+}
+
+// 20 maturities (1M..5Y) x 50 strikes (60%..160%), OTM calls and puts
+Surface make_large_surface(const vol::heston::Params& p) {
+    Surface s;
+    for (int m = 0; m < 20; ++m) {
+        const double T = 1.0 / 12.0 * std::pow(60.0, m / 19.0);
+        for (int k = 0; k < 50; ++k) {
+            const double K = 60.0 + 100.0 * k / 49.0;
+            const bool call = K >= 100.0;
+            s.opts.push_back({100.0, K, 0.01, 0.0, T, call});
+            s.mids.push_back(vol::heston::price_cf(100.0, K, 0.01, 0.0, T, p, call));
+        }
+    }
+    return s;
+}
+
+double rmse(const Surface& s, double obj) {
+    return std::sqrt(2.0 * obj / static_cast<double>(s.opts.size()));
+}
+
+} // namespace
+
+// Time to reach TARGET_RMSE (or give up) from scratch.
+// Args: truth case, method (0 = lbfgsb from the box centre, 1 = lbfgsb from 8 Latin-hypercube
+// starts, 2 = differential evolution stopping at the target + lbfgsb polish), threads.
+static void BM_HestonCalib_TimeToTarget(benchmark::State& state) {
+    const Surface s = make_surface(TRUTH[state.range(0)]);
+    const int method = static_cast<int>(state.range(1));
+    const int threads = static_cast<int>(state.range(2));
+    const double target_obj = 0.5 * static_cast<double>(s.opts.size()) * TARGET_RMSE * TARGET_RMSE;
+    auto f = [&](const std::vector<double>& x) {
+        return vol::heston::calibration_objective(s.opts, s.mids, {}, from_vec(x));
+    };
+    auto f_grad = [&](const std::vector<double>& x, double& obj, std::vector<double>& g) {
+        vol::heston::Params grad{};
+        obj = vol::heston::calibration_objective(s.opts, s.mids, {}, from_vec(x), &grad);
+        g = {grad.kappa, grad.theta, grad.sigma, grad.rho, grad.v0};
+    };
+
+    double obj = 0.0;
+    long long evals = 0;
+    for (auto _ : state) {
+        if (method == 2) {
+            vol::calib::DEConfig cfg;
+            cfg.population = 40;
+            cfg.max_generations = 150;
+            cfg.target = target_obj;
+            cfg.n_threads = threads;
+            cfg.polish = 2;
+            const auto res = vol::calib::differential_evolution(LB, UB, f, f_grad, cfg);
+            obj = res.obj;
+            evals = res.evaluations;
+        } else {
+            // the same local solver alone: one start, or several spread over the threads
+            vol::calib::DEConfig cfg;
+            cfg.population = method == 0 ? 4 : 8;
+            cfg.max_generations = 0;
+            cfg.n_threads = threads;
+            cfg.polish = method == 0 ? 0 : 8;
+            std::vector<double> centre(LB.size());
+            for (std::size_t j = 0; j < LB.size(); ++j) centre[j] = 0.5 * (LB[j] + UB[j]);
+            if (method == 0) {
+                obj = vol::calib::lbfgsb(centre, LB, UB, f_grad).obj;
+                evals = 0;
+            } else {
+                const auto res = vol::calib::differential_evolution(LB, UB, f, f_grad, cfg);
+                obj = res.obj;
+                evals = res.evaluations;
+            }
+        }
+    }
+    state.counters["rmse"] = rmse(s, obj);
+    state.counters["reached"] = obj <= target_obj ? 1.0 : 0.0;
+    state.counters["global_evals"] = static_cast<double>(evals);
+}
+
+static void TimeToTargetArgs(benchmark::internal::Benchmark* b) {
+    const int hw = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int truth = 0; truth < 3; ++truth) {
+        b->Args({truth, 0, 1});
+        b->Args({truth, 1, hw});
+        for (int t = 1; t <= hw; t *= 2) b->Args({truth, 2, t});
+        if ((hw & (hw - 1)) != 0) b->Args({truth, 2, hw});
+    }
+}
+BENCHMARK(BM_HestonCalib_TimeToTarget)->Apply(TimeToTargetArgs)->Iterations(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Objective (+ gradient) over the 1000-quote surface. Args: with_grad, threads; threads = 0
+// is the serial per-quote heston::calibration_objective for reference.
+static void BM_HestonCalib_Objective(benchmark::State& state) {
+    static const Surface s = make_large_surface(TRUTH[0]);
+    const bool with_grad = state.range(0) != 0;
+    const int threads = static_cast<int>(state.range(1));
+    const vol::heston::Params guess{2.0, 0.05, 0.6, -0.6, 0.05};
+    vol::heston::Params grad{};
+    if (threads == 0) {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(
+                vol::heston::calibration_objective(s.opts, s.mids, {}, guess, with_grad ? &grad : nullptr));
+        }
+    } else {
+        vol::heston::ParallelObjective obj(s.opts, s.mids, {}, threads);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(obj(guess, with_grad ? &grad : nullptr));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(s.opts.size()));
+}
+
+static void ObjectiveArgs(benchmark::internal::Benchmark* b) {
+    const int hw = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int grad = 0; grad <= 1; ++grad) {
+        b->Args({grad, 0});
+        for (int t = 1; t <= std::min(hw, 32); t *= 2) b->Args({grad, t});
+        if (hw < 32 && (hw & (hw - 1)) != 0) b->Args({grad, hw});
+    }
+}
+BENCHMARK(BM_HestonCalib_Objective)->Apply(ObjectiveArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
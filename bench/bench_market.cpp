@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/core/chain.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include "libvol/util/synthetic_market.hpp"
+
+// End-to-end surface build on a synthetic market (synth::generate_market, seed 1):
+// underlyings x 30 expiries x 80 strikes, each slice going through
+//   iv     drop crossed / no-bid quotes, invert every mid (bs::implied_vol on the Chain)
+//   fit    SVI slice calibration (svi::calibrate_slice on the Chain)
+//   eval   evaluate the fitted surface at every strike: w(k) -> vol -> model price
+// Slices are pulled from a shared counter by `threads` workers. items = quotes; stage
+// latencies are per slice. Machine-readable: --benchmark_format=json, or
+// --benchmark_out=market.json --benchmark_out_format=json.
+
+namespace {
+
+const vol::synth::Market& market(std::uint32_t underlyings) {
+    static std::map<std::uint32_t, vol::synth::Market> cache;   // filled before any worker starts
+    auto it = cache.find(underlyings);
+    if (it == cache.end()) {
+        vol::synth::MarketConfig cfg;
+        cfg.underlyings = underlyings;
+        it = cache.emplace(underlyings, vol::synth::generate_market(cfg)).first;
+    }
+    return it->second;
+}
+
+struct WorkerStats {
+    std::vector<double> iv_us, fit_us, eval_us, slice_us;
+    std::uint64_t dropped = 0, iv_failed = 0, quotes = 0;
+    double vol_err = 0.0;   // sum |fitted vol - true vol| over quotes
+};
+
+void build_slice(const vol::synth::MarketSlice& s, WorkerStats& st, std::vector<double>& mids,
+                 std::vector<vol::bs::IVResult>& ivs, std::vector<double>& buf, std::vector<double>& px) {
+    const std::size_t n = s.size();
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // iv
+    const vol::Chain chain = vol::make_chain(s.expiry(), s.strike, s.is_call);
+    mids.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool usable = s.bid[i] > 0.0 && s.bid[i] <= s.ask[i];
+        mids[i] = usable ? s.mid[i] : 0.0;
+        st.dropped += usable ? 0 : 1;
+    }
+    ivs.resize(n);
+    vol::bs::implied_vol(chain, mids, ivs);
+    for (std::size_t i = 0; i < n; ++i) st.iv_failed += (mids[i] > 0.0 && !ivs[i].converged) ? 1 : 0;
+    const auto t1 = std::chrono::steady_clock::now();
+
+    // fit
+    const vol::svi::Params p = vol::svi::calibrate_slice(chain, mids);
+    const auto t2 = std::chrono::steady_clock::now();
+
+    // eval
+    buf.resize(n);
+    px.resize(n);
+    vol::svi::total_variance_batch(chain.k.data(), n, p, buf.data());
+    const double inv_T = 1.0 / s.T;
+    for (std::size_t i = 0; i < n; ++i) buf[i] = std::sqrt(std::max(0.0, buf[i]) * inv_T);
+    vol::bs::price(chain, buf, px);
+    const auto t3 = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        st.vol_err += std::abs(buf[i] - std::sqrt(vol::svi::total_variance(chain.k[i], s.truth) * inv_T));
+    }
+    benchmark::DoNotOptimize(px.data());
+    using us = std::chrono::duration<double, std::micro>;
+    st.iv_us.push_back(us(t1 - t0).count());
+    st.fit_us.push_back(us(t2 - t1).count());
+    st.eval_us.push_back(us(t3 - t2).count());
+    st.slice_us.push_back(us(t3 - t0).count());
+    st.quotes += n;
+}
+
+double pct(std::vector<double>& v, double q) {
+    if (v.empty()) return 0.0;
+    const auto i = static_cast<std::size_t>(q * static_cast<double>(v.size() - 1));
+    std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(i), v.end());
+    return v[i];
+}
+
+} // namespace
+
+// args: underlyings, worker threads
+static void BM_Market_EndToEnd(benchmark::State& state) {
+    const auto& m = market(static_cast<std::uint32_t>(state.range(0)));
+    const int n_threads = static_cast<int>(state.range(1));
+    WorkerStats total;
+
+    for (auto _ : state) {
+        std::atomic<std::size_t> next{0};
+        std::vector<WorkerStats> per(static_cast<std::size_t>(n_threads));
+        std::vector<std::thread> workers;
+        for (int t = 0; t < n_threads; ++t) {
+            workers.emplace_back([&, t] {
+                WorkerStats& st = per[static_cast<std::size_t>(t)];
+                std::vector<double> mids, buf, px;
+                std::vector<vol::bs::IVResult> ivs;
+                while (true) {
+                    const std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= m.slices.size()) break;
+                    build_slice(m.slices[i], st, mids, ivs, buf, px);
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+        for (auto& st : per) {
+            total.iv_us.insert(total.iv_us.end(), st.iv_us.begin(), st.iv_us.end());
+            total.fit_us.insert(total.fit_us.end(), st.fit_us.begin(), st.fit_us.end());
+            total.eval_us.insert(total.eval_us.end(), st.eval_us.begin(), st.eval_us.end());
+            total.slice_us.insert(total.slice_us.end(), st.slice_us.begin(), st.slice_us.end());
+            total.dropped += st.dropped;
+            total.iv_failed += st.iv_failed;
+            total.quotes += st.quotes;
+            total.vol_err += st.vol_err;
+        }
+    }
+
+    const double q = static_cast<double>(total.quotes);
+    state.SetItemsProcessed(static_cast<int64_t>(total.quotes));
+    state.counters["slices_per_s"] =
+        benchmark::Counter(static_cast<double>(total.slice_us.size()), benchmark::Counter::kIsRate);
+    state.counters["iv_p50_us"] = pct(total.iv_us, 0.50);
+    state.counters["iv_p99_us"] = pct(total.iv_us, 0.99);
+    state.counters["fit_p50_us"] = pct(total.fit_us, 0.50);
+    state.counters["fit_p99_us"] = pct(total.fit_us, 0.99);
+    state.counters["eval_p50_us"] = pct(total.eval_us, 0.50);
+    state.counters["eval_p99_us"] = pct(total.eval_us, 0.99);
+    state.counters["slice_p99_us"] = pct(total.slice_us, 0.99);
+    state.counters["dropped_frac"] = static_cast<double>(total.dropped) / q;
+    state.counters["iv_fail_frac"] = static_cast<double>(total.iv_failed) / q;
+    state.counters["vol_err_bp"] = 1e4 * total.vol_err / q;
+}
+
+// 1, 2, 4, ... up to the hardware thread count, on a 25-underlying slice of the market and
+// on the full 500 x 30 x 80 (1.2M quotes) book
+static void market_args(benchmark::internal::Benchmark* b) {
+    const int hw = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<int> threads;
+    for (int t = 1; t < hw; t *= 2) threads.push_back(t);
+    threads.push_back(hw);
+    for (int u : {25, 500}) {
+        for (int t : threads) b->Args({u, t});
+    }
+}
+BENCHMARK(BM_Market_EndToEnd)
+    ->Apply(market_args)->ArgNames({"underlyings", "threads"})->Iterations(1)->UseRealTime()
+    ->Unit(benchmark::kSecond);
+
+static void BM_Market_Generate(benchmark::State& state) {
+    vol::synth::MarketConfig cfg;
+    cfg.underlyings = static_cast<std::uint32_t>(state.range(0));
+    std::size_t quotes = 0;
+    for (auto _ : state) {
+        const auto m = vol::synth::generate_market(cfg);
+        quotes += m.quotes();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(quotes));
+}
+BENCHMARK(BM_Market_Generate)->Arg(25)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include "libvol/mc/gbm.hpp"
+#include "libvol/mc/mlmc.hpp"
+#include "libvol/mc/path_mc.hpp"
+#include "libvol/models/black_scholes.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+struct Params {
+    double S = 100, K = 105, r = 0.02, q = 0.01, T = 1.0, vol = 0.2;
+};
+
+constexpr std::uint64_t PATHS = 100000;
+
+} // namespace
+
+// Price plus pathwise delta / vega and likelihood-ratio gamma from one set of paths
+static void BM_MC_GBM_Greeks_SamePass(benchmark::State& state) {
+    Params p;
+    vol::mc::MCResult res{};
+    for (auto _ : state) {
+        res = vol::mc::european_vanilla_gbm(p.S, p.K, p.r, p.q, p.T, p.vol, true, PATHS, 42);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * PATHS);
+    state.counters["delta_se"] = res.delta.std_err;
+    state.counters["gamma_se"] = res.gamma.std_err;
+    state.counters["vega_se"] = res.vega.std_err;
+}
+BENCHMARK(BM_MC_GBM_Greeks_SamePass)->Unit(benchmark::kMillisecond);
+
+// The same three greeks by central bump-and-revalue with common random numbers: 5 runs
+static void BM_MC_GBM_Greeks_Bumped(benchmark::State& state) {
+    Params p;
+    const double hS = 0.01 * p.S, hv = 0.01;
+    double delta = 0.0, gamma = 0.0, vega = 0.0;
+    for (auto _ : state) {
+        const double base = vol::mc::european_vanilla_gbm(p.S, p.K, p.r, p.q, p.T, p.vol, true, PATHS, 42).price;
+        const double up = vol::mc::european_vanilla_gbm(p.S + hS, p.K, p.r, p.q, p.T, p.vol, true, PATHS, 42).price;
+        const double dn = vol::mc::european_vanilla_gbm(p.S - hS, p.K, p.r, p.q, p.T, p.vol, true, PATHS, 42).price;
+        const double vu = vol::mc::european_vanilla_gbm(p.S, p.K, p.r, p.q, p.T, p.vol + hv, true, PATHS, 42).price;
+        const double vd = vol::mc::european_vanilla_gbm(p.S, p.K, p.r, p.q, p.T, p.vol - hv, true, PATHS, 42).price;
+        delta = (up - dn) / (2.0 * hS);
+        gamma = (up - 2.0 * base + dn) / (hS * hS);
+        vega = (vu - vd) / (2.0 * hv);
+        benchmark::DoNotOptimize(delta);
+        benchmark::DoNotOptimize(gamma);
+        benchmark::DoNotOptimize(vega);
+    }
+    state.SetItemsProcessed(state.iterations() * PATHS);
+}
+BENCHMARK(BM_MC_GBM_Greeks_Bumped)->Unit(benchmark::kMillisecond);
+
+// Multilevel MC to RMSE eps = arg / 1000. cost counts simulated steps; mc_cost is what plain
+// MC needs on the finest grid MLMC settled on, and eps2_* times eps^2 (flat for O(eps^-2)).
+static void run_mlmc(benchmark::State& state, const vol::mc::Discretisation& model, const vol::mc::PathPayoff& payoff) {
+    vol::mc::MLMCConfig cfg;
+    cfg.eps = static_cast<double>(state.range(0)) * 1e-3;
+    vol::mc::MLMCResult res{};
+    for (auto _ : state) {
+        res = vol::mc::mlmc(model, payoff, 1.0, cfg);
+        benchmark::DoNotOptimize(res);
+    }
+    const double eps2 = cfg.eps * cfg.eps;
+    state.counters["levels"] = static_cast<double>(res.levels.size());
+    state.counters["cost"] = res.cost;
+    state.counters["mc_cost"] = res.mc_cost;
+    state.counters["eps2_cost"] = eps2 * res.cost;
+    state.counters["eps2_mc_cost"] = eps2 * res.mc_cost;
+}
+
+static void BM_MLMC_GBM_Asian(benchmark::State& state) {
+    Params p;
+    run_mlmc(state, vol::mc::gbm_exact(p.S, p.r, p.q, p.vol), vol::mc::asian_arithmetic(p.K, true));
+}
+BENCHMARK(BM_MLMC_GBM_Asian)->Arg(40)->Arg(20)->Arg(10)->Arg(5)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+static void BM_MLMC_Heston_QE_Call(benchmark::State& state) {
+    Params p;
+    const vol::heston::Params hp{2.0, 0.04, 0.3, -0.7, 0.04};
+    const double K = p.K;
+    run_mlmc(state, vol::mc::heston_qe(p.S, p.r, p.q, hp),
+             [K](const vol::mc::PathView& path) { return path.S.back() > K ? path.S.back() - K : 0.0; });
+}
+BENCHMARK(BM_MLMC_Heston_QE_Call)->Arg(40)->Arg(20)->Arg(10)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+// Asian, barrier and lookback book on a 64-step grid, geometric Asian as the control
+static std::vector<vol::mc::PathPayoff> exotic_book(const Params& p) {
+    return {vol::mc::asian_arithmetic(p.K, true),
+            vol::mc::asian_arithmetic(p.K, false, vol::mc::Monitoring::Discrete),
+            vol::mc::barrier(p.K, true, 120.0, vol::mc::Barrier::UpOut),
+            vol::mc::barrier(p.K, true, 90.0, vol::mc::Barrier::DownOut, vol::mc::Monitoring::Discrete),
+            vol::mc::barrier(95.0, false, 85.0, vol::mc::Barrier::DownIn),
+            vol::mc::lookback_floating(true),
+            vol::mc::lookback_fixed(p.K, false)};
+}
+
+static vol::mc::PathMCConfig exotic_config(const Params& p) {
+    vol::mc::PathMCConfig cfg;
+    cfg.paths = PATHS;
+    cfg.n_threads = 1;
+    cfg.control = vol::mc::asian_geometric(p.K, true);
+    cfg.control_price = vol::mc::asian_geometric_gbm(p.S, p.K, p.r, p.q, p.T, p.vol, cfg.steps, true);
+    return cfg;
+}
+
+// All payoffs over one pass; arg = block size in KiB (131072: every path stored at once)
+static void BM_PathMC_Book_Shared(benchmark::State& state) {
+    Params p;
+    const auto book = exotic_book(p);
+    auto cfg = exotic_config(p);
+    cfg.block_bytes = static_cast<std::size_t>(state.range(0)) * 1024;
+    const auto model = vol::mc::gbm_exact(p.S, p.r, p.q, p.vol);
+    std::vector<vol::mc::MCResult> res;
+    for (auto _ : state) {
+        res = vol::mc::path_mc(model, book, p.T, cfg);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * PATHS);
+    state.counters["asian_se"] = res[0].std_err;
+}
+BENCHMARK(BM_PathMC_Book_Shared)->Arg(16)->Arg(256)->Arg(4096)->Arg(131072)->Unit(benchmark::kMillisecond);
+
+// The same book priced one payoff at a time, each on its own paths
+static void BM_PathMC_Book_Separate(benchmark::State& state) {
+    Params p;
+    const auto book = exotic_book(p);
+    const auto cfg = exotic_config(p);
+    const auto model = vol::mc::gbm_exact(p.S, p.r, p.q, p.vol);
+    for (auto _ : state) {
+        for (const auto& payoff : book) {
+            auto res = vol::mc::path_mc(model, std::span(&payoff, 1), p.T, cfg);
+            benchmark::DoNotOptimize(res);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PATHS);
+}
+BENCHMARK(BM_PathMC_Book_Separate)->Unit(benchmark::kMillisecond);
+
+// Down-and-out call (B = 90) on arg steps: error of the Brownian-bridge corrected and the
+// grid-only estimate against the continuous-monitoring closed form
+static void BM_PathMC_Barrier(benchmark::State& state) {
+    Params p;
+    const double B = 90.0;
+    const double lam = (p.r - p.q + 0.5 * p.vol * p.vol) / (p.vol * p.vol);
+    const double exact = vol::bs::price(p.S, p.K, p.r, p.q, p.T, p.vol, true)
+                       - std::pow(B / p.S, 2.0 * lam - 2.0) * vol::bs::price(B * B / p.S, p.K, p.r, p.q, p.T, p.vol, true);
+    const std::vector<vol::mc::PathPayoff> book{
+        vol::mc::barrier(p.K, true, B, vol::mc::Barrier::DownOut),
+        vol::mc::barrier(p.K, true, B, vol::mc::Barrier::DownOut, vol::mc::Monitoring::Discrete)};
+    vol::mc::PathMCConfig cfg;
+    cfg.steps = static_cast<int>(state.range(0));
+    cfg.paths = PATHS;
+    cfg.n_threads = 1;
+    const auto model = vol::mc::gbm_exact(p.S, p.r, p.q, p.vol);
+    std::vector<vol::mc::MCResult> res;
+    for (auto _ : state) {
+        res = vol::mc::path_mc(model, book, p.T, cfg);
+        benchmark::DoNotOptimize(res);
+    }
+    state.counters["bb_err"] = res[0].price - exact;
+    state.counters["grid_err"] = res[1].price - exact;
+    state.counters["se"] = res[0].std_err;
+}
+BENCHMARK(BM_PathMC_Barrier)->Arg(4)->Arg(16)->Arg(64)->Arg(252)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include "libvol/stream/pipeline.hpp"
+
+// Replay driver for the streaming calibration pipeline: a recorded tick tape (8 expiries x
+// 41 strikes, random strike per tick, smile level drifting) is pushed through
+// vol::stream::Pipeline and timed from the first submit to the last publish.
+
+namespace {
+
+constexpr double SPOT = 100.0;
+constexpr std::size_t TICKS = 20000;
+
+const std::vector<vol::stream::Expiry>& expiries() {
+    static const std::vector<vol::stream::Expiry> e{{1.0 / 12, 0.03, 0.01}, {0.25, 0.03, 0.01}, {0.5, 0.03, 0.01},
+                                                    {0.75, 0.03, 0.01},     {1.0, 0.03, 0.01},  {1.5, 0.03, 0.01},
+                                                    {2.0, 0.03, 0.01},      {3.0, 0.03, 0.01}};
+    return e;
+}
+
+// Ticks without timestamps; replay stamps them at submit
+const std::vector<vol::stream::Quote>& tape() {
+    static const std::vector<vol::stream::Quote> t = [] {
+        std::mt19937_64 rng(7);
+        std::uniform_int_distribution<std::uint32_t> pick_expiry(0, 7);
+        std::uniform_int_distribution<int> pick_strike(0, 40);
+        std::normal_distribution<double> shock(0.0, 0.002);
+        std::vector<double> level(expiries().size(), 1.0);
+        std::vector<vol::stream::Quote> out;
+        out.reserve(TICKS);
+        for (std::size_t i = 0; i < TICKS; ++i) {
+            const std::uint32_t e = pick_expiry(rng);
+            const auto& ex = expiries()[e];
+            level[e] *= 1.0 + shock(rng);
+            const double K = 70.0 + 1.5 * pick_strike(rng);
+            const vol::svi::Params p{0.02 * ex.T * level[e], 0.1, -0.4, 0.0, 0.2};
+            const double F = SPOT * std::exp((ex.r - ex.q) * ex.T);
+            const double vol = std::sqrt(vol::svi::total_variance(std::log(K / F), p) / ex.T);
+            const bool call = K >= SPOT;
+            out.push_back({e, K, vol::bs::price(SPOT, K, ex.r, ex.q, ex.T, vol, call), SPOT, call, 0});
+        }
+        return out;
+    }();
+    return t;
+}
+
+// Tick-to-surface latencies of every publish; written on the publish thread, read after flush()
+struct Latencies {
+    std::vector<double> us;
+    std::uint64_t ticks = 0;
+
+    void record(const vol::stream::SliceUpdate& u) {
+        us.push_back(static_cast<double>(u.published_ns - u.first_tick_ns) * 1e-3);
+        ticks += u.ticks;
+    }
+    double percentile(double p) {
+        if (us.empty()) return 0.0;
+        std::sort(us.begin(), us.end());
+        return us[static_cast<std::size_t>(p * static_cast<double>(us.size() - 1))];
+    }
+};
+
+vol::stream::Config config(Latencies& lat, int interval_us) {
+    vol::stream::Config cfg;
+    cfg.expiries = expiries();
+    cfg.publish = [&lat](const vol::stream::SliceUpdate& u) { lat.record(u); };
+    cfg.min_refit_interval = std::chrono::microseconds(interval_us);
+    return cfg;
+}
+
+void report(benchmark::State& state, Latencies& lat, const vol::stream::Stats& s) {
+    state.SetItemsProcessed(static_cast<int64_t>(s.submitted));
+    state.counters["fits"] = benchmark::Counter(static_cast<double>(s.fits), benchmark::Counter::kAvgIterations);
+    state.counters["ticks_per_fit"] = s.fits ? static_cast<double>(lat.ticks) / static_cast<double>(s.fits) : 0.0;
+    state.counters["p50_us"] = lat.percentile(0.5);
+    state.counters["p99_us"] = lat.percentile(0.99);
+}
+
+} // namespace
+
+// Flood: producers submit as fast as the ingest ring takes them (backpressure blocks).
+// arg0 = min refit interval (us), arg1 = producer threads
+static void BM_Pipeline_Replay(benchmark::State& state) {
+    const auto& ticks = tape();
+    Latencies lat;
+    vol::stream::Pipeline pipe(config(lat, static_cast<int>(state.range(0))));
+    const int producers = static_cast<int>(state.range(1));
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (std::size_t i = static_cast<std::size_t>(p); i < ticks.size(); i += producers) {
+                    vol::stream::Quote q = ticks[i];
+                    q.t_ns = vol::stream::now_ns();
+                    pipe.submit(q);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        pipe.flush();
+    }
+    report(state, lat, pipe.stats());
+    state.counters["blocked_submits"] = static_cast<double>(pipe.stats().blocked_submits);
+}
+BENCHMARK(BM_Pipeline_Replay)
+    ->ArgsProduct({{0, 1000, 10000}, {1, 2}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Paced: one producer at a fixed tick rate, so latency is not dominated by queueing.
+// arg0 = ticks per second, min refit interval 1 ms
+static void BM_Pipeline_Paced(benchmark::State& state) {
+    const auto& ticks = tape();
+    const std::size_t n = 5000;
+    const auto gap = std::chrono::nanoseconds(1000000000 / state.range(0));
+    Latencies lat;
+    vol::stream::Pipeline pipe(config(lat, 1000));
+    for (auto _ : state) {
+        auto next = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < n; ++i) {
+            while (std::chrono::steady_clock::now() < next) std::this_thread::yield();
+            vol::stream::Quote q = ticks[i];
+            q.t_ns = vol::stream::now_ns();
+            pipe.submit(q);
+            next += gap;
+        }
+        pipe.flush();
+    }
+    report(state, lat, pipe.stats());
+}
+BENCHMARK(BM_Pipeline_Paced)->Arg(20000)->Arg(100000)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
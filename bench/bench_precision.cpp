@@ -0,0 +1,177 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "libvol/mc/gbm.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/black_scholes_fp.hpp"
+#include "libvol/models/svi.hpp"
+
+namespace {
+
+constexpr std::size_t N = 4096;
+
+// Random screening book: S = 100, K 60..160, T 1W..3Y, vol 10%..80%
+template <class Real>
+struct Book {
+    std::vector<Real> S, K, r, q, T, vol;
+    std::vector<std::uint8_t> is_call;
+};
+
+template <class Real>
+Book<Real> make_book() {
+    std::mt19937_64 rng(11);
+    std::uniform_real_distribution<double> U(0.0, 1.0);
+    Book<Real> b;
+    for (std::size_t i = 0; i < N; ++i) {
+        b.S.push_back(Real(100));
+        b.K.push_back(static_cast<Real>(60.0 + 100.0 * U(rng)));
+        b.r.push_back(Real(0.03));
+        b.q.push_back(Real(0.01));
+        b.T.push_back(static_cast<Real>(1.0 / 52.0 + 3.0 * U(rng)));
+        b.vol.push_back(static_cast<Real>(0.1 + 0.7 * U(rng)));
+        b.is_call.push_back(static_cast<std::uint8_t>(i % 2));
+    }
+    return b;
+}
+
+template <class Real>
+const char* label() {
+    return sizeof(Real) == 4 ? "float" : "double";
+}
+
+} // namespace
+
+template <class Real>
+static void BM_BS_PriceBatch(benchmark::State& state) {
+    const auto b = make_book<Real>();
+    std::vector<Real> out(N);
+    for (auto _ : state) {
+        vol::bs::fp::price_batch<Real>(b.S.data(), b.K.data(), b.r.data(), b.q.data(), b.T.data(), b.vol.data(),
+                                       b.is_call.data(), N, out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    double err = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+        const double ref = vol::bs::price(b.S[i], b.K[i], b.r[i], b.q[i], b.T[i], b.vol[i], b.is_call[i] != 0);
+        err = std::max(err, std::abs(static_cast<double>(out[i]) - ref));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.counters["max_abs_err"] = err;
+    state.SetLabel(label<Real>());
+}
+BENCHMARK_TEMPLATE(BM_BS_PriceBatch, float);
+BENCHMARK_TEMPLATE(BM_BS_PriceBatch, double);
+
+template <class Real>
+static void BM_BS_GreeksBatch(benchmark::State& state) {
+    const auto b = make_book<Real>();
+    std::vector<Real> p(N), d(N), g(N), v(N), th(N), rh(N);
+    for (auto _ : state) {
+        vol::bs::fp::price_greeks_batch<Real>(b.S.data(), b.K.data(), b.r.data(), b.q.data(), b.T.data(),
+                                              b.vol.data(), b.is_call.data(), N,
+                                              {p.data(), d.data(), g.data(), v.data(), th.data(), rh.data()});
+        benchmark::DoNotOptimize(p.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.SetLabel(label<Real>());
+}
+BENCHMARK_TEMPLATE(BM_BS_GreeksBatch, float);
+BENCHMARK_TEMPLATE(BM_BS_GreeksBatch, double);
+
+// Per-quote scalar baseline (bs::price_greeks in a loop)
+static void BM_BS_GreeksScalar(benchmark::State& state) {
+    const auto b = make_book<double>();
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < N; ++i) {
+            sum += vol::bs::price_greeks(b.S[i], b.K[i], b.r[i], b.q[i], b.T[i], b.vol[i], b.is_call[i] != 0).delta;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+BENCHMARK(BM_BS_GreeksScalar);
+
+template <class Real>
+static void BM_SVI_TotalVarianceBatch(benchmark::State& state) {
+    const vol::svi::Params p{0.02, 0.4, -0.4, 0.05, 0.2};
+    std::vector<Real> k(N), w(N);
+    for (std::size_t i = 0; i < N; ++i) k[i] = static_cast<Real>(-2.0 + 4.0 * static_cast<double>(i) / N);
+    for (auto _ : state) {
+        vol::svi::total_variance_batch<Real>(k.data(), N, p, w.data());
+        benchmark::DoNotOptimize(w.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.SetLabel(label<Real>());
+}
+BENCHMARK_TEMPLATE(BM_SVI_TotalVarianceBatch, float);
+BENCHMARK_TEMPLATE(BM_SVI_TotalVarianceBatch, double);
+
+template <class Real>
+static void BM_MC_GBM_Precision(benchmark::State& state) {
+    vol::mc::MCResult res{};
+    for (auto _ : state) {
+        res = vol::mc::european_vanilla_gbm_fp<Real>(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true, 100000, 42);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * 100000);
+    state.counters["abs_err"] = std::abs(res.price - vol::bs::price(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true));
+    state.counters["std_err"] = res.std_err;
+    state.SetLabel(label<Real>());
+}
+BENCHMARK_TEMPLATE(BM_MC_GBM_Precision, float);
+BENCHMARK_TEMPLATE(BM_MC_GBM_Precision, double);
+
+// IV over the book: double solver per quote vs mixed float/double batch
+static void BM_IV_Double(benchmark::State& state) {
+    const auto b = make_book<double>();
+    std::vector<double> prices(N);
+    vol::bs::fp::price_batch<double>(b.S.data(), b.K.data(), b.r.data(), b.q.data(), b.T.data(), b.vol.data(),
+                                     b.is_call.data(), N, prices.data());
+    std::vector<vol::bs::IVResult> out(N);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = vol::bs::implied_vol(b.S[i], b.K[i], b.r[i], b.q[i], b.T[i], prices[i], b.is_call[i] != 0);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+BENCHMARK(BM_IV_Double);
+
+static void BM_IV_Mixed(benchmark::State& state) {
+    const auto b = make_book<double>();
+    std::vector<double> prices(N);
+    vol::bs::fp::price_batch<double>(b.S.data(), b.K.data(), b.r.data(), b.q.data(), b.T.data(), b.vol.data(),
+                                     b.is_call.data(), N, prices.data());
+    std::vector<vol::bs::IVResult> out(N);
+    for (auto _ : state) {
+        vol::bs::fp::implied_vol_mixed(b.S.data(), b.K.data(), b.r.data(), b.q.data(), b.T.data(), prices.data(),
+                                       b.is_call.data(), N, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    // vol error over quotes where the price pins the vol down (vega > 0.1)
+    double err = 0.0;
+    std::size_t fallbacks = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        fallbacks += out[i].newton_iters != 2 || out[i].brent_iters != 0;
+        const bool call = b.is_call[i] != 0;
+        if (vol::bs::price_greeks(b.S[i], b.K[i], b.r[i], b.q[i], b.T[i], b.vol[i], call).vega > 0.1) {
+            err = std::max(err, std::abs(out[i].iv - b.vol[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.counters["max_abs_err"] = err;
+    state.counters["fallbacks"] = static_cast<double>(fallbacks);
+}
+BENCHMARK(BM_IV_Mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "libvol/io/shm_surface.hpp"
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Shared-memory surfaces: single-process read/publish cost, and cross-process publish ->
+// visible latency with the writer in a forked child. Items = surfaces read or published.
+
+#if !defined(_WIN32)
+
+namespace {
+
+constexpr std::uint32_t UNDERLYINGS = 16;
+constexpr std::uint32_t SLICES = 32;
+
+std::string segment_name(const char* tag) {
+    return "/libvol_bench_" + std::string(tag) + "_" + std::to_string(::getpid());
+}
+
+std::vector<vol::io::ShmSlice> surface(double level, std::size_t n) {
+    std::vector<vol::io::ShmSlice> s(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double T = 0.25 * static_cast<double>(i + 1);
+        s[i] = {T, 100.0, 0.99, {0.02 * level * T, 0.1, -0.4, 0.0, 0.2}};
+    }
+    return s;
+}
+
+std::uint64_t steady_ns() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+} // namespace
+
+// arg0 = slices per surface
+static void BM_Shm_Read(benchmark::State& state) {
+    const std::string name = segment_name("read");
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto writer = vol::io::ShmSurfaceWriter::create(name, UNDERLYINGS, SLICES);
+    for (std::uint32_t u = 0; u < UNDERLYINGS; ++u) writer.publish(u, surface(1.0, n));
+    auto reader = vol::io::ShmSurfaceReader::attach(name);
+    std::vector<vol::io::ShmSlice> buf(SLICES);
+    std::uint32_t u = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.read(u, buf));
+        u = (u + 1) % UNDERLYINGS;
+    }
+    state.SetItemsProcessed(state.iterations());
+    vol::io::ShmSurfaceWriter::remove(name);
+}
+BENCHMARK(BM_Shm_Read)->Arg(8)->Arg(32);
+
+static void BM_Shm_Publish(benchmark::State& state) {
+    const std::string name = segment_name("publish");
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto writer = vol::io::ShmSurfaceWriter::create(name, UNDERLYINGS, SLICES);
+    const auto s = surface(1.0, n);
+    std::uint32_t u = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(writer.publish(u, s));
+        u = (u + 1) % UNDERLYINGS;
+    }
+    state.SetItemsProcessed(state.iterations());
+    vol::io::ShmSurfaceWriter::remove(name);
+}
+BENCHMARK(BM_Shm_Publish)->Arg(8)->Arg(32);
+
+static void BM_Shm_VersionCheck(benchmark::State& state) {
+    const std::string name = segment_name("version");
+    auto writer = vol::io::ShmSurfaceWriter::create(name, UNDERLYINGS, SLICES);
+    writer.publish(3, surface(1.0, 8));
+    auto reader = vol::io::ShmSurfaceReader::attach(name);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.version(3));
+    }
+    vol::io::ShmSurfaceWriter::remove(name);
+}
+BENCHMARK(BM_Shm_VersionCheck);
+
+// A child process republishes one underlying every ~50us; this process polls version() and,
+// on each change, reads the surface and records now - published_ns. Both stamps come from the
+// same monotonic clock, so the difference is the cross-process visibility latency.
+static void BM_Shm_CrossProcessLatency(benchmark::State& state) {
+    const std::string name = segment_name("latency");
+    constexpr int PUBLISHES = 2000;
+    auto writer = vol::io::ShmSurfaceWriter::create(name, 1, SLICES);
+    auto reader = vol::io::ShmSurfaceReader::attach(name);
+    std::vector<vol::io::ShmSlice> buf(SLICES);
+    std::vector<double> lat_us;
+
+    for (auto _ : state) {
+        const std::uint64_t start = reader.version(0);
+        const pid_t pid = ::fork();
+        if (pid == 0) {
+            const auto s = surface(1.0, 8);
+            for (int i = 0; i < PUBLISHES; ++i) {
+                writer.publish(0, s);
+                ::usleep(50);
+            }
+            ::_exit(0);
+        }
+        std::uint64_t seen = start;
+        while (seen < start + PUBLISHES) {
+            if (reader.version(0) == seen) {
+                ::sched_yield();
+                continue;
+            }
+            const auto r = reader.read(0, buf);
+            lat_us.push_back(static_cast<double>(steady_ns() - r.published_ns) * 1e-3);
+            seen = r.version;
+        }
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+    }
+    vol::io::ShmSurfaceWriter::remove(name);
+
+    std::sort(lat_us.begin(), lat_us.end());
+    const auto pct = [&](double q) { return lat_us[static_cast<std::size_t>(q * static_cast<double>(lat_us.size() - 1))]; };
+    state.counters["p50_us"] = pct(0.50);
+    state.counters["p99_us"] = pct(0.99);
+    state.counters["observed"] = static_cast<double>(lat_us.size());
+}
+BENCHMARK(BM_Shm_CrossProcessLatency)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+#endif
+
+BENCHMARK_MAIN();
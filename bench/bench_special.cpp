@@ -0,0 +1,173 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "libvol/math/special.hpp"
+#include "libvol/mc/gbm.hpp"
+
+namespace {
+
+using vol::math::Accuracy;
+
+constexpr std::size_t N = 4096;
+
+const char* tier_name(Accuracy acc) {
+    switch (acc) {
+    case Accuracy::High: return "high";
+    case Accuracy::Fast: return "fast";
+    case Accuracy::Full: break;
+    }
+    return "full";
+}
+
+Accuracy tier(const benchmark::State& state) {
+    return static_cast<Accuracy>(state.range(0));
+}
+
+// d1/d2-like arguments, and probabilities spanning both tails
+std::vector<double> cdf_args() {
+    std::vector<double> x(N);
+    for (std::size_t i = 0; i < N; ++i) x[i] = -8.0 + 16.0 * static_cast<double>(i) / N;
+    return x;
+}
+
+std::vector<double> inv_args() {
+    std::mt19937_64 rng(7);
+    std::vector<double> p(N);
+    for (double& v : p) v = (static_cast<double>(rng() >> 11) + 0.5) * 0x1.0p-53;
+    return p;
+}
+
+} // namespace
+
+// Scalar calls; arg = Accuracy. max_abs_err against the Full tier.
+static void BM_NormCdf_Scalar(benchmark::State& state) {
+    const Accuracy acc = tier(state);
+    const auto x = cdf_args();
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (double v : x) sum += vol::math::norm_cdf(v, acc);
+        benchmark::DoNotOptimize(sum);
+    }
+    double err = 0.0;
+    for (double v : x) err = std::max(err, std::abs(vol::math::norm_cdf(v, acc) - vol::math::norm_cdf(v)));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.counters["max_abs_err"] = err;
+    state.SetLabel(tier_name(acc));
+}
+BENCHMARK(BM_NormCdf_Scalar)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_NormCdf_Batch(benchmark::State& state) {
+    const Accuracy acc = tier(state);
+    const auto x = cdf_args();
+    std::vector<double> out(N);
+    for (auto _ : state) {
+        vol::math::norm_cdf(x, out, acc);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.SetLabel(tier_name(acc));
+}
+BENCHMARK(BM_NormCdf_Batch)->Arg(0)->Arg(1)->Arg(2);
+
+// max_rel_err of x against the Full tier
+static void BM_NormInvCdf_Scalar(benchmark::State& state) {
+    const Accuracy acc = tier(state);
+    const auto p = inv_args();
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (double v : p) sum += vol::math::norm_inv_cdf(v, acc);
+        benchmark::DoNotOptimize(sum);
+    }
+    double err = 0.0;
+    for (double v : p) {
+        const double ref = vol::math::norm_inv_cdf(v);
+        err = std::max(err, std::abs(vol::math::norm_inv_cdf(v, acc) - ref) / std::max(std::abs(ref), 1e-300));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.counters["max_rel_err"] = err;
+    state.SetLabel(tier_name(acc));
+}
+BENCHMARK(BM_NormInvCdf_Scalar)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_NormInvCdf_Batch(benchmark::State& state) {
+    const Accuracy acc = tier(state);
+    const auto p = inv_args();
+    std::vector<double> out(N);
+    for (auto _ : state) {
+        vol::math::norm_inv_cdf(p, out, acc);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+    state.SetLabel(tier_name(acc));
+}
+BENCHMARK(BM_NormInvCdf_Batch)->Arg(0)->Arg(1)->Arg(2);
+
+// std::normal_distribution baseline for normal generation
+static void BM_Normals_StdLib(benchmark::State& state) {
+    std::mt19937_64 rng(7);
+    std::normal_distribution<double> Z(0.0, 1.0);
+    std::vector<double> out(N);
+    for (auto _ : state) {
+        for (double& z : out) z = Z(rng);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(N));
+}
+BENCHMARK(BM_Normals_StdLib);
+
+// BS strip (70..130 strikes) with the formula's two CDFs at each tier (bs::price itself stays
+// on Full); max_abs_err against Full
+static double bs_price_tier(double K, bool is_call, Accuracy acc) {
+    const double S = 100.0, r = 0.02, q = 0.01, T = 0.5, vol = 0.25;
+    const double sqT = std::sqrt(T);
+    const double d1 = (std::log(S / K) + (r - q + 0.5 * vol * vol) * T) / (vol * sqT);
+    const double d2 = d1 - vol * sqT;
+    const double sgn = is_call ? 1.0 : -1.0;
+    return sgn * (S * std::exp(-q * T) * vol::math::norm_cdf(sgn * d1, acc) -
+                  K * std::exp(-r * T) * vol::math::norm_cdf(sgn * d2, acc));
+}
+
+static void BM_BS_Price_Tier(benchmark::State& state) {
+    const Accuracy acc = tier(state);
+    std::vector<double> strikes;
+    for (int i = 0; i < 61; ++i) strikes.push_back(70.0 + i);
+    auto strip = [&] {
+        double sum = 0.0;
+        for (double K : strikes) sum += bs_price_tier(K, K >= 100.0, acc);
+        return sum;
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(strip());
+    }
+    double err = 0.0;
+    for (double K : strikes) {
+        err = std::max(err, std::abs(bs_price_tier(K, K >= 100.0, acc) - bs_price_tier(K, K >= 100.0, Accuracy::Full)));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(strikes.size()));
+    state.counters["max_abs_err"] = err;
+    state.SetLabel(tier_name(acc));
+}
+BENCHMARK(BM_BS_Price_Tier)->Arg(0)->Arg(1)->Arg(2);
+
+// GBM Monte Carlo end to end: arg0 = NormalGen, arg1 = Accuracy
+static void BM_MC_GBM_NormalGen(benchmark::State& state) {
+    const auto gen = static_cast<vol::mc::NormalGen>(state.range(0));
+    const Accuracy acc = static_cast<Accuracy>(state.range(1));
+    for (auto _ : state) {
+        const auto res = vol::mc::european_vanilla_gbm(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true, 100000, 42, gen, acc);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * 100000);
+    state.SetLabel(gen == vol::mc::NormalGen::StdLib ? "stdlib" : tier_name(acc));
+}
+BENCHMARK(BM_MC_GBM_NormalGen)->Args({0, 0})->Args({1, 0})->Args({1, 1})->Args({1, 2});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/io/surface_file.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Service restart: 500 underlyings x 30 expiries of calibrated SVI slices. Loading the
+// saved surfaces (BM_SurfaceFile_Load) is timed on the full set; the per-slice refit that
+// follows is timed on a sample, cold (BM_Startup_Cold) against a warm start from the file
+// (BM_Startup_Warm), with est_500x30_s extrapolating to the whole book.
+
+namespace {
+
+constexpr int N_UNDERLYINGS = 500;
+constexpr int N_EXPIRIES = 30;
+constexpr int N_STRIKES = 25;
+constexpr int SAMPLE_UNDERLYINGS = 4;   // refit benches: 4 x 30 slices
+
+double expiry(int e) {
+    return 0.02 + 0.1 * e;
+}
+
+// Yesterday's smile for (u, e); today's quotes come from a slightly shifted one
+vol::svi::Params smile(int u, int e, double shift) {
+    const double T = expiry(e);
+    return {0.01 + 0.02 * T + 0.002 * shift, 0.12 + 0.0001 * (u % 50), -0.3 + 0.01 * shift, -0.02, 0.2};
+}
+
+struct Slice {
+    double T, forward, discount;
+    std::vector<double> K, mid;
+    std::vector<std::uint8_t> call;
+
+    vol::svi::SliceQuotes view() const { return {T, forward, discount, K, mid, call}; }
+};
+
+Slice quotes(int u, int e, double shift) {
+    const double S = 50.0 + u % 200, r = 0.02, T = expiry(e);
+    Slice s{T, S * std::exp(r * T), std::exp(-r * T), {}, {}, {}};
+    const auto p = smile(u, e, shift);
+    for (int i = 0; i < N_STRIKES; ++i) {
+        const double k = -0.5 + 1.0 * i / (N_STRIKES - 1);
+        const double K = s.forward * std::exp(k);
+        const bool is_call = k >= 0.0;
+        s.K.push_back(K);
+        s.mid.push_back(vol::bs::price(S, K, r, 0.0, T, std::sqrt(vol::svi::total_variance(k, p) / T), is_call));
+        s.call.push_back(is_call ? 1 : 0);
+    }
+    return s;
+}
+
+// Saved file: the sample underlyings carry real warm fits of yesterday's quotes, the rest
+// of the book synthetic params with the same record layout
+const std::string& surface_path() {
+    static const std::string path = [] {
+        const auto p = (std::filesystem::temp_directory_path() / "libvol_bench_surfaces.bin").string();
+        vol::io::SurfaceFileWriter writer;
+        for (int u = 0; u < N_UNDERLYINGS; ++u) {
+            for (int e = 0; e < N_EXPIRIES; ++e) {
+                const Slice s = quotes(u, e, 0.0);
+                vol::svi::FitResult fit{smile(u, e, 0.0), 0.0, 0, N_STRIKES, true};
+                if (u < SAMPLE_UNDERLYINGS) {
+                    vol::svi::SliceConfig cfg;
+                    cfg.warm_start = fit.params;
+                    fit = vol::svi::calibrate_slice_report(s.view(), cfg);
+                }
+                writer.add(static_cast<std::uint32_t>(u), s.T, s.forward, s.discount, fit);
+            }
+        }
+        writer.write(p);
+        return p;
+    }();
+    return path;
+}
+
+const std::vector<Slice>& today() {
+    static const std::vector<Slice> v = [] {
+        std::vector<Slice> out;
+        for (int u = 0; u < SAMPLE_UNDERLYINGS; ++u) {
+            for (int e = 0; e < N_EXPIRIES; ++e) out.push_back(quotes(u, e, 1.0));
+        }
+        return out;
+    }();
+    return v;
+}
+
+void extrapolate(benchmark::State& state, std::size_t slices) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * slices));
+    state.counters["est_500x30_s"] = benchmark::Counter(
+        static_cast<double>(slices * state.iterations()) / static_cast<double>(N_UNDERLYINGS * N_EXPIRIES),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+} // namespace
+
+static void BM_SurfaceFile_Write(benchmark::State& state) {
+    const auto file = vol::io::SurfaceFile::open(surface_path());
+    vol::io::SurfaceFileWriter writer;
+    for (const auto& r : file.records()) writer.add(r);
+    const auto out = (std::filesystem::temp_directory_path() / "libvol_bench_surfaces_w.bin").string();
+    for (auto _ : state) {
+        writer.write(out);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * writer.records()));
+    std::filesystem::remove(out);
+}
+BENCHMARK(BM_SurfaceFile_Write)->Unit(benchmark::kMillisecond);
+
+// arg0: 1 = verify checksum. Touches every record, as seeding the refits would.
+static void BM_SurfaceFile_Load(benchmark::State& state) {
+    const std::string& path = surface_path();
+    double acc = 0.0;
+    for (auto _ : state) {
+        const auto file = vol::io::SurfaceFile::open(path, state.range(0) != 0);
+        for (const auto& r : file.records()) acc += r.params[0];
+    }
+    benchmark::DoNotOptimize(acc);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * N_UNDERLYINGS * N_EXPIRIES));
+}
+BENCHMARK(BM_SurfaceFile_Load)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_Startup_Cold(benchmark::State& state) {
+    const auto& slices = today();
+    double rmse = 0.0;
+    for (auto _ : state) {
+        rmse = 0.0;
+        for (const auto& s : slices) rmse += vol::svi::calibrate_slice_report(s.view()).rmse;
+    }
+    extrapolate(state, slices.size());
+    state.counters["mean_rmse"] = rmse / static_cast<double>(slices.size());
+}
+BENCHMARK(BM_Startup_Cold)->Unit(benchmark::kMillisecond);
+
+static void BM_Startup_Warm(benchmark::State& state) {
+    const auto& slices = today();
+    const std::string& path = surface_path();
+    double rmse = 0.0;
+    for (auto _ : state) {
+        rmse = 0.0;
+        const auto file = vol::io::SurfaceFile::open(path);
+        vol::svi::SliceConfig cfg;
+        std::size_t i = 0;
+        for (std::uint32_t u = 0; u < SAMPLE_UNDERLYINGS; ++u) {
+            for (const auto& rec : file.underlying(u)) {
+                cfg.warm_start = rec.params;
+                rmse += vol::svi::calibrate_slice_report(slices[i++].view(), cfg).rmse;
+            }
+        }
+    }
+    extrapolate(state, slices.size());
+    state.counters["mean_rmse"] = rmse / static_cast<double>(slices.size());
+}
+BENCHMARK(BM_Startup_Warm)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "libvol/models/svi.hpp"
+#include "libvol/stream/surface_store.hpp"
+
+// Readers price off a calibrated surface while one thread republishes it. Thread 0 is the
+// writer when arg0 = 1, every other thread is a reader; items = surface reads (one w(k, T)
+// each). RCU store against the global-mutex scheme it replaces.
+
+namespace {
+
+constexpr std::uint32_t UNDERLYINGS = 16;
+
+std::vector<vol::stream::SurfaceSlice> surface(double level) {
+    std::vector<vol::stream::SurfaceSlice> s;
+    for (int i = 1; i <= 8; ++i) s.push_back({0.25 * i, {0.02 * level * i, 0.1, -0.4, 0.0, 0.2}});
+    return s;
+}
+
+// The baseline: one mutex around a plain vector of surfaces
+struct MutexStore {
+    std::mutex m;
+    std::vector<vol::stream::Surface> surfaces{UNDERLYINGS};
+
+    void publish(std::uint32_t u, std::vector<vol::stream::SurfaceSlice> slices) {
+        std::lock_guard<std::mutex> lock(m);
+        surfaces[u].slices = std::move(slices);
+        ++surfaces[u].version;
+    }
+    double read(std::uint32_t u, double k, double T) {
+        std::lock_guard<std::mutex> lock(m);
+        return surfaces[u].total_variance(k, T);
+    }
+};
+
+// Built in Setup (before any benchmark thread starts), torn down after all have joined
+vol::stream::SurfaceStore* rcu = nullptr;
+MutexStore* locked = nullptr;
+
+void setup_rcu(const benchmark::State&) {
+    rcu = new vol::stream::SurfaceStore(UNDERLYINGS, 64);
+    for (std::uint32_t u = 0; u < UNDERLYINGS; ++u) rcu->publish(u, surface(1.0));
+}
+void teardown_rcu(const benchmark::State&) {
+    delete rcu;
+    rcu = nullptr;
+}
+void setup_mutex(const benchmark::State&) {
+    locked = new MutexStore;
+    for (std::uint32_t u = 0; u < UNDERLYINGS; ++u) locked->publish(u, surface(1.0));
+}
+void teardown_mutex(const benchmark::State&) {
+    delete locked;
+    locked = nullptr;
+}
+
+} // namespace
+
+static void BM_SurfaceStore_RCU(benchmark::State& state) {
+    vol::stream::SurfaceStore* store = rcu;
+    const bool writer = state.range(0) != 0 && state.thread_index() == 0;
+    std::uint64_t n = 0;
+    double acc = 0.0;
+    if (writer) {
+        for (auto _ : state) {
+            store->publish(static_cast<std::uint32_t>(n % UNDERLYINGS), surface(1.0 + 1e-6 * static_cast<double>(n)));
+            ++n;
+        }
+        state.counters["publishes"] = benchmark::Counter(static_cast<double>(n), benchmark::Counter::kIsRate);
+    } else {
+        auto reader = store->reader();
+        for (auto _ : state) {
+            const std::uint32_t u = static_cast<std::uint32_t>(n % UNDERLYINGS);
+            const auto s = reader.read(u);
+            acc += s->total_variance(0.05, 0.8);
+            ++n;
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(n));
+    }
+    benchmark::DoNotOptimize(acc);
+}
+
+static void BM_SurfaceStore_Mutex(benchmark::State& state) {
+    MutexStore* store = locked;
+    const bool writer = state.range(0) != 0 && state.thread_index() == 0;
+    std::uint64_t n = 0;
+    double acc = 0.0;
+    if (writer) {
+        for (auto _ : state) {
+            store->publish(static_cast<std::uint32_t>(n % UNDERLYINGS), surface(1.0 + 1e-6 * static_cast<double>(n)));
+            ++n;
+        }
+        state.counters["publishes"] = benchmark::Counter(static_cast<double>(n), benchmark::Counter::kIsRate);
+    } else {
+        for (auto _ : state) {
+            acc += store->read(static_cast<std::uint32_t>(n % UNDERLYINGS), 0.05, 0.8);
+            ++n;
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(n));
+    }
+    benchmark::DoNotOptimize(acc);
+}
+
+// arg0: 0 = readers only, 1 = thread 0 republishes continuously
+BENCHMARK(BM_SurfaceStore_RCU)
+    ->Arg(0)->Arg(1)->ThreadRange(2, 8)->Setup(setup_rcu)->Teardown(teardown_rcu)->UseRealTime();
+BENCHMARK(BM_SurfaceStore_Mutex)
+    ->Arg(0)->Arg(1)->ThreadRange(2, 8)->Setup(setup_mutex)->Teardown(teardown_mutex)->UseRealTime();
+
+// Staleness check a pricer does before reusing cached surface-derived state
+static void BM_SurfaceStore_VersionCheck(benchmark::State& state) {
+    vol::stream::SurfaceStore store(UNDERLYINGS);
+    store.publish(3, surface(1.0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(store.version(3));
+    }
+}
+BENCHMARK(BM_SurfaceStore_VersionCheck);
+
+BENCHMARK_MAIN();
@@ -4,6 +4,7 @@
 #include "libvol/models/svi.hpp"
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 using vol::OptionSpec;
@@ -84,6 +85,21 @@ static void BM_SVI_Calibrate_Clean(benchmark::State& state) {
 }
 BENCHMARK(BM_SVI_Calibrate_Clean);
 
+// Same slice through the precomputed-chain overload
+static void BM_SVI_Calibrate_Clean_Chain(benchmark::State& state) {
+    const auto cfg = vol::svi::SliceConfig{};
+    std::vector<double> strikes;
+    for (const auto& o : k_clean_slice.options) strikes.push_back(o.K);
+    const std::vector<std::uint8_t> calls(strikes.size(), 1);
+    const auto& o = k_clean_slice.options.front();
+    const auto chain = vol::make_chain(vol::make_expiry(o.S, o.r, o.q, o.T), strikes, calls);
+    for (auto _ : state) {
+        auto params = vol::svi::calibrate_slice(chain, k_clean_slice.mids, cfg);
+        benchmark::DoNotOptimize(params);
+    }
+}
+BENCHMARK(BM_SVI_Calibrate_Clean_Chain);
+
 static void BM_SVI_Calibrate_Noisy(benchmark::State& state) {
     auto cfg = vol::svi::SliceConfig{};
     cfg.use_vega_weights = false; // stress alternate weighting
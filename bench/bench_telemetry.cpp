@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include "libvol/util/telemetry.hpp"
+
+// Cost of the telemetry layer. BM_Telemetry_* time the primitives directly; the
+// BM_Instrumented_* pair runs instrumented library paths and is meant to be compared
+// between a default build and one configured with -DVOL_TELEMETRY=ON (compiled_in = 1).
+
+namespace tel = vol::telemetry;
+
+namespace {
+
+struct Chain {
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+};
+
+// 64 strikes, T = 0.5, SVI smile; deep wings exercise bracket expansion and Brent
+const Chain& chain() {
+    static const Chain c = [] {
+        Chain out;
+        const vol::svi::Params p{0.02, 0.15, -0.3, 0.0, 0.2};
+        const double S = 100.0, T = 0.5;
+        for (int i = 0; i < 64; ++i) {
+            const double k = -1.2 + 2.4 * i / 63.0;
+            const double K = S * std::exp(k);
+            const bool call = k >= 0.0;
+            out.opts.push_back({S, K, 0.0, 0.0, T, call});
+            out.mids.push_back(vol::bs::price(S, K, 0.0, 0.0, T, std::sqrt(vol::svi::total_variance(k, p) / T), call));
+        }
+        return out;
+    }();
+    return c;
+}
+
+} // namespace
+
+static void BM_Telemetry_Count(benchmark::State& state) {
+    for (auto _ : state) {
+        tel::add(tel::Counter::IvSolves);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Telemetry_Count);
+
+static void BM_Telemetry_Record(benchmark::State& state) {
+    std::uint64_t v = 1;
+    for (auto _ : state) {
+        tel::record(tel::Stage::PipelineFit, v);
+        v = (v * 13) & 0xFFFFF;
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Telemetry_Record);
+
+static void BM_Telemetry_ScopedTimer(benchmark::State& state) {
+    for (auto _ : state) {
+        tel::ScopedTimer t(tel::Stage::PipelinePublish);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Telemetry_ScopedTimer);
+
+static void BM_Telemetry_Snapshot(benchmark::State& state) {
+    tel::add(tel::Counter::IvSolves);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tel::snapshot());
+    }
+}
+BENCHMARK(BM_Telemetry_Snapshot);
+
+// items = implied vols
+static void BM_Instrumented_ImpliedVol(benchmark::State& state) {
+    const Chain& c = chain();
+    double acc = 0.0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < c.opts.size(); ++i) {
+            const auto& o = c.opts[i];
+            acc += vol::bs::implied_vol(o.S, o.K, o.r, o.q, o.T, c.mids[i], o.is_call).iv;
+        }
+    }
+    benchmark::DoNotOptimize(acc);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.opts.size()));
+    state.counters["compiled_in"] = tel::compiled_in() ? 1.0 : 0.0;
+}
+BENCHMARK(BM_Instrumented_ImpliedVol);
+
+static void BM_Instrumented_SliceFit(benchmark::State& state) {
+    const Chain& c = chain();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vol::svi::calibrate_slice_from_prices(c.opts, c.mids));
+    }
+    state.counters["compiled_in"] = tel::compiled_in() ? 1.0 : 0.0;
+}
+BENCHMARK(BM_Instrumented_SliceFit)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+"""Per-call vs batch throughput of the volpy NumPy entry points.
+
+Run from the build directory (or with it on PYTHONPATH):
+    python bench/bench_volpy_batch.py [n_quotes] [n_threads]
+"""
+import os
+import sys
+import time
+
+import numpy as np
+import volpy as vp
+
+
+def timed(fn, repeat=3):
+    best = float("inf")
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        fn()
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+def report(name, n, seconds, ref=None):
+    rate = n / seconds
+    speedup = "" if ref is None else f"  ({ref / seconds:6.1f}x)"
+    print(f"{name:<34} {seconds * 1e3:9.2f} ms  {rate / 1e6:8.3f} M/s{speedup}")
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 1_000_000
+    n_threads = int(sys.argv[2]) if len(sys.argv) > 2 else (os.cpu_count() or 1)
+    rng = np.random.default_rng(42)
+
+    S = np.full(n, 100.0)
+    K = rng.uniform(60.0, 140.0, n)
+    r = np.full(n, 0.02)
+    q = np.full(n, 0.01)
+    T = rng.uniform(0.05, 2.0, n)
+    vol = rng.uniform(0.1, 0.6, n)
+    is_call = K >= S
+    out = np.empty(n)
+
+    print(f"n = {n}, threads = {n_threads}")
+
+    # --- Black-Scholes ---
+    n_loop = min(n, 200_000)  # the per-call loop is slow; time a prefix and scale
+    args = list(zip(S[:n_loop].tolist(), K[:n_loop].tolist(), r[:n_loop].tolist(), q[:n_loop].tolist(),
+                    T[:n_loop].tolist(), vol[:n_loop].tolist(), is_call[:n_loop].tolist()))
+    t_loop = timed(lambda: [vp.bs_price(*a) for a in args], repeat=1) * n / n_loop
+    report("bs_price (per-call loop)", n, t_loop)
+    report("bs_price_batch", n, timed(lambda: vp.bs_price_batch(S, K, r, q, T, vol, is_call, out=out)), t_loop)
+    report(f"bs_price_batch ({n_threads} threads)", n,
+           timed(lambda: vp.bs_price_batch(S, K, r, q, T, vol, is_call, out=out, n_threads=n_threads)), t_loop)
+
+    # --- Implied vol (round trip from the batch prices) ---
+    prices = vp.bs_price_batch(S, K, r, q, T, vol, is_call)
+    iv_args = [a[:5] + (p, a[6]) for a, p in zip(args, prices[:n_loop].tolist())]
+    t_loop = timed(lambda: [vp.implied_vol(*a) for a in iv_args], repeat=1) * n / n_loop
+    report("implied_vol (per-call loop)", n, t_loop)
+    report("implied_vol_batch", n, timed(lambda: vp.implied_vol_batch(S, K, r, q, T, prices, is_call, out=out)), t_loop)
+    report(f"implied_vol_batch ({n_threads} threads)", n,
+           timed(lambda: vp.implied_vol_batch(S, K, r, q, T, prices, is_call, out=out, n_threads=n_threads)), t_loop)
+    iv = vp.implied_vol_batch(S, K, r, q, T, prices, is_call)
+    ok = np.isfinite(iv)
+    print(f"  iv round-trip max err {np.max(np.abs(iv[ok] - vol[ok])):.2e}, unconverged {np.count_nonzero(~ok)}")
+
+    # --- Heston (smaller chain, the pricer is ~1000x slower than BS) ---
+    m = min(n, 20_000)
+    params = vp.HestonParams(1.5, 0.04, 0.5, -0.7, 0.04)
+    Km, Tm, cm, hout = K[:m].copy(), T[:m].copy(), is_call[:m].copy(), np.empty(m)
+    h_args = list(zip(Km.tolist(), Tm.tolist(), cm.tolist()))
+    t_loop = timed(lambda: [vp.heston_price_cf(100.0, k, 0.02, 0.01, t, params, c) for k, t, c in h_args], repeat=1)
+    report("heston_price_cf (per-call loop)", m, t_loop)
+    report("heston_price_cf_batch", m,
+           timed(lambda: vp.heston_price_cf_batch(100.0, Km, 0.02, 0.01, Tm, params, cm, out=hout)), t_loop)
+    report(f"heston_price_cf_batch ({n_threads} threads)", m,
+           timed(lambda: vp.heston_price_cf_batch(100.0, Km, 0.02, 0.01, Tm, params, cm, out=hout,
+                                                  n_threads=n_threads)), t_loop)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,15 +1,64 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
+#include <pybind11/functional.h>
 #include "libvol/models/black_scholes.hpp"
 #include "libvol/mc/gbm.hpp"
+#include "libvol/math/special.hpp"
 #include "libvol/models/binom.hpp"
+#include "libvol/models/american.hpp"
+#include "libvol/models/fd.hpp"
 #include "libvol/models/heston.hpp"
 #include "libvol/models/svi.hpp"
 #include "libvol/calib/svi_slice.hpp"
 #include "libvol/core/types.hpp"
+#include "libvol/util/parallel.hpp"
+#include "libvol/util/telemetry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace py = pybind11;
 
+namespace {
+
+// Batch entry points take C-contiguous 1-D arrays of the exact dtype (bound with
+// noconvert(), so a float32 or strided array is rejected instead of silently copied),
+// read and write them in place and run with the GIL released.
+template <class T>
+using CArray = py::array_t<T, py::array::c_style>;
+
+void check_len(const py::array& a, std::size_t n, const char* name) {
+    if (a.ndim() != 1 || static_cast<std::size_t>(a.shape(0)) != n) {
+        throw std::invalid_argument(std::string(name) + ": expected a 1-D array of length " + std::to_string(n));
+    }
+}
+
+CArray<double> output_for(std::optional<CArray<double>>& out, std::size_t n) {
+    if (!out) {
+        return CArray<double>(static_cast<py::ssize_t>(n));
+    }
+    check_len(*out, n, "out");
+    if (!out->writeable()) {
+        throw std::invalid_argument("out: array is read-only");
+    }
+    return *out;
+}
+
+// Batch loops run on vol::util::parallel_for in chunks of this many quotes; callers must
+// release the GIL first
+constexpr std::size_t BATCH_GRAIN = 256;
+
+} // namespace
+
 PYBIND11_MODULE(volpy, m) {
     m.doc() = "Volatility & Derivatives pricing (MVP)";
 
@@ -43,17 +92,17 @@ PYBIND11_MODULE(volpy, m) {
 
     // --- Black-Scholes functions ---
     m.def("bs_price",
-        &vol::bs::price,
+        py::overload_cast<double,double,double,double,double,double,bool>(&vol::bs::price),
         "Black-Scholes price",
         py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
         py::arg("T"), py::arg("vol"), py::arg("is_call"));
 
     m.def("bs_price_greeks",
-        &vol::bs::price_greeks,
+        py::overload_cast<double,double,double,double,double,double,bool>(&vol::bs::price_greeks),
         "BS price + Greeks");
 
     m.def("implied_vol",
-    &vol::bs::implied_vol,
+    py::overload_cast<double,double,double,double,double,double,bool,double,double>(&vol::bs::implied_vol),
     "Robust implied vol",
     py::arg("S"),
     py::arg("K"),
@@ -66,6 +115,68 @@ PYBIND11_MODULE(volpy, m) {
     py::arg("tol")  = 1e-10);
 
 
+    // --- Normal distribution accuracy tiers ---
+    py::enum_<vol::math::Accuracy>(m, "Accuracy")
+        .value("Full", vol::math::Accuracy::Full)
+        .value("High", vol::math::Accuracy::High)
+        .value("Fast", vol::math::Accuracy::Fast);
+
+    // --- Batch (NumPy) Black-Scholes / IV ---
+    m.def("bs_price_batch",
+        [](CArray<double> S, CArray<double> K, CArray<double> r, CArray<double> q,
+           CArray<double> T, CArray<double> vol, CArray<bool> is_call,
+           std::optional<CArray<double>> out, int n_threads) {
+            const std::size_t n = static_cast<std::size_t>(K.size());
+            check_len(S, n, "S"); check_len(K, n, "K"); check_len(r, n, "r"); check_len(q, n, "q");
+            check_len(T, n, "T"); check_len(vol, n, "vol"); check_len(is_call, n, "is_call");
+            auto res = output_for(out, n);
+            const double *s = S.data(), *k = K.data(), *rr = r.data(), *qq = q.data(), *t = T.data(), *v = vol.data();
+            const bool* c = is_call.data();
+            double* o = res.mutable_data();
+            {
+                py::gil_scoped_release release;
+                vol::util::parallel_for(n, n_threads, BATCH_GRAIN, [&](std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        o[i] = vol::bs::price(s[i], k[i], rr[i], qq[i], t[i], v[i], c[i]);
+                    }
+                });
+            }
+            return res;
+        },
+        "Black-Scholes prices for arrays of quotes (float64 / bool, C-contiguous, no copies)",
+        py::arg("S").noconvert(), py::arg("K").noconvert(), py::arg("r").noconvert(),
+        py::arg("q").noconvert(), py::arg("T").noconvert(), py::arg("vol").noconvert(),
+        py::arg("is_call").noconvert(), py::arg("out").noconvert() = py::none(),
+        py::arg("n_threads") = 1);
+
+    m.def("implied_vol_batch",
+        [](CArray<double> S, CArray<double> K, CArray<double> r, CArray<double> q,
+           CArray<double> T, CArray<double> target, CArray<bool> is_call,
+           std::optional<CArray<double>> out, double init, double tol, int n_threads) {
+            const std::size_t n = static_cast<std::size_t>(K.size());
+            check_len(S, n, "S"); check_len(K, n, "K"); check_len(r, n, "r"); check_len(q, n, "q");
+            check_len(T, n, "T"); check_len(target, n, "target"); check_len(is_call, n, "is_call");
+            auto res = output_for(out, n);
+            const double *s = S.data(), *k = K.data(), *rr = r.data(), *qq = q.data(), *t = T.data(), *px = target.data();
+            const bool* c = is_call.data();
+            double* o = res.mutable_data();
+            {
+                py::gil_scoped_release release;
+                vol::util::parallel_for(n, n_threads, BATCH_GRAIN, [&](std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        const auto iv = vol::bs::implied_vol(s[i], k[i], rr[i], qq[i], t[i], px[i], c[i], init, tol);
+                        o[i] = iv.converged ? iv.iv : std::numeric_limits<double>::quiet_NaN();
+                    }
+                });
+            }
+            return res;
+        },
+        "Implied vols for arrays of quotes; NaN where the solver did not converge",
+        py::arg("S").noconvert(), py::arg("K").noconvert(), py::arg("r").noconvert(),
+        py::arg("q").noconvert(), py::arg("T").noconvert(), py::arg("target").noconvert(),
+        py::arg("is_call").noconvert(), py::arg("out").noconvert() = py::none(),
+        py::arg("init") = 0.2, py::arg("tol") = 1e-10, py::arg("n_threads") = 1);
+
     // --- Binomial functions ---
     m.def("binom_price",
         &vol::binom::price,
@@ -81,6 +192,19 @@ PYBIND11_MODULE(volpy, m) {
         py::arg("T"), py::arg("vol"), py::arg("steps"),
         py::arg("is_call"), py::arg("is_american"));
 
+    m.def("binom_price_w_info_parallel",
+        [](double S, double K, double r, double q, double T, double vol, int steps, bool is_call, bool is_american,
+           int n_threads, int block, int layers) {
+            py::gil_scoped_release release;
+            return vol::binom::price_w_info_parallel(S, K, r, q, T, vol, steps, is_call, is_american,
+                                                     {n_threads, block, layers});
+        },
+        "CRR binomial price + earliest early-exercise step on the tiled multi-threaded lattice (bit-identical to binom_price_w_info)",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("vol"), py::arg("steps"),
+        py::arg("is_call"), py::arg("is_american"),
+        py::arg("n_threads") = 0, py::arg("block") = 4096, py::arg("layers") = 256);
+
     m.def("binom_price_greeks",
         &vol::binom::price_greeks,
         "CRR binomial price + Greeks (finite differences)",
@@ -88,15 +212,138 @@ PYBIND11_MODULE(volpy, m) {
         py::arg("T"), py::arg("vol"), py::arg("steps"),
         py::arg("is_call"), py::arg("is_american"));
 
+    // --- American (ALO collocation) ---
+    py::class_<vol::american::Scheme>(m, "AmericanScheme")
+        .def(py::init([](int nodes, int iterations, int quad_order, int premium_order) {
+                 return vol::american::Scheme{nodes, iterations, quad_order, premium_order};
+             }),
+             py::arg("nodes"), py::arg("iterations"), py::arg("quad_order"), py::arg("premium_order"))
+        .def_readwrite("nodes",         &vol::american::Scheme::nodes)
+        .def_readwrite("iterations",    &vol::american::Scheme::iterations)
+        .def_readwrite("quad_order",    &vol::american::Scheme::quad_order)
+        .def_readwrite("premium_order", &vol::american::Scheme::premium_order);
+    m.attr("AMERICAN_FAST")     = vol::american::FAST;
+    m.attr("AMERICAN_ACCURATE") = vol::american::ACCURATE;
+    m.attr("AMERICAN_HIGH")     = vol::american::HIGH;
+
+    m.def("american_price",
+        &vol::american::price,
+        "American price by ALO boundary collocation",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("vol"), py::arg("is_call"),
+        py::arg("scheme") = vol::american::ACCURATE);
+
+    m.def("american_price_greeks",
+        &vol::american::price_greeks,
+        "American price + Greeks (BinomPriceGreeks; theta is calendar dV/dt)",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("vol"), py::arg("is_call"),
+        py::arg("scheme") = vol::american::ACCURATE);
+
+    m.def("implied_vol_american",
+        py::overload_cast<double,double,double,double,double,double,bool,const vol::american::Scheme&,double>(
+            &vol::american::implied_vol),
+        "Implied vol from an American price (ALO pricer, secant steps from the European IV)",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("target"), py::arg("is_call"),
+        py::arg("scheme") = vol::american::ACCURATE, py::arg("tol") = 1e-10);
+
+    m.def("implied_vol_american_batch",
+        [](CArray<double> S, CArray<double> K, CArray<double> r, CArray<double> q,
+           CArray<double> T, CArray<double> target, CArray<bool> is_call,
+           std::optional<CArray<double>> out, const vol::american::Scheme& scheme, double tol, int n_threads) {
+            const std::size_t n = static_cast<std::size_t>(K.size());
+            check_len(S, n, "S"); check_len(K, n, "K"); check_len(r, n, "r"); check_len(q, n, "q");
+            check_len(T, n, "T"); check_len(target, n, "target"); check_len(is_call, n, "is_call");
+            auto res = output_for(out, n);
+            const double *s = S.data(), *k = K.data(), *rr = r.data(), *qq = q.data(), *t = T.data(), *px = target.data();
+            const bool* c = is_call.data();
+            double* o = res.mutable_data();
+            {
+                py::gil_scoped_release release;
+                // each quote is several American solves, so split much finer than BATCH_GRAIN
+                vol::util::parallel_for(n, n_threads, 4, [&](std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        const auto iv = vol::american::implied_vol(s[i], k[i], rr[i], qq[i], t[i], px[i], c[i], scheme, tol);
+                        o[i] = iv.converged ? iv.iv : std::numeric_limits<double>::quiet_NaN();
+                    }
+                });
+            }
+            return res;
+        },
+        "American implied vols for arrays of quotes; NaN where the solver did not converge",
+        py::arg("S").noconvert(), py::arg("K").noconvert(), py::arg("r").noconvert(),
+        py::arg("q").noconvert(), py::arg("T").noconvert(), py::arg("target").noconvert(),
+        py::arg("is_call").noconvert(), py::arg("out").noconvert() = py::none(),
+        py::arg("scheme") = vol::american::ACCURATE, py::arg("tol") = 1e-10, py::arg("n_threads") = 1);
+
+    m.def("american_exercise_boundary",
+        &vol::american::exercise_boundary,
+        "Early-exercise boundary at time to expiry tau (NaN without early exercise)",
+        py::arg("K"), py::arg("r"), py::arg("q"), py::arg("T"), py::arg("vol"),
+        py::arg("is_call"), py::arg("tau"),
+        py::arg("scheme") = vol::american::ACCURATE);
+
+    // --- Finite differences (Crank-Nicolson) ---
+    py::enum_<vol::fd::AmericanSolver>(m, "FDAmericanSolver")
+        .value("BrennanSchwartz", vol::fd::AmericanSolver::BrennanSchwartz)
+        .value("PSOR",            vol::fd::AmericanSolver::PSOR);
+
+    py::class_<vol::fd::Config>(m, "FDConfig")
+        .def(py::init<>())
+        .def_readwrite("space_steps",     &vol::fd::Config::space_steps)
+        .def_readwrite("time_steps",      &vol::fd::Config::time_steps)
+        .def_readwrite("rannacher_steps", &vol::fd::Config::rannacher_steps)
+        .def_readwrite("concentration",   &vol::fd::Config::concentration)
+        .def_readwrite("width",           &vol::fd::Config::width)
+        .def_readwrite("american",        &vol::fd::Config::american)
+        .def_readwrite("psor_omega",      &vol::fd::Config::psor_omega)
+        .def_readwrite("psor_tol",        &vol::fd::Config::psor_tol)
+        .def_readwrite("psor_max_iters",  &vol::fd::Config::psor_max_iters);
+
+    m.def("fd_price",
+        &vol::fd::price,
+        "Crank-Nicolson finite-difference price",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"), py::arg("T"), py::arg("vol"),
+        py::arg("is_call"), py::arg("is_american"), py::arg("config") = vol::fd::Config{});
+
+    m.def("fd_price_greeks",
+        py::overload_cast<double,double,double,double,double,double,bool,bool,const vol::fd::Config&>(
+            &vol::fd::price_greeks),
+        "Crank-Nicolson price + Greeks (delta/gamma/theta from the grid)",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"), py::arg("T"), py::arg("vol"),
+        py::arg("is_call"), py::arg("is_american"), py::arg("config") = vol::fd::Config{});
+
+    m.def("fd_price_greeks_local_vol",
+        py::overload_cast<double,double,double,double,double,const vol::fd::LocalVol&,bool,bool,const vol::fd::Config&>(
+            &vol::fd::price_greeks),
+        "Crank-Nicolson price + Greeks under a local vol callable sigma(S, t)",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"), py::arg("T"), py::arg("local_vol"),
+        py::arg("is_call"), py::arg("is_american"), py::arg("config") = vol::fd::Config{});
+
     // --- Monte Carlo ---
+    py::class_<vol::mc::MCGreek>(m, "MCGreek")
+        .def_readonly("value",  &vol::mc::MCGreek::value)
+        .def_readonly("stderr", &vol::mc::MCGreek::std_err);
+
     py::class_<vol::mc::MCResult>(m, "MCResult")
         .def_readonly("price",  &vol::mc::MCResult::price)
         .def_readonly("stderr", &vol::mc::MCResult::std_err)
-        .def_readonly("paths",  &vol::mc::MCResult::paths);
+        .def_readonly("paths",  &vol::mc::MCResult::paths)
+        .def_readonly("delta",  &vol::mc::MCResult::delta)
+        .def_readonly("vega",   &vol::mc::MCResult::vega)
+        .def_readonly("gamma",  &vol::mc::MCResult::gamma);
+
+    py::enum_<vol::mc::NormalGen>(m, "NormalGen")
+        .value("StdLib", vol::mc::NormalGen::StdLib)
+        .value("InverseCDF", vol::mc::NormalGen::InverseCDF);
 
     m.def("mc_euro_gbm",
         &vol::mc::european_vanilla_gbm,
-        "Monte Carlo GBM pricer");
+        "Monte Carlo GBM pricer with same-pass delta, vega and gamma",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"), py::arg("T"), py::arg("vol"),
+        py::arg("is_call"), py::arg("n_paths"), py::arg("seed") = 42,
+        py::arg("gen") = vol::mc::NormalGen::StdLib, py::arg("accuracy") = vol::math::Accuracy::Full);
 
     // --- Heston model ---
     py::class_<vol::heston::Params>(m, "HestonParams")
@@ -116,6 +363,71 @@ PYBIND11_MODULE(volpy, m) {
         py::arg("T"), py::arg("params"), py::arg("is_call"),
         py::arg("n_gl") = 64);
 
+    py::class_<vol::heston::Sensitivities>(m, "HestonSensitivities")
+        .def_readonly("price", &vol::heston::Sensitivities::price)
+        .def_readonly("delta", &vol::heston::Sensitivities::delta)
+        .def_readonly("dK", &vol::heston::Sensitivities::dK)
+        .def_readonly("rho", &vol::heston::Sensitivities::rho)
+        .def_readonly("dq", &vol::heston::Sensitivities::dq)
+        .def_readonly("theta", &vol::heston::Sensitivities::theta)
+        .def_readonly("d_params", &vol::heston::Sensitivities::d_params);
+
+    m.def("heston_price_cf_sensitivities",
+        &vol::heston::price_cf_sensitivities,
+        "Heston CF price with all first-order sensitivities from one adjoint sweep",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("params"), py::arg("is_call"),
+        py::arg("n_gl") = 64);
+
+    py::class_<vol::heston::AdaptiveConfig>(m, "HestonAdaptiveConfig")
+        .def(py::init<>())
+        .def_readwrite("tol", &vol::heston::AdaptiveConfig::tol)
+        .def_readwrite("max_nodes", &vol::heston::AdaptiveConfig::max_nodes);
+
+    py::class_<vol::heston::CFResult>(m, "HestonCFResult")
+        .def_readonly("price", &vol::heston::CFResult::price)
+        .def_readonly("error_estimate", &vol::heston::CFResult::error_estimate)
+        .def_readonly("nodes", &vol::heston::CFResult::nodes);
+
+    m.def("heston_price_cf_adaptive",
+        &vol::heston::price_cf_adaptive,
+        "Heston vanilla price with error-controlled (nested Clenshaw-Curtis) integration",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("params"), py::arg("is_call"),
+        py::arg("cfg") = vol::heston::AdaptiveConfig{});
+
+    m.def("heston_price_cf_damped",
+        &vol::heston::price_cf_damped,
+        "Heston vanilla price on an optimally damped contour with a Black-Scholes control variate",
+        py::arg("S"), py::arg("K"), py::arg("r"), py::arg("q"),
+        py::arg("T"), py::arg("params"), py::arg("is_call"),
+        py::arg("n_nodes") = 32);
+
+    m.def("heston_price_cf_batch",
+        [](double S, CArray<double> K, double r, double q, CArray<double> T,
+           const vol::heston::Params& params, CArray<bool> is_call,
+           std::optional<CArray<double>> out, int n_gl, int n_threads) {
+            const std::size_t n = static_cast<std::size_t>(K.size());
+            check_len(K, n, "K"); check_len(T, n, "T"); check_len(is_call, n, "is_call");
+            auto res = output_for(out, n);
+            const double *k = K.data(), *t = T.data();
+            const bool* c = is_call.data();
+            double* o = res.mutable_data();
+            {
+                py::gil_scoped_release release;
+                vol::util::parallel_for(n, n_threads, BATCH_GRAIN, [&](std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        o[i] = vol::heston::price_cf(S, k[i], r, q, t[i], params, c[i], n_gl);
+                    }
+                });
+            }
+            return res;
+        },
+        "Heston CF prices for arrays of strikes / maturities under one parameter set",
+        py::arg("S"), py::arg("K").noconvert(), py::arg("r"), py::arg("q"),
+        py::arg("T").noconvert(), py::arg("params"), py::arg("is_call").noconvert(),
+        py::arg("out").noconvert() = py::none(), py::arg("n_gl") = 64, py::arg("n_threads") = 1);
+
     // --- SVI params ---
     py::class_<vol::svi::Params>(m, "SVIParams")
         .def(py::init<>())
@@ -152,7 +464,9 @@ PYBIND11_MODULE(volpy, m) {
         .def_readwrite("use_vega_weights", &vol::svi::SliceConfig::use_vega_weights)
         .def_readwrite("wing_dampen_pow", &vol::svi::SliceConfig::wing_dampen_pow)
         .def_readwrite("min_vega_eps", &vol::svi::SliceConfig::min_vega_eps)
-        .def_readwrite("min_points", &vol::svi::SliceConfig::min_points);
+        .def_readwrite("min_points", &vol::svi::SliceConfig::min_points)
+        .def_readwrite("american", &vol::svi::SliceConfig::american)
+        .def_readwrite("american_scheme", &vol::svi::SliceConfig::american_scheme);
 
     // Calibrate a slice directly from (OptionSpec[], mids[])
     m.def("svi_calibrate_slice_from_prices",
@@ -160,4 +474,64 @@ PYBIND11_MODULE(volpy, m) {
         py::arg("opts"),
         py::arg("mids"),
         py::arg("cfg") = vol::svi::SliceConfig{});
+
+    // Same calibration from NumPy arrays of one maturity: the arrays are read in place through
+    // the forward/discount SliceQuotes form. American quotes need spot and carry for the
+    // inversion, so those still go through OptionSpec rows.
+    m.def("svi_calibrate_slice_from_arrays",
+        [](double S, CArray<double> K, double r, double q, double T, CArray<bool> is_call,
+           CArray<double> mids, const vol::svi::SliceConfig& cfg) {
+            static_assert(sizeof(bool) == sizeof(std::uint8_t), "numpy bool arrays are one byte per element");
+            const std::size_t n = static_cast<std::size_t>(K.size());
+            check_len(K, n, "K"); check_len(is_call, n, "is_call"); check_len(mids, n, "mids");
+            const double* k = K.data();
+            const bool* c = is_call.data();
+            const double* px = mids.data();
+            py::gil_scoped_release release;
+            if (cfg.american) {
+                std::vector<vol::OptionSpec> opts(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    opts[i] = vol::OptionSpec{S, k[i], r, q, T, c[i]};
+                }
+                return vol::svi::calibrate_slice_from_prices(opts, std::vector<double>(px, px + n), cfg);
+            }
+            const vol::svi::SliceQuotes quotes{T, S * std::exp((r - q) * T), std::exp(-r * T),
+                                               std::span<const double>(k, n), std::span<const double>(px, n),
+                                               std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(c), n)};
+            return vol::svi::calibrate_slice(quotes, cfg);
+        },
+        py::arg("S"), py::arg("K").noconvert(), py::arg("r"), py::arg("q"), py::arg("T"),
+        py::arg("is_call").noconvert(), py::arg("mids").noconvert(),
+        py::arg("cfg") = vol::svi::SliceConfig{});
+
+    // Telemetry: all zero unless libvol was built with -DVOL_TELEMETRY=ON
+    m.def("telemetry_compiled_in", &vol::telemetry::compiled_in);
+    m.def("telemetry_reset", &vol::telemetry::reset);
+    m.def("telemetry_json", [] { return vol::telemetry::to_json(vol::telemetry::snapshot()); });
+    m.def("telemetry_snapshot", [] {
+        namespace tel = vol::telemetry;
+        const tel::Snapshot s = tel::snapshot();
+        py::dict counters, stages;
+        for (std::size_t c = 0; c < tel::N_COUNTERS; ++c) {
+            counters[tel::name(static_cast<tel::Counter>(c))] = s.counters[c];
+        }
+        for (std::size_t st = 0; st < tel::N_STAGES; ++st) {
+            const tel::Histogram& h = s.stages[st];
+            py::dict d;
+            d["count"] = h.count;
+            d["mean_ns"] = h.mean_ns();
+            d["min_ns"] = h.min_ns;
+            d["p50_ns"] = h.percentile(0.50);
+            d["p90_ns"] = h.percentile(0.90);
+            d["p99_ns"] = h.percentile(0.99);
+            d["p999_ns"] = h.percentile(0.999);
+            d["max_ns"] = h.max_ns;
+            stages[tel::name(static_cast<tel::Stage>(st))] = d;
+        }
+        py::dict out;
+        out["compiled_in"] = tel::compiled_in();
+        out["counters"] = counters;
+        out["stages"] = stages;
+        return out;
+    });
 }
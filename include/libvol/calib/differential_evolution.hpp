@@ -0,0 +1,61 @@
+#pragma once
+#include "libvol/calib/least_squares.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace vol::calib {
+
+// Differential evolution (DE/rand/1/bin with a dithered scale factor) for bounded global
+// minimisation, e.g. the multimodal Heston (kappa, sigma, rho) landscape, with the best
+// members polished by lbfgsb.
+//
+// The population starts from a Latin hypercube over [lb, ub]. Each generation draws every
+// trial vector serially from one seeded generator, evaluates the trials in parallel on a
+// util::ThreadPool kept for the whole run, then selects serially; since evaluation order
+// never touches the random stream, the result is bit-identical for any thread count.
+// Mutants that leave the box bounce back between their parent and the violated bound, so
+// every evaluated point lies in [lb, ub], the same box lbfgsb projects onto. The objective
+// must be thread-safe.
+struct DEConfig {
+    int population = 0;            // members; 0: 10 x dimension (at least 8)
+    int max_generations = 300;
+    double F_lo = 0.5, F_hi = 1.0; // scale factor, redrawn per generation (dither)
+    double CR = 0.9;               // binomial crossover rate
+    double target = -1.0;          // stop once the best objective is <= target (< 0: off)
+    double tol = 1e-8;             // stop when stddev(f) <= tol * |mean(f)| + atol
+    double atol = 0.0;
+    std::uint64_t seed = 1;
+    int n_threads = 0;             // 0: hardware concurrency
+    int polish = 3;                // best distinct members handed to lbfgsb (with f_grad)
+    int polish_maxit = 200;
+    double polish_tol = 1e-8;
+};
+
+struct DEResult {
+    std::vector<double> x;
+    double obj;
+    int generations;
+    long long evaluations;         // objective calls in the global stage
+    bool converged;                // tol or target met before max_generations
+    bool polished;                 // x comes from an lbfgsb run that improved on the DE best
+};
+
+// Global stage only. Throws std::invalid_argument unless lb and ub have the same, nonzero
+// length with finite lb[i] < ub[i]. Non-finite objective values rank as +infinity.
+DEResult differential_evolution(
+const std::vector<double>& lb,
+const std::vector<double>& ub,
+const std::function<double(const std::vector<double>&)>& f,
+const DEConfig& cfg = {});
+
+// Global stage, then lbfgsb from the cfg.polish best distinct members (in parallel) with
+// the same bounds; returns the best point found by either stage.
+DEResult differential_evolution(
+const std::vector<double>& lb,
+const std::vector<double>& ub,
+const std::function<double(const std::vector<double>&)>& f,
+const std::function<void(const std::vector<double>&, double&, std::vector<double>&)>& f_grad,
+const DEConfig& cfg = {});
+}
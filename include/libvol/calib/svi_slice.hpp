@@ -1,6 +1,11 @@
 #pragma once
+#include "libvol/core/chain.hpp"
 #include "libvol/core/types.hpp"
+#include "libvol/models/american_scheme.hpp"
 #include "libvol/models/svi.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace vol::svi {
@@ -10,8 +15,54 @@ struct SliceConfig {
     double wing_dampen_pow = 2.0;  
     double min_vega_eps = 1e-8;  // floor to avoid zeros
     int min_points = 6;    
+    // American-style quotes: invert mids with american::implied_vol (spot, r and q are
+    // needed, so the forward/discount SliceQuotes form rejects it)
+    bool american = false;
+    american::Scheme american_scheme = american::ACCURATE;
+    // Previous fit of this expiry (e.g. loaded from an io::SurfaceFile): one local solve
+    // from here instead of the cold multi-start, see fit_raw_svi_warm
+    std::optional<Params> warm_start;
 };
 
 Params calibrate_slice_from_prices(const std::vector<OptionSpec>& opts, const std::vector<double>& mids,const SliceConfig& cfg = {});
 
+// Same fit from parallel columns of one expiry in forward/discount form (e.g. an
+// io::ChainSnapshot slice), without building OptionSpec rows.
+struct SliceQuotes {
+    double T;
+    double forward;
+    double discount;
+    std::span<const double> strikes;
+    std::span<const double> mids;
+    std::span<const std::uint8_t> is_call;
+};
+
+Params calibrate_slice(const SliceQuotes& quotes, const SliceConfig& cfg = {});
+
+// Precomputed chain (one expiry); mids parallel to chain.K
+Params calibrate_slice(const Chain& chain, std::span<const double> mids, const SliceConfig& cfg = {});
+
+// The same fits with their diagnostics (rmse, iterations, usable points, convergence)
+FitResult calibrate_slice_report(const std::vector<OptionSpec>& opts, const std::vector<double>& mids,
+                                 const SliceConfig& cfg = {});
+FitResult calibrate_slice_report(const SliceQuotes& quotes, const SliceConfig& cfg = {});
+
+// What one quote contributes to a slice fit once its implied vol is known: log-moneyness
+// k = log(K / F), total variance iv^2 T and the weight cfg gives it (vega weighting, wing
+// damping). For callers that keep implied vols, e.g. a streaming book, so a refit does not
+// invert the prices again.
+struct SlicePoint {
+    double k;
+    double w;
+    double weight;
+};
+SlicePoint slice_point(double S, double K, double r, double q, double T, double iv, bool is_call,
+                       const SliceConfig& cfg = {});
+
+// The fit behind every form above, from parallel k / w / weight columns: the min_points
+// fallback, then fit_raw_svi_report or fit_raw_svi_warm. Throws std::invalid_argument if
+// the columns differ in length.
+FitResult calibrate_slice_variance(const std::vector<double>& k, const std::vector<double>& w,
+                                   const std::vector<double>& weights, const SliceConfig& cfg = {});
+
 } // namespace vol::svi
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace vol {
+
+// Everything about one expiry that does not depend on the strike. OptionSpec repeats
+// S, r, q, T per quote and every pricer recomputes the discount factors, sqrt(T) and the
+// forward from them; the ExpiryContext overloads in bs:: and svi:: take them from here.
+struct ExpiryContext {
+    double S, r, q, T;
+    double sqrt_T;
+    double df_r;    // exp(-r T)
+    double df_q;    // exp(-q T)
+    double forward; // S exp((r - q) T)
+};
+
+inline ExpiryContext make_expiry(double S, double r, double q, double T) {
+    const double df_r = std::exp(-r * T);
+    const double df_q = std::exp(-q * T);
+    return {S, r, q, T, std::sqrt(T), df_r, df_q, S * df_q / df_r};
+}
+
+// One expiry of a chain: shared context plus per-strike columns, with the
+// log-moneyness k = log(K / F) computed once per strike.
+struct Chain {
+    ExpiryContext expiry;
+    std::vector<double> K;
+    std::vector<double> k;
+    std::vector<std::uint8_t> is_call;
+
+    std::size_t size() const { return K.size(); }
+};
+
+inline Chain make_chain(const ExpiryContext& expiry,
+                        std::span<const double> strikes,
+                        std::span<const std::uint8_t> is_call) {
+    if (is_call.size() != strikes.size()) {
+        throw std::invalid_argument("make_chain: strikes and is_call lengths differ");
+    }
+    Chain c{expiry, {strikes.begin(), strikes.end()}, {}, {is_call.begin(), is_call.end()}};
+    c.k.resize(c.K.size());
+    const double inv_F = 1.0 / expiry.forward;
+    for (std::size_t i = 0; i < c.K.size(); ++i) {
+        c.k[i] = std::log(c.K[i] * inv_F);
+    }
+    return c;
+}
+
+} // namespace vol
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vol::io {
+
+// Columnar option-chain snapshot.
+//
+// File layout (little-endian, native doubles):
+//   Header        fixed 128 bytes: magic "VOLSNAP\0", format version, row/slice counts,
+//                 total file size and the byte offset of every column
+//   Slice table   one SliceRecord per (underlying, expiry): T, forward, discount and the
+//                 [begin, end) row range of its quotes
+//   Columns       strike, bid, ask, mid (double) and is_call (uint8), each n_rows long and
+//                 64-byte aligned, rows of a slice contiguous and in slice-table order
+//
+// Quotes are stored in forward/discount form, so a reader needs no spot, rate or dividend
+// curve: the equivalent OptionSpec is {S = forward, K, r = -log(discount) / T, q = r, T}.
+inline constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+struct SliceRecord {
+    std::uint32_t underlying;
+    std::uint32_t reserved;
+    double T;
+    double forward;
+    double discount;
+    std::uint64_t begin;
+    std::uint64_t end;
+};
+
+// Zero-copy view of one slice; spans point into the mapped file.
+struct SliceView {
+    std::uint32_t underlying;
+    double T;
+    double forward;
+    double discount;
+    std::span<const double> strike;
+    std::span<const double> bid;
+    std::span<const double> ask;
+    std::span<const double> mid;
+    std::span<const std::uint8_t> is_call;
+};
+
+class SnapshotWriter {
+public:
+    // Appends one (underlying, expiry) slice. All columns must have the same length.
+    void add_slice(std::uint32_t underlying,
+                   double T,
+                   double forward,
+                   double discount,
+                   std::span<const double> strike,
+                   std::span<const double> bid,
+                   std::span<const double> ask,
+                   std::span<const double> mid,
+                   std::span<const std::uint8_t> is_call);
+
+    // Throws std::runtime_error if the file cannot be written.
+    void write(const std::string& path) const;
+
+    std::size_t rows() const { return strike_.size(); }
+    std::size_t slices() const { return slices_.size(); }
+
+private:
+    std::vector<SliceRecord> slices_;
+    std::vector<double> strike_, bid_, ask_, mid_;
+    std::vector<std::uint8_t> is_call_;
+};
+
+// Read-only memory-mapped snapshot (heap copy on platforms without mmap).
+// open() validates magic, version and sizes and throws std::runtime_error on mismatch.
+class ChainSnapshot {
+public:
+    static ChainSnapshot open(const std::string& path);
+
+    ChainSnapshot(ChainSnapshot&& other) noexcept;
+    ChainSnapshot& operator=(ChainSnapshot&& other) noexcept;
+    ChainSnapshot(const ChainSnapshot&) = delete;
+    ChainSnapshot& operator=(const ChainSnapshot&) = delete;
+    ~ChainSnapshot();
+
+    std::uint32_t version() const;
+    std::size_t rows() const { return rows_; }
+    std::size_t slices() const { return slices_.size(); }
+    SliceView slice(std::size_t i) const;
+
+    // Whole columns, all slices
+    std::span<const double> strike() const { return strike_; }
+    std::span<const double> bid() const { return bid_; }
+    std::span<const double> ask() const { return ask_; }
+    std::span<const double> mid() const { return mid_; }
+    std::span<const std::uint8_t> is_call() const { return is_call_; }
+
+private:
+    ChainSnapshot() = default;
+    void release() noexcept;
+
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<std::byte> buffer_; // fallback storage when not mapped
+
+    std::size_t rows_ = 0;
+    std::span<const SliceRecord> slices_;
+    std::span<const double> strike_, bid_, ask_, mid_;
+    std::span<const std::uint8_t> is_call_;
+};
+
+} // namespace vol::io
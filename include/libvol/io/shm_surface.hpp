@@ -0,0 +1,123 @@
+#pragma once
+
+#include "libvol/models/svi.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vol::io {
+
+// Calibrated surfaces in a POSIX shared-memory segment, one writer process and any number
+// of reader processes per host.
+//
+// Segment layout (native endianness, every block 64-byte aligned):
+//   Header    fixed 128 bytes: magic "VOLSHM\0\0", format version, capacity (underlyings,
+//             slices per underlying), record size, writer pid and a ready flag
+//   Records   one per underlying: a seqlock word, publish time and slice count in the
+//             first 64 bytes, then max_slices ShmSlice entries (64 bytes each)
+//
+// The writer bumps an underlying's sequence to odd, rewrites its slices, and bumps it back
+// to even; a reader copies the slices out of the mapping and retries if the sequence moved
+// or was odd. Readers never write to the segment (it is mapped PROT_READ) and never wait
+// on the writer except while it is inside one record, and then only for a bounded time:
+// they give up if the writer process (header pid) has died or the wait exceeds max_wait.
+// version = sequence / 2 = number of completed publishes of that underlying.
+inline constexpr std::uint32_t SHM_VERSION = 1;
+
+// One expiry in the forward/discount form of SliceRecord
+struct ShmSlice {
+    double T;
+    double forward;
+    double discount;
+    svi::Params params;
+};
+
+struct ShmRead {
+    std::uint64_t version;      // 0: never published
+    std::uint64_t published_ns; // steady-clock ns (CLOCK_MONOTONIC, shared across processes)
+    std::size_t n_slices;
+};
+
+class ShmSurfaceWriter {
+public:
+    // Creates the segment (name as for shm_open, e.g. "/libvol_surfaces"). An existing
+    // segment is replaced only if the writer recorded in it is gone (or it is not a valid
+    // segment); a live writer keeps it and create throws std::runtime_error. Also throws
+    // std::invalid_argument on zero capacities, std::runtime_error if the segment cannot be
+    // created or mapped.
+    static ShmSurfaceWriter create(const std::string& name, std::uint32_t max_underlyings,
+                                   std::uint32_t max_slices);
+
+    ShmSurfaceWriter(ShmSurfaceWriter&& other) noexcept;
+    ShmSurfaceWriter& operator=(ShmSurfaceWriter&& other) noexcept;
+    ShmSurfaceWriter(const ShmSurfaceWriter&) = delete;
+    ShmSurfaceWriter& operator=(const ShmSurfaceWriter&) = delete;
+    ~ShmSurfaceWriter();   // unmaps; the segment stays until remove()
+
+    // Replaces every slice of one underlying; returns its new version. Throws
+    // std::invalid_argument on a bad index or more than max_slices slices.
+    std::uint64_t publish(std::uint32_t underlying, std::span<const ShmSlice> slices);
+
+    std::uint32_t max_underlyings() const { return max_underlyings_; }
+    std::uint32_t max_slices() const { return max_slices_; }
+    const std::string& name() const { return name_; }
+
+    // shm_unlink; mapped readers keep their view until they detach
+    static void remove(const std::string& name);
+
+private:
+    ShmSurfaceWriter() = default;
+    void release() noexcept;
+
+    std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::string name_;
+    std::uint32_t max_underlyings_ = 0, max_slices_ = 0;
+    std::size_t record_bytes_ = 0;
+};
+
+class ShmSurfaceReader {
+public:
+    // Maps an existing segment read-only and validates its header. Throws
+    // std::runtime_error if it does not exist, is not ready or has another format.
+    // max_wait bounds how long one read() retries against the writer.
+    static ShmSurfaceReader attach(const std::string& name,
+                                   std::chrono::milliseconds max_wait = std::chrono::milliseconds(100));
+
+    ShmSurfaceReader(ShmSurfaceReader&& other) noexcept;
+    ShmSurfaceReader& operator=(ShmSurfaceReader&& other) noexcept;
+    ShmSurfaceReader(const ShmSurfaceReader&) = delete;
+    ShmSurfaceReader& operator=(const ShmSurfaceReader&) = delete;
+    ~ShmSurfaceReader();
+
+    // Consistent copy of one underlying's slices into out (at least max_slices() long),
+    // straight from the mapping. Throws std::invalid_argument on a bad index or short out,
+    // std::runtime_error if the writer died inside this record (it stays odd for good) or no
+    // consistent copy was possible within max_wait (writer stalled mid-publish, or
+    // republishing the record faster than it can be copied).
+    ShmRead read(std::uint32_t underlying, std::span<ShmSlice> out) const;
+    std::vector<ShmSlice> read(std::uint32_t underlying) const;
+
+    // Completed publishes so far; one load, for staleness checks
+    std::uint64_t version(std::uint32_t underlying) const;
+
+    std::uint32_t max_underlyings() const { return max_underlyings_; }
+    std::uint32_t max_slices() const { return max_slices_; }
+    std::int64_t writer_pid() const;
+
+private:
+    ShmSurfaceReader() = default;
+    void release() noexcept;
+
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::uint32_t max_underlyings_ = 0, max_slices_ = 0;
+    std::size_t record_bytes_ = 0;
+    std::uint64_t max_wait_ns_ = 0;
+};
+
+} // namespace vol::io
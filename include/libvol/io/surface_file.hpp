@@ -0,0 +1,93 @@
+#pragma once
+
+#include "libvol/models/svi.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace vol::io {
+
+// Calibrated SVI surfaces persisted between sessions, so a restart can load the last fits
+// and warm-refit (svi::SliceConfig::warm_start) instead of calibrating cold.
+//
+// File layout (little-endian, native doubles):
+//   Header    fixed 128 bytes: magic "VOLSURF\0", format version, record count, total
+//             file size, record offset, a caller-defined timestamp and the checksum
+//   Records   one SurfaceRecord per (underlying, expiry), 64-byte aligned, sorted by
+//             underlying then T
+//
+// The checksum is a 64-bit multiply-rotate hash over the record block, seeded with the
+// record count, so a torn or bit-flipped file fails open() instead of seeding bad fits.
+inline constexpr std::uint32_t SURFACE_FILE_VERSION = 1;
+
+struct SurfaceRecord {
+    std::uint32_t underlying;
+    std::uint32_t flags;       // SURFACE_CONVERGED if the stored fit converged
+    double T;
+    double forward;
+    double discount;
+    svi::Params params;
+    // fit diagnostics / optimizer state, as in svi::FitResult
+    double rmse;
+    std::int32_t iterations;
+    std::int32_t n_points;
+    std::uint64_t reserved;
+};
+
+inline constexpr std::uint32_t SURFACE_CONVERGED = 1u;
+
+class SurfaceFileWriter {
+public:
+    // Appends one (underlying, expiry) fit. Throws std::invalid_argument unless T, forward
+    // and discount are positive.
+    void add(std::uint32_t underlying, double T, double forward, double discount, const svi::FitResult& fit);
+    void add(const SurfaceRecord& record);
+
+    // Writes to path + ".tmp", fsyncs it and renames over path, then fsyncs the directory:
+    // readers never see a partial file, and after a crash path holds either the old surface
+    // or the new one. timestamp is stored verbatim (e.g. calibration time in ns). Throws
+    // std::runtime_error if the file cannot be written or synced.
+    void write(const std::string& path, std::uint64_t timestamp = 0) const;
+
+    std::size_t records() const { return records_.size(); }
+
+private:
+    std::vector<SurfaceRecord> records_;
+};
+
+// Read-only memory-mapped surface file (heap copy on platforms without mmap).
+// open() validates magic, version, sizes, ordering and (unless verify is false) the
+// checksum, and throws std::runtime_error on any mismatch.
+class SurfaceFile {
+public:
+    static SurfaceFile open(const std::string& path, bool verify = true);
+
+    SurfaceFile(SurfaceFile&& other) noexcept;
+    SurfaceFile& operator=(SurfaceFile&& other) noexcept;
+    SurfaceFile(const SurfaceFile&) = delete;
+    SurfaceFile& operator=(const SurfaceFile&) = delete;
+    ~SurfaceFile();
+
+    std::uint32_t version() const;
+    std::uint64_t timestamp() const;
+    std::size_t size() const { return records_.size(); }
+    std::span<const SurfaceRecord> records() const { return records_; }
+
+    // Records of one underlying (sorted by T), empty if it has none; binary search
+    std::span<const SurfaceRecord> underlying(std::uint32_t u) const;
+
+private:
+    SurfaceFile() = default;
+    void release() noexcept;
+
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<std::byte> buffer_; // fallback storage when not mapped
+    std::span<const SurfaceRecord> records_;
+};
+
+} // namespace vol::io
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "libvol/math/adjoint_fwd.hpp"
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Reverse-mode algorithmic differentiation on a tape.
+//
+// Each operation on Var records one statement on the active tape: the indices of its
+// operands and its partial derivatives with respect to them. A reverse sweep from an output
+// then accumulates d(output)/d(every recorded value) in a single pass, so a function gets
+// its whole gradient for a small multiple of its own cost however many inputs it has.
+//
+// Values that do not depend on an input (plain doubles, and Vars computed only from them)
+// are never recorded. Statements live in arenas of fixed-size blocks; reset() rewinds them
+// without freeing, so a tape reused across evaluations stops allocating once it has held
+// the largest one. Tapes are per thread: Tape::Scope makes one active for the calling
+// thread, and Vars from a tape may only be combined while it is active.
+//
+// Complex is the same for complex-valued code (characteristic functions): holomorphic
+// operations record two statements, real and imaginary part, through Cauchy-Riemann.
+namespace vol::ad {
+
+namespace detail {
+
+// Append-only storage in blocks of 2^14 elements; clear() keeps the blocks. Appends bump a
+// pointer into the current block, the block list is only touched every 2^14 elements.
+template <class T>
+class Arena {
+public:
+    static constexpr std::size_t BLOCK_BITS = 14;
+    static constexpr std::size_t BLOCK = std::size_t{1} << BLOCK_BITS;
+
+    T& operator[](std::size_t i) { return blocks_[i >> BLOCK_BITS][i & (BLOCK - 1)]; }
+    const T& operator[](std::size_t i) const { return blocks_[i >> BLOCK_BITS][i & (BLOCK - 1)]; }
+
+    void push_back(const T& v) {
+        if (next_ == end_) next_block();
+        *next_++ = v;
+    }
+    std::size_t size() const { return next_ == nullptr ? 0 : (block_ << BLOCK_BITS) + (next_ - begin_); }
+    std::size_t capacity() const { return blocks_.size() * BLOCK; }
+    void clear() {
+        block_ = 0;
+        begin_ = next_ = end_ = nullptr;
+    }
+
+private:
+    void next_block() {
+        if (next_ != nullptr) ++block_;
+        if (block_ == blocks_.size()) blocks_.emplace_back(new T[BLOCK]);
+        begin_ = next_ = blocks_[block_].get();
+        end_ = begin_ + BLOCK;
+    }
+
+    std::vector<std::unique_ptr<T[]>> blocks_;
+    std::size_t block_ = 0;   // index of the block next_ points into
+    T* begin_ = nullptr;
+    T* next_ = nullptr;
+    T* end_ = nullptr;
+};
+
+struct Operand {
+    double partial;
+    std::uint32_t index;
+};
+
+template <std::size_t N>
+Var record(double value, const std::array<Operand, N>& args);
+
+} // namespace detail
+
+class Tape {
+public:
+    Tape() { reset(); }
+    Tape(const Tape&) = delete;
+    Tape& operator=(const Tape&) = delete;
+
+    // Makes a tape the calling thread's active tape for its lifetime (nests)
+    class Scope {
+    public:
+        explicit Scope(Tape& tape) : prev_(current()) { current() = &tape; }
+        ~Scope() { current() = prev_; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Tape* prev_;
+    };
+
+    static Tape* active() { return current(); }
+
+    // A new independent input
+    Var variable(double value);
+
+    // Drops every statement (all Vars on this tape become invalid), keeps the memory
+    void reset() {
+        ends_.clear();
+        operands_.clear();
+        ends_.push_back(0);   // statement 0: sink for operands that are constants
+    }
+
+    // Reverse sweep: adjoint(x) becomes seed * dy/dx for everything recorded before y
+    void backward(const Var& y, double seed = 1.0);
+    double adjoint(const Var& x) const;
+
+    std::size_t statements() const { return ends_.size() - 1; }
+    std::size_t memory_bytes() const {
+        return ends_.capacity() * sizeof(std::uint32_t) + operands_.capacity() * sizeof(detail::Operand) +
+               adjoints_.capacity() * sizeof(double);
+    }
+
+private:
+    template <std::size_t N>
+    friend Var detail::record(double value, const std::array<detail::Operand, N>& args);
+
+    static Tape*& current() {
+        thread_local Tape* tape = nullptr;
+        return tape;
+    }
+
+    detail::Arena<std::uint32_t> ends_;   // one past each statement's last operand
+    detail::Arena<detail::Operand> operands_;
+    std::vector<double> adjoints_;
+};
+
+class Var {
+public:
+    Var(double value = 0.0) : value_(value), index_(0) {}
+
+    double value() const { return value_; }
+    std::uint32_t index() const { return index_; }
+    bool is_constant() const { return index_ == 0; }
+
+    Var& operator+=(const Var& o);
+    Var& operator-=(const Var& o);
+    Var& operator*=(const Var& o);
+    Var& operator/=(const Var& o);
+
+private:
+    friend class Tape;
+    template <std::size_t N>
+    friend Var detail::record(double value, const std::array<detail::Operand, N>& args);
+
+    Var(double value, std::uint32_t index) : value_(value), index_(index) {}
+
+    double value_;
+    std::uint32_t index_;
+};
+
+namespace detail {
+
+template <std::size_t N>
+inline Var record(double value, const std::array<Operand, N>& args) {
+    bool live = false;
+    for (const Operand& a : args) live |= a.index != 0;
+    if (!live) return Var(value);
+    Tape* tape = Tape::active();
+    if (tape == nullptr) throw std::logic_error("ad: recording without an active tape");
+    for (const Operand& a : args) {
+        if (a.index != 0) tape->operands_.push_back(a);
+    }
+    tape->ends_.push_back(static_cast<std::uint32_t>(tape->operands_.size()));
+    return Var(value, static_cast<std::uint32_t>(tape->ends_.size() - 1));
+}
+
+inline Var unary(double value, const Var& a, double da) {
+    return record<1>(value, {{{da, a.index()}}});
+}
+
+inline Var binary(double value, const Var& a, double da, const Var& b, double db) {
+    return record<2>(value, {{{da, a.index()}, {db, b.index()}}});
+}
+
+} // namespace detail
+
+// y = f(x_1..x_N) as a single statement, for kernels that work out their own partials
+// dy/dx_i (by hand or in forward mode): much less tape than recording every operation of f
+template <std::size_t N>
+Var compound(double value, const std::array<Var, N>& x, const std::array<double, N>& dx) {
+    std::array<detail::Operand, N> args;
+    for (std::size_t i = 0; i < N; ++i) args[i] = {dx[i], x[i].index()};
+    return detail::record<N>(value, args);
+}
+
+inline Var Tape::variable(double value) {
+    ends_.push_back(static_cast<std::uint32_t>(operands_.size()));
+    return Var(value, static_cast<std::uint32_t>(ends_.size() - 1));
+}
+
+// --- arithmetic ---
+
+inline Var operator+(const Var& a) { return a; }
+inline Var operator-(const Var& a) { return detail::unary(-a.value(), a, -1.0); }
+inline Var operator+(const Var& a, const Var& b) { return detail::binary(a.value() + b.value(), a, 1.0, b, 1.0); }
+inline Var operator-(const Var& a, const Var& b) { return detail::binary(a.value() - b.value(), a, 1.0, b, -1.0); }
+inline Var operator*(const Var& a, const Var& b) {
+    return detail::binary(a.value() * b.value(), a, b.value(), b, a.value());
+}
+inline Var operator/(const Var& a, const Var& b) {
+    const double inv = 1.0 / b.value();
+    const double v = a.value() * inv;
+    return detail::binary(v, a, inv, b, -v * inv);
+}
+inline Var operator+(const Var& a, double b) { return detail::unary(a.value() + b, a, 1.0); }
+inline Var operator+(double a, const Var& b) { return detail::unary(a + b.value(), b, 1.0); }
+inline Var operator-(const Var& a, double b) { return detail::unary(a.value() - b, a, 1.0); }
+inline Var operator-(double a, const Var& b) { return detail::unary(a - b.value(), b, -1.0); }
+inline Var operator*(const Var& a, double b) { return detail::unary(a.value() * b, a, b); }
+inline Var operator*(double a, const Var& b) { return detail::unary(a * b.value(), b, a); }
+inline Var operator/(const Var& a, double b) { return detail::unary(a.value() / b, a, 1.0 / b); }
+inline Var operator/(double a, const Var& b) {
+    const double v = a / b.value();
+    return detail::unary(v, b, -v / b.value());
+}
+
+inline Var& Var::operator+=(const Var& o) { return *this = *this + o; }
+inline Var& Var::operator-=(const Var& o) { return *this = *this - o; }
+inline Var& Var::operator*=(const Var& o) { return *this = *this * o; }
+inline Var& Var::operator/=(const Var& o) { return *this = *this / o; }
+
+// Comparisons look at values only (branches are not differentiated)
+inline bool operator<(const Var& a, const Var& b) { return a.value() < b.value(); }
+inline bool operator>(const Var& a, const Var& b) { return a.value() > b.value(); }
+inline bool operator<=(const Var& a, const Var& b) { return a.value() <= b.value(); }
+inline bool operator>=(const Var& a, const Var& b) { return a.value() >= b.value(); }
+inline bool operator==(const Var& a, const Var& b) { return a.value() == b.value(); }
+
+// --- elementary functions (found by ADL from generic code calling e.g. sqrt(x)) ---
+
+inline Var exp(const Var& a) {
+    const double v = std::exp(a.value());
+    return detail::unary(v, a, v);
+}
+inline Var log(const Var& a) { return detail::unary(std::log(a.value()), a, 1.0 / a.value()); }
+inline Var sqrt(const Var& a) {
+    const double v = std::sqrt(a.value());
+    return detail::unary(v, a, 0.5 / v);
+}
+inline Var pow(const Var& a, double p) {
+    const double v = std::pow(a.value(), p);
+    return detail::unary(v, a, p * std::pow(a.value(), p - 1.0));
+}
+inline Var sin(const Var& a) { return detail::unary(std::sin(a.value()), a, std::cos(a.value())); }
+inline Var cos(const Var& a) { return detail::unary(std::cos(a.value()), a, -std::sin(a.value())); }
+inline Var atan2(const Var& y, const Var& x) {
+    const double r2 = x.value() * x.value() + y.value() * y.value();
+    return detail::binary(std::atan2(y.value(), x.value()), y, x.value() / r2, x, -y.value() / r2);
+}
+inline Var abs(const Var& a) { return a.value() < 0.0 ? -a : a; }
+inline Var max(const Var& a, const Var& b) { return a.value() >= b.value() ? a : b; }
+inline Var min(const Var& a, const Var& b) { return a.value() <= b.value() ? a : b; }
+inline Var erfc(const Var& a) {
+    const double x = a.value();
+    return detail::unary(std::erfc(x), a, -1.1283791670955126 * std::exp(-x * x));
+}
+inline Var norm_cdf(const Var& a) {
+    const double x = a.value();
+    return detail::unary(0.5 * std::erfc(-x * 0.70710678118654752440), a,
+                         0.39894228040143267794 * std::exp(-0.5 * x * x));
+}
+
+// --- complex ---
+
+class Complex {
+public:
+    Complex(double re = 0.0, double im = 0.0) : re_(re), im_(im) {}
+    Complex(const Var& re, const Var& im = Var()) : re_(re), im_(im) {}
+    Complex(std::complex<double> z) : re_(z.real()), im_(z.imag()) {}
+
+    const Var& real() const { return re_; }
+    const Var& imag() const { return im_; }
+    std::complex<double> value() const { return {re_.value(), im_.value()}; }
+
+private:
+    Var re_, im_;
+};
+
+inline const Var& real(const Complex& z) { return z.real(); }
+inline const Var& imag(const Complex& z) { return z.imag(); }
+
+namespace detail {
+
+// Plain complex product and quotient: std::complex's operators go through the C99 NaN
+// recovery (__muldc3 / __divdc3) unless built with -ffast-math
+inline std::complex<double> mul(std::complex<double> a, std::complex<double> b) {
+    return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+}
+inline std::complex<double> inv(std::complex<double> b) {
+    const double n = 1.0 / (b.real() * b.real() + b.imag() * b.imag());
+    return {b.real() * n, -b.imag() * n};
+}
+// exp / log / sqrt from real functions, without the special-value handling of cexp & co
+inline std::complex<double> exp(std::complex<double> z) {
+    const double m = std::exp(z.real());
+    return {m * std::cos(z.imag()), m * std::sin(z.imag())};
+}
+inline std::complex<double> log(std::complex<double> z) {
+    return {0.5 * std::log(z.real() * z.real() + z.imag() * z.imag()), std::atan2(z.imag(), z.real())};
+}
+inline std::complex<double> sqrt(std::complex<double> z) {
+    const double t = std::sqrt(0.5 * (std::hypot(z.real(), z.imag()) + std::abs(z.real())));
+    if (t == 0.0) return {0.0, 0.0};
+    if (z.real() >= 0.0) return {t, 0.5 * z.imag() / t};
+    return {0.5 * std::abs(z.imag()) / t, std::copysign(t, z.imag())};
+}
+
+// w = f(z) for holomorphic f with f'(z) = dw: Re w and Im w against Re z and Im z follow
+// from Cauchy-Riemann, d Re w / d Re z = Re f', d Re w / d Im z = -Im f', and so on.
+inline Complex holomorphic(std::complex<double> w, const Complex& z, std::complex<double> dw) {
+    const std::uint32_t x = z.real().index(), y = z.imag().index();
+    return {record<2>(w.real(), {{{dw.real(), x}, {-dw.imag(), y}}}),
+            record<2>(w.imag(), {{{dw.imag(), x}, {dw.real(), y}}})};
+}
+
+inline Complex holomorphic(std::complex<double> w, const Complex& a, std::complex<double> da, const Complex& b,
+                           std::complex<double> db) {
+    const std::uint32_t ax = a.real().index(), ay = a.imag().index();
+    const std::uint32_t bx = b.real().index(), by = b.imag().index();
+    return {record<4>(w.real(), {{{da.real(), ax}, {-da.imag(), ay}, {db.real(), bx}, {-db.imag(), by}}}),
+            record<4>(w.imag(), {{{da.imag(), ax}, {da.real(), ay}, {db.imag(), bx}, {db.real(), by}}})};
+}
+
+} // namespace detail
+
+inline Complex operator-(const Complex& a) { return {-a.real(), -a.imag()}; }
+inline Complex operator+(const Complex& a, const Complex& b) { return {a.real() + b.real(), a.imag() + b.imag()}; }
+inline Complex operator-(const Complex& a, const Complex& b) { return {a.real() - b.real(), a.imag() - b.imag()}; }
+inline Complex operator*(const Complex& a, const Complex& b) {
+    return detail::holomorphic(detail::mul(a.value(), b.value()), a, b.value(), b, a.value());
+}
+inline Complex operator/(const Complex& a, const Complex& b) {
+    const std::complex<double> inv = detail::inv(b.value());
+    const std::complex<double> w = detail::mul(a.value(), inv);
+    return detail::holomorphic(w, a, inv, b, -detail::mul(w, inv));
+}
+// A real factor scales both parts
+inline Complex operator*(const Complex& a, const Var& s) { return {a.real() * s, a.imag() * s}; }
+inline Complex operator*(const Var& s, const Complex& a) { return {s * a.real(), s * a.imag()}; }
+inline Complex operator*(const Complex& a, double s) { return {a.real() * s, a.imag() * s}; }
+inline Complex operator*(double s, const Complex& a) { return {s * a.real(), s * a.imag()}; }
+inline Complex operator/(const Complex& a, const Var& s) { return {a.real() / s, a.imag() / s}; }
+inline Complex operator/(const Complex& a, double s) { return {a.real() / s, a.imag() / s}; }
+
+inline Complex exp(const Complex& z) {
+    const std::complex<double> w = detail::exp(z.value());
+    return detail::holomorphic(w, z, w);
+}
+// Principal branches, as std::log / std::sqrt
+inline Complex log(const Complex& z) {
+    return detail::holomorphic(detail::log(z.value()), z, detail::inv(z.value()));
+}
+inline Complex sqrt(const Complex& z) {
+    const std::complex<double> w = detail::sqrt(z.value());
+    return detail::holomorphic(w, z, 0.5 * detail::inv(w));
+}
+
+} // namespace vol::ad
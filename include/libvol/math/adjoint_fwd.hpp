@@ -0,0 +1,16 @@
+#pragma once
+
+#include <concepts>
+
+// Tape types by name only, for headers that just mention them in signatures and template
+// constraints (models/black_scholes.hpp, models/svi.hpp). Code that builds or sweeps a tape
+// includes math/adjoint.hpp.
+namespace vol::ad {
+
+class Var;
+
+// Scalar types the templated kernels (svi::total_variance, ...) accept
+template <class T>
+concept Scalar = std::floating_point<T> || std::same_as<T, Var>;
+
+} // namespace vol::ad
@@ -13,4 +13,24 @@ struct GaussLaguerreRule {
 // Results are cached per-order and reused.
 const GaussLaguerreRule& gauss_laguerre_rule(int n);
 
+// Clenshaw-Curtis rule on [0, 1] with n+1 points t_j = (1 - cos(j*pi/n)) / 2, j = 0..n.
+// n must be even. Rules are nested: the points of order n are the even-indexed points
+// of order 2n, so an adaptive driver can double n and only evaluate the new points.
+// Results are cached per-order and reused.
+struct ClenshawCurtisRule {
+    std::vector<double> nodes;
+    std::vector<double> weights;
+};
+
+const ClenshawCurtisRule& clenshaw_curtis_rule(int n);
+
+// Gauss-Legendre nodes/weights on [-1, 1] for order n (n >= 1), nodes ascending.
+// Results are cached per-order and reused.
+struct GaussLegendreRule {
+    std::vector<double> nodes;
+    std::vector<double> weights;
+};
+
+const GaussLegendreRule& gauss_legendre_rule(int n);
+
 } // namespace vol::math
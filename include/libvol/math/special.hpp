@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace vol::math {
+
+// Accuracy tiers for the normal-distribution functions (absolute error for the CDF,
+// relative error for the inverse CDF):
+//   Full  std::erfc-based, ~1e-16; the reference, does not vectorise everywhere
+//   High  Cody rational erfc (< 1e-13 relative in the lower tail), Acklam + one Halley step
+//         for the inverse (~1e-14)
+//   Fast  Abramowitz-Stegun 26.2.17 CDF (< 7.5e-8), plain Acklam inverse (< 1.2e-9)
+// High and Fast are branch-free and vectorise in the batch forms. A tier is an accuracy
+// floor: where the C library has a vector erfc (glibc >= 2.35), batch High uses Full.
+enum class Accuracy { Full, High, Fast };
+
+double norm_pdf(double x);
+double norm_cdf(double x, Accuracy acc = Accuracy::Full);
+// p outside (0, 1) maps to -inf / +inf, NaN stays NaN
+double norm_inv_cdf(double p, Accuracy acc = Accuracy::Full);
+// log Phi(x), accurate into the far left tail where Phi itself underflows
+double norm_log_cdf(double x);
+
+// Batch forms; out must be at least as long as x / p (may alias the input)
+void norm_pdf(std::span<const double> x, std::span<double> out);
+void norm_cdf(std::span<const double> x, std::span<double> out, Accuracy acc = Accuracy::Full);
+void norm_inv_cdf(std::span<const double> p, std::span<double> out, Accuracy acc = Accuracy::Full);
+
+} // namespace vol::math
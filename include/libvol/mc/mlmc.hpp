@@ -0,0 +1,61 @@
+#pragma once
+#include "libvol/math/special.hpp"
+#include "libvol/mc/path.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace vol::mc {
+
+// Multilevel Monte Carlo (Giles 2008) for a path payoff under any Discretisation.
+//
+// Level l simulates base_steps * 2^l steps. Its sample is P_fine - P_coarse, with the coarse
+// path (half the steps) driven by the pairwise sums of the fine path's normals, so the
+// telescoping sum of level means is the finest level's expectation while the level
+// variances decay with the step size. Samples per level follow N_l ~ sqrt(V_l / C_l) from
+// the running variance estimates, splitting eps^2 evenly between variance and squared bias.
+// Levels are added until the bias estimate max(|Y_L|, |Y_{L-1}| / 2^alpha) / (2^alpha - 1)
+// falls below eps / sqrt(2); at L = 1 the Y_0 term (the level-0 price itself) is left out.
+// The cost is O(eps^-2) when the level variance decays faster than the cost grows
+// (beta > 1), against O(eps^-3) for plain MC with an Euler-type grid.
+//
+// Samples are drawn in fixed chunks, each with its own SplitMix stream keyed by (seed,
+// level, chunk). Chunks of every level that needs samples in a round run in parallel on a
+// util::ThreadPool kept for the whole run and are summed in chunk order, so the result is
+// bit-identical for any thread count.
+struct MLMCConfig {
+    double eps = 1e-2;             // target root-mean-square error
+    int base_steps = 1;            // steps at level 0
+    int min_levels = 3;            // levels 0 .. min_levels - 1 always run
+    int max_levels = 12;           // gives up (converged = false) beyond this
+    std::uint64_t pilot = 2000;    // first samples on a new level
+    double alpha = 0.0;            // weak order; 0: fitted to the level means (at least 0.5)
+    std::uint64_t seed = 1;
+    int n_threads = 0;             // 0: hardware concurrency
+    vol::math::Accuracy accuracy = vol::math::Accuracy::Full; // inverse-CDF tier for the normals
+};
+
+struct MLMCLevel {
+    int steps;                     // fine steps
+    std::uint64_t samples;
+    double mean;                   // E[P_l - P_{l-1}] (discounted)
+    double var;                    // V[P_l - P_{l-1}]
+    double var_fine;               // V[P_l], for the plain MC comparison
+    double cost;                   // steps simulated per sample (fine + coarse)
+};
+
+struct MLMCResult {
+    double price;
+    double std_err;                // sampling error only
+    double bias;                   // estimated discretisation bias of the finest level
+    double cost;                   // total steps simulated
+    double mc_cost;                // plain MC cost for the same eps on the finest grid
+    bool converged;                // bias and variance targets met within max_levels
+    std::vector<MLMCLevel> levels;
+};
+
+// Throws std::invalid_argument on eps <= 0, base_steps < 1, min_levels < 2,
+// max_levels < min_levels, pilot < 2, T <= 0, or an empty payoff or step
+MLMCResult mlmc(const Discretisation& model, const PathPayoff& payoff, double T, const MLMCConfig& cfg = {});
+
+} // namespace vol::mc
@@ -0,0 +1,70 @@
+#pragma once
+#include "libvol/models/heston.hpp"
+
+#include <functional>
+#include <span>
+
+namespace vol::mc {
+
+// One simulated path on a uniform grid of n steps over [0, T]
+struct PathView {
+    std::span<const double> S;     // S(t_0) ... S(t_n)
+    std::span<const double> var;   // integrated variance of log S over each step (n values)
+    double T;
+};
+
+// Undiscounted payoff of one path. Evaluated concurrently from several threads, so it must
+// not mutate shared state.
+using PathPayoff = std::function<double(const PathView&)>;
+
+// Continuous: the average is the trapezoid rule over all n + 1 grid points, and barriers
+//             are crossed between grid points with the Brownian-bridge probability
+//             exp(-2 ln(B / S_i) ln(B / S_{i+1}) / var_i), taken from PathView::var, so coarse
+//             grids stay accurate. A knock-out pays the vanilla times the survival probability.
+// Discrete:   fixings / barrier checks on the grid dates t_1 ... t_n (the grid is the schedule)
+enum class Monitoring { Continuous, Discrete };
+
+PathPayoff asian_arithmetic(double K, bool is_call, Monitoring m = Monitoring::Continuous);
+PathPayoff asian_geometric(double K, bool is_call, Monitoring m = Monitoring::Continuous);
+
+// Closed-form GBM price of asian_geometric on an n-step grid (the geometric average is
+// log-normal for either monitoring), for use as a control variate in path_mc
+double asian_geometric_gbm(double S, double K, double r, double q, double T, double vol, int steps,
+                           bool is_call, Monitoring m = Monitoring::Continuous);
+
+enum class Barrier { UpOut, DownOut, UpIn, DownIn };
+
+// Vanilla on S(T), knocked out (in) if the path touches B
+PathPayoff barrier(double K, bool is_call, double B, Barrier type, Monitoring m = Monitoring::Continuous);
+
+// Lookbacks take the extrema over the grid points t_0 ... t_n.
+// Floating strike: S(T) - min S (call) or max S - S(T) (put)
+PathPayoff lookback_floating(bool is_call);
+// Fixed strike: (max S - K)+ (call) or (K - min S)+ (put)
+PathPayoff lookback_fixed(double K, bool is_call);
+
+// A time discretisation of the spot (and, for stochastic vol, variance) dynamics.
+// step advances (S, v) by dt using `normals` independent N(0, 1) draws from z and returns
+// the step's integrated variance of log S. The multilevel driver couples a coarse step to
+// two fine ones by feeding it (z_a + z_b) / sqrt(2), so a scheme must be driven by normals
+// only (inverse-CDF them for anything else). Must be thread-safe.
+struct Discretisation {
+    double S0 = 100.0;
+    double v0 = 0.0;   // initial variance (unused by GBM)
+    double r = 0.0;    // discount rate
+    int normals = 1;
+    std::function<double(double& S, double& v, double dt, const double* z)> step;
+};
+
+// Exact log-normal step; one normal per step
+Discretisation gbm_exact(double S, double r, double q, double vol);
+
+// Heston, log-Euler with full truncation of v; two normals per step
+Discretisation heston_euler(double S, double r, double q, const heston::Params& p);
+
+// Heston, Andersen's quadratic-exponential variance step (psi_c = 1.5, the uniform of the
+// exponential branch taken as Phi(z)) with the matching central log-spot step; two normals
+// per step. No martingale correction. Throws std::invalid_argument unless kappa, sigma > 0.
+Discretisation heston_qe(double S, double r, double q, const heston::Params& p);
+
+} // namespace vol::mc
@@ -0,0 +1,41 @@
+#pragma once
+#include "libvol/math/special.hpp"
+#include "libvol/mc/gbm.hpp"
+#include "libvol/mc/path.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vol::mc {
+
+// Single-level path Monte Carlo for several payoffs over one shared set of paths.
+//
+// Paths are never stored in full: they are simulated a block at a time into a buffer of
+// about block_bytes (antithetic pairs, the second leg on the negated normals), every payoff
+// is evaluated over the block while it is in cache, and only running co-moments survive.
+// Each block draws from its own counter-based stream keyed by (seed, block) and blocks are
+// merged in order, so prices are bit-identical for any thread count (block_bytes fixes how
+// pairs map to streams, so changing it reseeds).
+//
+// With a control, each payoff is regressed on it with its own beta (as in
+// european_vanilla_gbm). Under GBM, asian_geometric with asian_geometric_gbm as its price is
+// the natural control for Asians and works for barriers and lookbacks on the same underlying.
+struct PathMCConfig {
+    int steps = 64;                       // uniform grid over [0, T]
+    std::uint64_t paths = 100000;         // rounded up to whole antithetic pairs
+    std::uint64_t seed = 42;
+    int n_threads = 0;                    // 0: hardware concurrency
+    vol::math::Accuracy accuracy = vol::math::Accuracy::Full; // inverse-CDF tier for the normals
+    std::size_t block_bytes = 256 * 1024; // per block: normals, S, var and payoff values
+    PathPayoff control;                   // optional control variate ...
+    double control_price = 0.0;           // ... and its known discounted price
+};
+
+// One MCResult (price, std_err, paths; greeks left zero) per payoff, discounted at model.r.
+// Throws std::invalid_argument on steps < 1, paths == 0, T <= 0, an empty payoff or step.
+std::vector<MCResult> path_mc(const Discretisation& model, std::span<const PathPayoff> payoffs, double T,
+                              const PathMCConfig& cfg = {});
+
+} // namespace vol::mc
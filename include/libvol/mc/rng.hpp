@@ -0,0 +1,34 @@
+#pragma once
+#include "libvol/math/special.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace vol::mc {
+
+// splitmix64 finaliser
+inline std::uint64_t mix64(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// splitmix64 stream. stream(seed, key) gives every (seed, key) its own reproducible
+// sequence, so work split into keyed chunks draws the same numbers on any thread count.
+struct SplitMix {
+    std::uint64_t s;
+
+    static SplitMix stream(std::uint64_t seed, std::uint64_t key) { return {mix64(seed ^ mix64(key))}; }
+
+    std::uint64_t next() { return mix64(s += 0x9E3779B97F4A7C15ull); }
+    // uniform on the open interval (0, 1), from the top 53 bits
+    double uniform() { return (static_cast<double>(next() >> 11) + 0.5) * 0x1.0p-53; }
+
+    // Fills z with N(0, 1) draws: uniforms through the batch inverse CDF
+    void normals(std::span<double> z, vol::math::Accuracy acc) {
+        for (double& u : z) u = uniform();
+        vol::math::norm_inv_cdf(z, z, acc);
+    }
+};
+
+} // namespace vol::mc
@@ -0,0 +1,58 @@
+#pragma once
+#include "libvol/core/chain.hpp"
+#include "libvol/models/american_scheme.hpp"
+#include "libvol/models/binom.hpp"
+#include "libvol/models/black_scholes.hpp"
+
+#include <span>
+
+// American vanilla options by spectral collocation of the early-exercise boundary
+// (Andersen, Lake & Offengenden, "High-performance American option pricing", 2016).
+//
+// The put boundary B(tau) is the fixed point of an integral equation in time to expiry.
+// It is represented as a Chebyshev interpolant of H(xi) = log(B(xi^2) / X)^2 in
+// xi = sqrt(tau), which is smooth where B itself has a square-root kink at expiry
+// (X = K min(1, r / q) is the boundary at expiry). Each fixed-point iteration evaluates
+// the equation at the Chebyshev nodes with Gauss-Legendre quadrature, and the price is the
+// European value plus the early-exercise premium integrated over the converged boundary.
+// Calls are priced as puts through put-call symmetry C(S, K, r, q) = P(K, S, q, r).
+namespace vol::american {
+
+// Same result type as the binomial tree. theta is per year of calendar time (dV/dt, as in
+// bs::price_greeks), whereas binom::price_greeks reports the maturity derivative dV/dT.
+using PriceGreeks = binom::PriceGreeks;
+
+// Early exercise is only optimal for puts with r > 0 (calls with q > 0); outside that
+// range the European price is returned, except for the double-boundary regime q < r < 0
+// (puts), which falls back to the CRR tree. T <= 0 or vol <= 0 gives intrinsic value.
+// Throws std::invalid_argument for schemes outside nodes in [2, 64] or non-positive orders.
+double price(double S, double K, double r, double q, double T, double vol, bool is_call,
+             const Scheme& scheme = ACCURATE);
+
+// Delta and gamma are exact derivatives of the premium integral (the boundary does not
+// depend on spot), theta follows from the pricing PDE, vega and rho are central
+// differences of full re-solves.
+PriceGreeks price_greeks(double S, double K, double r, double q, double T, double vol, bool is_call,
+                         const Scheme& scheme = ACCURATE);
+
+// Early-exercise boundary at time to expiry tau in [0, T] (spot level; exercise below it
+// for puts, above it for calls). NaN when early exercise is never optimal.
+double exercise_boundary(double K, double r, double q, double T, double vol, bool is_call, double tau,
+                         const Scheme& scheme = ACCURATE);
+
+// Implied vol from an American price. The start is the European IV of the price, corrected by
+// one Newton step on the American price with the BS vega (the early-exercise premium barely
+// moves with vol), then secant steps on the American price inside a bracket that every
+// evaluation tightens, with Brent as the fallback; each step costs one price() solve, and the
+// scheme tables and quadrature scratch are shared by all of them. Quotes without early
+// exercise go straight to bs::implied_vol. NaN / converged = false outside
+// (intrinsic, S) for calls and (intrinsic, K) for puts; a price at intrinsic gives iv = 0.
+bs::IVResult implied_vol(double S, double K, double r, double q, double T, double price, bool is_call,
+                         const Scheme& scheme = ACCURATE, double tol = 1e-10);
+
+// Whole chain, split over n_threads workers (<= 0: hardware concurrency); out must have
+// chain.size() elements.
+void implied_vol(const Chain& chain, std::span<const double> prices, std::span<bs::IVResult> out,
+                 const Scheme& scheme = ACCURATE, int n_threads = 1, double tol = 1e-10);
+
+} // namespace vol::american
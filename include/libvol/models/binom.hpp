@@ -17,4 +17,24 @@ namespace vol::binom {
 
     BinomialResult price_w_info(double S, double K, double r, double q, double T, double vol, int steps, bool is_call, bool is_american);
 
+    // Tiled multi-threaded backward induction for very large trees (10^4 - 10^5 steps).
+    // Each band of `layers` time layers is split into tiles of `block` nodes. Every tile first
+    // runs the whole band on its own nodes, its valid range shrinking by one node per layer
+    // (a trapezoid, all tiles in parallel); then each tile fills the triangle left at its right
+    // edge from the edge column recorded by its neighbour. A tile's V and S stay in L1/L2 for
+    // the whole band instead of streaming the full layer once per step. Node updates are the
+    // same expressions in the same order as price / price_w_info, so results (price and
+    // early_exercise_step) are bit-identical for any thread count or tile shape.
+    struct LatticeConfig {
+        int n_threads = 0;   // 0: hardware concurrency
+        int block = 4096;    // nodes per tile
+        int layers = 256;    // time layers per band (clamped to block)
+    };
+
+    // Throw std::invalid_argument if block or layers is not positive
+    double price_parallel(double S, double K, double r, double q, double T, double vol, int steps, bool is_call, bool is_american,
+                          const LatticeConfig& cfg = {});
+    BinomialResult price_w_info_parallel(double S, double K, double r, double q, double T, double vol, int steps, bool is_call, bool is_american,
+                                         const LatticeConfig& cfg = {});
+
 } // namespace vol::binom
@@ -1,4 +1,7 @@
 #pragma once
+#include "libvol/core/chain.hpp"
+#include "libvol/math/adjoint_fwd.hpp"
+#include <span>
 #include <tuple>
 
 
@@ -16,7 +19,24 @@ double Phi(double x);
 double price(double S,double K,double r,double q,double T,double vol,bool is_call);
 PriceGreeks price_greeks(double S,double K,double r,double q,double T,double vol,bool is_call);
 
+// Same price on tape types (math/adjoint.hpp): a book valued through it gets every input
+// sensitivity, of every quote, from one reverse sweep
+ad::Var price(const ad::Var& S,const ad::Var& K,const ad::Var& r,const ad::Var& q,const ad::Var& T,
+const ad::Var& vol,bool is_call);
+
 struct IVResult { double iv; int newton_iters; int brent_iters; bool converged; };
 IVResult implied_vol(double S,double K,double r,double q,double T,double price,bool is_call,
 double init=0.2, double tol=1e-10);
+
+// Chain overloads: S, r, q, T come precomputed in the ExpiryContext and k = log(K / F) per
+// strike (see make_chain), so a price costs the two Phi calls and nothing else.
+double price(const ExpiryContext& ex, double K, double k, double vol, bool is_call);
+PriceGreeks price_greeks(const ExpiryContext& ex, double K, double k, double vol, bool is_call);
+IVResult implied_vol(const ExpiryContext& ex, double K, double k, double price, bool is_call,
+double init=0.2, double tol=1e-10);
+
+// Whole-chain forms; out must have chain.size() elements
+void price(const Chain& chain, std::span<const double> vols, std::span<double> out);
+void implied_vol(const Chain& chain, std::span<const double> prices, std::span<IVResult> out,
+double init=0.2, double tol=1e-10);
 } // namespace vol::bs
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#include "libvol/models/binom.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <span>
+
+// 1-D finite-difference pricing of vanillas under Black-Scholes or local vol.
+//
+// The PDE is solved for v(x, tau) = V / K in moneyness x = S / K, backwards from expiry, on a
+// grid x_i = 1 + c sinh(xi_i) with uniform xi: nodes cluster at the strike (c sets how
+// tightly) and thin out into the tails, which end `width` standard deviations past the
+// spots. Crank-Nicolson in time, with the first steps replaced by implicit Euler half
+// steps (Rannacher) to damp the payoff kink. Early exercise is either Brennan-Schwartz
+// (projection inside the tridiagonal solve, exact for a single exercise boundary) or
+// projected SOR.
+//
+// Greeks are read off the grid: delta and gamma from the solution at the spot, theta from
+// the last three time levels; vega and rho are central differences of full re-solves.
+namespace vol::fd {
+
+// Same result type as the binomial tree; theta is calendar dV/dt (as in bs::price_greeks).
+using PriceGreeks = binom::PriceGreeks;
+
+enum class AmericanSolver { BrennanSchwartz, PSOR };
+
+struct Config {
+    int space_steps = 200;
+    int time_steps = 100;
+    int rannacher_steps = 2;     // CN steps replaced by two implicit Euler half steps each
+    double concentration = 0.1;  // c in x = 1 + c sinh(xi); smaller clusters harder at the strike
+    double width = 5.0;          // grid half-width in standard deviations of log(S)
+    AmericanSolver american = AmericanSolver::BrennanSchwartz;
+    double psor_omega = 1.2;
+    double psor_tol = 1e-10;
+    int psor_max_iters = 500;
+};
+
+// Local volatility sigma(S, t) with t in calendar years from today
+using LocalVol = std::function<double(double S, double t)>;
+
+// Throws std::invalid_argument for S, K, T or vol <= 0 or a grid below 3 x 1 steps.
+double price(double S, double K, double r, double q, double T, double vol, bool is_call, bool is_american,
+             const Config& cfg = {});
+PriceGreeks price_greeks(double S, double K, double r, double q, double T, double vol, bool is_call,
+                         bool is_american, const Config& cfg = {});
+
+// Same under a local-vol surface; vega is the response to a parallel shift of sigma(S, t).
+PriceGreeks price_greeks(double S, double K, double r, double q, double T, const LocalVol& local_vol,
+                         bool is_call, bool is_american, const Config& cfg = {});
+
+// One expiry, many strikes, each with its own vol (e.g. a smile of implied vols): the
+// strikes share one moneyness grid and step in lockstep, with the tridiagonal solves of all
+// strikes interleaved so the inner loops run across strikes and vectorise. out must have
+// K.size() elements.
+void price_greeks_batch(double S, double r, double q, double T, std::span<const double> K,
+                        std::span<const double> vols, std::span<const std::uint8_t> is_call, bool is_american,
+                        std::span<PriceGreeks> out, const Config& cfg = {});
+
+} // namespace vol::fd
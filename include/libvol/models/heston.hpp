@@ -1,6 +1,9 @@
 #pragma once
 
+#include "libvol/core/types.hpp"
+
 #include <cstddef>
+#include <vector>
 
 namespace vol::heston {
 
@@ -23,4 +26,80 @@ double price_cf(double S,
                 bool is_call,
                 int n_gl = 64);
 
+// Error-controlled alternative to the fixed-order rule above. The half line is mapped onto
+// [0, 1) with a scale taken from the large-u decay rate of the characteristic function,
+// then integrated with nested Clenshaw-Curtis rules (9, 17, 33, ... points) until the
+// estimated error is below tol (absolute, in price units) or max_nodes is reached.
+struct AdaptiveConfig {
+    double tol = 1e-6;
+    int max_nodes = 513;
+};
+
+struct CFResult {
+    double price;
+    double error_estimate;
+    int nodes; // integrand evaluations (each is two CF evaluations, like one GL node)
+};
+
+CFResult price_cf_adaptive(double S,
+                           double K,
+                           double r,
+                           double q,
+                           double T,
+                           const Params& params,
+                           bool is_call,
+                           const AdaptiveConfig& cfg = {});
+
+// Single-integral pricer on a shifted contour (Lord-Kahl). The damping alpha is chosen per
+// option to minimise the integrand at u = 0 (bounded by the moment explosion time), and the
+// Black-Scholes characteristic function with the Heston expected total variance is subtracted
+// as a control variate, so what is left to integrate is a small, fast-decaying residual.
+// n_nodes is the Gauss-Laguerre order. Each node costs one CF evaluation (price_cf needs two),
+// plus ~14 real-argument evaluations for the alpha search: ~46 at the default 32 nodes against
+// 128 for GL64. Measured max abs error on a 1M..2Y, 80..120% surface (calm and stressed
+// parameters): 1.6e-5 at 20 nodes, 3e-6 at 24, 7.5e-8 at 32 (GL64: 2.5e-7), 2e-8 at 40.
+// Short-dated deep-OTM calls stay below 1e-9 at 32 nodes, where GL64 is off by up to 6e-7.
+// Extreme parameters (sigma ~ 1, rho ~ -0.9, tenors under 3M) can leave ~1e-5: the control
+// variate is far from the Heston smile there; use price_cf_adaptive for those.
+double price_cf_damped(double S,
+                       double K,
+                       double r,
+                       double q,
+                       double T,
+                       const Params& params,
+                       bool is_call,
+                       int n_nodes = 32);
+
+// price_cf with every first-order sensitivity from one reverse sweep of an adjoint tape
+// (math/adjoint.hpp), about 2x the cost of the price itself; central bumps of all ten
+// inputs would cost 20 prices. Same quadrature, so the price matches price_cf to rounding.
+struct Sensitivities {
+    double price;
+    double delta;   // dV/dS
+    double dK;      // dV/dK
+    double rho;     // dV/dr
+    double dq;      // dV/dq
+    double theta;   // -dV/dT, calendar decay as in bs::price_greeks
+    Params d_params; // dV/dkappa, dV/dtheta, dV/dsigma, dV/drho, dV/dv0
+};
+
+Sensitivities price_cf_sensitivities(double S,
+                                     double K,
+                                     double r,
+                                     double q,
+                                     double T,
+                                     const Params& params,
+                                     bool is_call,
+                                     int n_gl = 64);
+
+// Calibration objective f = 0.5 sum_i w_i (price_cf(opts[i], p) - mids[i])^2 (weights
+// empty = all ones). With grad non-null it also returns df/dp, exact up to the quadrature,
+// one adjoint sweep per quote: ready for calib::lbfgsb without finite differences.
+double calibration_objective(const std::vector<OptionSpec>& opts,
+                             const std::vector<double>& mids,
+                             const std::vector<double>& weights,
+                             const Params& p,
+                             Params* grad = nullptr,
+                             int n_gl = 64);
+
 } // namespace vol::heston
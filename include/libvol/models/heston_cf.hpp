@@ -0,0 +1,27 @@
+#pragma once
+
+#include "libvol/models/heston.hpp"
+
+#include <cstddef>
+
+namespace vol::heston {
+
+// Batch Heston characteristic function, structure-of-arrays layout.
+// For j < n, with u_j = u_re[j] + i u_im[j], writes
+//   phi(u_j) = E[exp(i u_j ln S_T)],  ln S_T centred on logS + drift,
+// to phi_re[j] / phi_im[j], using the "little trap" form (Albrecher et al.), so it is
+// continuous in u without branch tracking. Same formula as the scalar helper behind
+// price_cf, but written on plain doubles so the node loop has no std::complex
+// NaN/inf recovery paths and can be vectorised (see VOL_ENABLE_SIMD in CMakeLists.txt).
+// Output arrays may not alias the inputs.
+void characteristic_batch(const double* u_re,
+                          const double* u_im,
+                          std::size_t n,
+                          double logS,
+                          double drift,
+                          double T,
+                          const Params& params,
+                          double* phi_re,
+                          double* phi_im);
+
+} // namespace vol::heston
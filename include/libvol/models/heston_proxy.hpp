@@ -0,0 +1,136 @@
+#pragma once
+
+#include "libvol/core/types.hpp"
+#include "libvol/models/heston.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vol::heston {
+
+// Chebyshev tensor proxy for price_cf over a box in (K/S, T, kappa, theta, sigma, rho, v0).
+//
+// Any subset of the seven inputs can be interpolated; the rest are pinned to the values in
+// ProxyConfig. The proxy stores the coefficients of the tensor Chebyshev series through
+// the first-kind points of every axis, built offline from price_cf at each node (spread
+// over std::threads), and is saved to / loaded from a versioned binary file. Prices are
+// interpolated at S = 1 and scaled by spot (the Heston price is homogeneous in S and K),
+// so one proxy serves every spot for the fixed r and q.
+//
+// Evaluation contracts the coefficient tensor one axis at a time, outermost first, against
+// the Chebyshev basis at the point: an O(nodes) sweep of axpys over contiguous rows
+// (OpenMP-SIMD under VOL_ENABLE_SIMD). For calibration, bind() contracts the five
+// model-parameter axes once per parameter vector, leaving a small (K/S, T) tensor that each
+// quote evaluates in O(n_moneyness * n_T): the coarse stage then costs one tensor sweep per
+// objective call instead of one Fourier integral per quote, and the exact
+// calibration_objective polishes from its minimum.
+//
+// Accuracy is checked, not assumed: build() compares the proxy with price_cf at
+// check_points random points of the box and reports the largest error, alongside the
+// coefficient tail (the magnitude of the highest-degree coefficients along each axis, the
+// usual a-posteriori estimate of the truncation error). error_bound() is the larger of
+// the two; check() repeats the comparison on a fresh sample at any time.
+enum class ProxyDim : std::uint32_t { Moneyness, T, Kappa, Theta, Sigma, Rho, V0, COUNT };
+
+inline constexpr std::size_t N_PROXY_DIMS = static_cast<std::size_t>(ProxyDim::COUNT);
+inline constexpr std::uint32_t PROXY_FILE_VERSION = 1;
+
+struct ProxyAxis {
+    ProxyDim dim;
+    double lo;
+    double hi;
+    int nodes;      // Chebyshev points (polynomial degree nodes - 1), 2..256
+};
+
+struct ProxyConfig {
+    std::vector<ProxyAxis> axes;   // interpolated inputs, each at most once, in storage order
+    // Pinned values of the inputs that are not on an axis
+    double moneyness = 1.0;        // K / S
+    double T = 1.0;
+    Params params{1.5, 0.04, 0.5, -0.7, 0.04};
+    double r = 0.0;
+    double q = 0.0;
+    bool is_call = true;
+    int n_gl = 128;                // price_cf order at the nodes and in the checks
+    int check_points = 1000;       // random validation points in build(); 0 skips the check
+    std::uint64_t seed = 42;
+    int n_threads = 0;             // 0: hardware concurrency
+};
+
+struct ProxyCheck {
+    double max_abs_error;          // price units at S = 1
+    double rms_error;
+    int points;
+};
+
+class ChebyshevProxy {
+public:
+    ChebyshevProxy() = default;   // empty; see build() and load()
+
+    // Throws std::invalid_argument on an empty or repeated axis, lo >= hi, a node count
+    // outside 2..256, or a box that leaves the model's domain (K/S, T or sigma <= 0,
+    // |rho| > 1, negative kappa, theta or v0).
+    static ChebyshevProxy build(const ProxyConfig& cfg);
+
+    // Versioned binary file (magic "VOLCHEB\0", config, error statistics, coefficients and
+    // a checksum); load() throws std::runtime_error on a missing, truncated or corrupt file
+    void save(const std::string& path) const;
+    static ChebyshevProxy load(const std::string& path);
+
+    // True if (K/S, T, params) lies in the box and matches every pinned input
+    bool contains(double moneyness, double T, const Params& params) const;
+
+    // Interpolated price; inputs outside the proxy's domain (see contains) fall back to
+    // price_cf with the configured r, q, option type and order
+    double price(double S, double K, double T, const Params& params) const;
+
+    // Proxy with the model-parameter axes contracted at params: a (K/S, T) tensor, or a
+    // scalar series if neither is on an axis. Parameters off the box are clamped to it.
+    ChebyshevProxy bind(const Params& params) const;
+
+    // Same, with the parameter gradient of the interpolant: grad[i] is bind() with the
+    // basis of parameter axis i differentiated (zero proxy for pinned parameters)
+    ChebyshevProxy bind(const Params& params, ChebyshevProxy (&grad)[5]) const;
+
+    // Fresh comparison with price_cf at n random points of the box
+    ProxyCheck check(int n, std::uint64_t seed) const;
+
+    const ProxyConfig& config() const { return cfg_; }
+    std::size_t nodes() const { return coeffs_.size(); }
+    double max_abs_error() const { return check_.max_abs_error; }
+    double rms_error() const { return check_.rms_error; }
+    double tail_estimate() const { return tail_; }
+    double error_bound() const { return check_.max_abs_error > tail_ ? check_.max_abs_error : tail_; }
+    double build_seconds() const { return build_seconds_; }
+
+private:
+    double evaluate(const double* x) const;     // x: one value per axis, in axis order
+    ChebyshevProxy contract(const Params& params, ChebyshevProxy* grad) const;
+    double tail() const;
+
+    ProxyConfig cfg_;
+    std::vector<double> coeffs_;                // row-major, last axis fastest
+    ProxyCheck check_{0.0, 0.0, 0};
+    double tail_ = 0.0;
+    double build_seconds_ = 0.0;
+};
+
+// calibration_objective with the prices taken from the proxy: each call binds the proxy
+// at p once (with the derivative tensors of the interpolant carried along when grad is
+// non-null, ~3x the cost of the value) and evaluates every quote on the small bound
+// tensor. The objective is taken at p projected onto the proxy's parameter box (axis
+// parameters clamped, pinned parameters at their pinned values), and the gradient is that of
+// the projected objective: zero in every coordinate the clamp moved, so f and grad stay
+// consistent for a bounded optimiser stepping past the box. Throws std::invalid_argument if
+// a quote's K/S or T lies off the proxy's axes (or differs from a pinned value), or its r, q
+// or option type differs from the proxy's.
+double calibration_objective(const ChebyshevProxy& proxy,
+                             const std::vector<OptionSpec>& opts,
+                             const std::vector<double>& mids,
+                             const std::vector<double>& weights,
+                             const Params& p,
+                             Params* grad = nullptr);
+
+} // namespace vol::heston
@@ -1,7 +1,12 @@
 #pragma once
 #include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
 #include <vector>
 
+#include "libvol/math/adjoint_fwd.hpp"
+
 
 namespace vol::svi {
 using Params = std::array<double,5>;
@@ -9,7 +14,42 @@ using Params = std::array<double,5>;
 
 double total_variance(double k, const Params& p);
 
+// Raw SVI w(k) = a + b (rho (k - m) + sqrt((k - m)^2 + sigma^2)) on any floating type or
+// ad::Var (include math/adjoint.hpp for that); total_variance(k, Params) is the double
+// instantiation. In float the relative error is < 4 ulp (~5e-7) as long as w is not a
+// small difference of large terms (a << 0).
+template <ad::Scalar Real>
+inline Real total_variance(Real k, Real a, Real b, Real rho, Real m, Real sigma) {
+    using std::sqrt;
+    const Real x = k - m;
+    return a + b * (rho * x + sqrt(x * x + sigma * sigma));
+}
+
+// out[i] = w(k[i]) for i < n, parameters rounded to Real once; float and double instantiated
+template <std::floating_point Real>
+void total_variance_batch(const Real* k, std::size_t n, const Params& p, Real* out);
+
+extern template void total_variance_batch<float>(const float*, std::size_t, const Params&, float*);
+extern template void total_variance_batch<double>(const double*, std::size_t, const Params&, double*);
+
 bool basic_no_arb(const Params& p);
 
 Params fit_raw_svi(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts);
+
+// Outcome of one slice fit, with the diagnostics needed to judge or restart it
+struct FitResult {
+    Params params;
+    double rmse;     // weighted RMS total-variance residual; NaN below 5 points (heuristic, no solve)
+    int iterations;  // optimizer iterations over all starts
+    int n_points;
+    bool converged;  // false: no start converged and params are the clamped heuristic start
+};
+
+FitResult fit_raw_svi_report(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts);
+
+// One local solve from start (e.g. the previous session's params, clamped into the data
+// bounds), keeping its best admissible iterate; the cold multi-start fit if start is not
+// admissible or there are fewer than 5 points.
+FitResult fit_raw_svi_warm(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts,
+                           const Params& start);
 }
\ No newline at end of file
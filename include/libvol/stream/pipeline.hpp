@@ -0,0 +1,120 @@
+#pragma once
+
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/models/svi.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace vol::stream {
+
+// Streaming calibration: quotes in, refitted SVI slices out.
+//
+//   submit() --MPSC--> IV stage --SPSC--> fit stage --SPSC--> publish stage --> Config::publish
+//
+// The IV stage inverts each quote once (bs::implied_vol, or american::implied_vol under
+// slice.american), drops the ones with no implied vol, and keeps the latest quote per
+// (expiry, strike, call/put) in a per-expiry book as its svi::slice_point (log-moneyness,
+// total variance, weight). An expiry that has ticked is dirty; it is snapshotted into one
+// fit job once no fit of it is in flight and min_refit_interval has passed since its last
+// job, so a burst of ticks on one expiry costs one refit and quiet expiries cost nothing.
+// The fit stage runs svi::calibrate_slice_variance on the snapshot (no prices are inverted
+// again), the publish stage hands the result to the callback. Each stage is one thread.
+//
+// A book with fewer than slice.min_points quotes is not fitted. If the expiry had a fit
+// out, the pipeline publishes an invalidation (SliceUpdate::valid = false) instead, so a
+// consumer never keeps params for a slice whose quotes were withdrawn.
+
+// Steady-clock nanoseconds, the time base of Quote::t_ns and SliceUpdate
+std::uint64_t now_ns();
+
+struct Quote {
+    std::uint32_t expiry;   // index into Config::expiries
+    double K;
+    double mid;             // <= 0 withdraws the quote
+    double spot;
+    bool is_call;
+    std::uint64_t t_ns;     // tick time, now_ns() at the source
+};
+
+struct Expiry {
+    double T, r, q;
+};
+
+struct SliceUpdate {
+    std::uint32_t expiry;
+    double T;
+    svi::Params params;            // NaN when !valid
+    bool valid;                    // false: the book fell below min_points, drop this expiry
+    std::uint64_t version;         // 1, 2, ... per expiry, invalidations included
+    std::size_t quotes;            // book size the fit (or invalidation) saw
+    std::size_t ticks;             // ticks absorbed since the previous fit
+    std::uint64_t first_tick_ns;   // oldest of those ticks: tick-to-surface latency is
+    std::uint64_t last_tick_ns;    // published_ns - first_tick_ns
+    std::uint64_t published_ns;
+};
+
+enum class Backpressure {
+    Block,    // submit() waits for room in the ingest ring
+    Reject,   // submit() returns false and the quote is counted as dropped
+};
+
+struct Config {
+    std::vector<Expiry> expiries;
+    std::function<void(const SliceUpdate&)> publish;   // called on the publish thread
+    std::chrono::microseconds min_refit_interval{1000};
+    std::function<std::uint64_t()> clock;              // nanoseconds behind min_refit_interval;
+                                                       // empty: now_ns (tests drive it by hand)
+    std::size_t ingest_capacity = 1 << 14;
+    std::size_t fit_capacity = 64;
+    std::size_t publish_capacity = 64;
+    Backpressure backpressure = Backpressure::Block;
+    svi::SliceConfig slice{};
+};
+
+struct Stats {
+    std::uint64_t submitted = 0;   // accepted by submit(), counting calls still pushing
+    std::uint64_t dropped = 0;     // refused by submit() under Backpressure::Reject
+    std::uint64_t ingested = 0;    // through the IV stage (books updated or quote rejected)
+    std::uint64_t rejected = 0;    // no implied vol, never reached a book
+    std::uint64_t fits = 0;
+    std::uint64_t fit_failures = 0;
+    std::uint64_t invalidations = 0;   // thin-book SliceUpdates with valid = false
+    std::uint64_t published = 0;       // fits plus invalidations
+    std::uint64_t blocked_submits = 0;   // submit() calls that found the ingest ring full
+};
+
+class Pipeline {
+public:
+    // Starts the three stage threads. Throws std::invalid_argument on an empty expiry
+    // list, a missing publish callback or a non-positive T.
+    explicit Pipeline(Config cfg);
+    ~Pipeline();
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    // Thread-safe. False if the quote was dropped (Reject policy with a full ring) or the
+    // pipeline is stopped; throws std::invalid_argument on an unknown expiry index.
+    bool submit(const Quote& q);
+
+    // Waits until every quote submitted so far has gone through its IV inversion and every
+    // expiry it dirtied has been refit and published. Refits still honour
+    // min_refit_interval, so this can take up to that long.
+    void flush();
+
+    // Stops and joins the stages; work still queued is discarded. Idempotent.
+    void stop();
+
+    Stats stats() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace vol::stream
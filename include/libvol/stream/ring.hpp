@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace vol::stream {
+
+// Destructive interference size; std::hardware_destructive_interference_size is not
+// reliably available, and 64 bytes is right for x86-64 and most AArch64 parts.
+inline constexpr std::size_t CACHE_LINE = 64;
+
+// Bounded single-producer / single-consumer ring. Capacity is rounded up to a power of
+// two. Head and tail sit on their own cache lines, and each side keeps a cached copy of
+// the other's index, so the shared lines are touched only when the ring looks full or
+// empty.
+template <class T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t capacity)
+        : mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), slots_(new T[mask_ + 1]) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer side. Returns false (and leaves v untouched) when the ring is full.
+    template <class U>
+    bool try_push(U&& v) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ > mask_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ > mask_) return false;
+        }
+        slots_[tail & mask_] = std::forward<U>(v);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when the ring is empty.
+    bool try_pop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return false;
+        }
+        out = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+    // Exact only when neither side is running
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    const std::size_t mask_;
+    const std::unique_ptr<T[]> slots_;
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};
+    std::size_t tail_cache_ = 0;   // consumer's view of tail_
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+    std::size_t head_cache_ = 0;   // producer's view of head_
+};
+
+// Bounded multi-producer / single-consumer ring (Vyukov's sequence-numbered slots, with
+// the consumer side reduced to plain loads and stores). Producers claim a slot with one
+// CAS on the tail; a slot's sequence number says whether it is free, full or still being
+// written, so neither side ever waits on a lock.
+template <class T>
+class MpscRing {
+public:
+    explicit MpscRing(std::size_t capacity)
+        : mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), slots_(new Slot[mask_ + 1]) {
+        for (std::size_t i = 0; i <= mask_; ++i) slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Any thread. Returns false when the ring is full.
+    template <class U>
+    bool try_push(U&& v) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& s = slots_[tail & mask_];
+            const std::size_t seq = s.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - tail);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    s.value = std::forward<U>(v);
+                    s.seq.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;   // the consumer has not freed this slot yet: full
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Single consumer. Returns false when the ring is empty or the next slot is still
+    // being written.
+    bool try_pop(T& out) {
+        Slot& s = slots_[head_ & mask_];
+        if (s.seq.load(std::memory_order_acquire) != head_ + 1) return false;
+        out = std::move(s.value);
+        s.seq.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> seq;
+        T value;
+    };
+
+    const std::size_t mask_;
+    const std::unique_ptr<Slot[]> slots_;
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+    alignas(CACHE_LINE) std::size_t head_ = 0;
+};
+
+} // namespace vol::stream
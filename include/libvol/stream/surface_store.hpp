@@ -0,0 +1,144 @@
+#pragma once
+
+#include "libvol/models/svi.hpp"
+#include "libvol/stream/ring.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vol::stream {
+
+struct SurfaceSlice {
+    double T;
+    svi::Params params;
+};
+
+// Immutable once published: readers hold plain const pointers into it.
+struct Surface {
+    std::uint32_t underlying = 0;
+    std::uint64_t version = 0;       // 1, 2, ... per underlying
+    std::uint64_t published_ns = 0;  // now_ns() at publication
+    std::vector<SurfaceSlice> slices;   // sorted by T, distinct T
+
+    // w(k, T): SVI at the bracketing slices, linear in T between them; beyond the first /
+    // last slice the total variance scales with T. NaN for an empty surface.
+    double total_variance(double k, double T) const;
+};
+
+// Calibrated surfaces per underlying, published RCU-style.
+//
+// A writer builds a new Surface and swaps it in with one atomic pointer exchange; readers
+// load the pointer and use the snapshot with no lock and no reference count. The old
+// snapshot is retired and freed once no reader can still hold it, tracked with epochs:
+// a pinned reader announces the global epoch it started in, a retired surface records the
+// epoch it was unlinked in, and it is freed when every pinned reader started later.
+//
+// Readers: one Reader per thread (store.reader()), then reader.read(u) for a pinned
+// snapshot, two uncontended stores and a load. version(u) is a single atomic load for
+// cheap staleness checks. Writers serialise among themselves on a mutex readers never see.
+class SurfaceStore {
+    struct ReaderRecord {
+        alignas(CACHE_LINE) std::atomic<std::uint64_t> epoch{0};   // 0 = not reading
+        std::atomic<bool> in_use{false};
+    };
+
+public:
+    // Throws std::invalid_argument if either count is zero.
+    explicit SurfaceStore(std::size_t n_underlyings, std::size_t max_readers = 64);
+    ~SurfaceStore();
+
+    SurfaceStore(const SurfaceStore&) = delete;
+    SurfaceStore& operator=(const SurfaceStore&) = delete;
+
+    class Reader;
+
+    // Pinned snapshot of one underlying; keep it short-lived, reclamation waits for it.
+    // Null (operator bool false) until the underlying's first publish.
+    class Snapshot {
+    public:
+        Snapshot(Snapshot&& o) noexcept : reader_(std::exchange(o.reader_, nullptr)), surface_(o.surface_) {}
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        Snapshot& operator=(Snapshot&&) = delete;
+        ~Snapshot();
+
+        const Surface* get() const { return surface_; }
+        const Surface& operator*() const { return *surface_; }
+        const Surface* operator->() const { return surface_; }
+        explicit operator bool() const { return surface_ != nullptr; }
+
+    private:
+        friend class Reader;
+        Snapshot(Reader* r, const Surface* s) : reader_(r), surface_(s) {}
+        Reader* reader_;
+        const Surface* surface_;
+    };
+
+    // Per-thread read handle owning one reader slot. Snapshots from one Reader may nest.
+    class Reader {
+    public:
+        Reader(Reader&& o) noexcept
+            : store_(std::exchange(o.store_, nullptr)), record_(o.record_), depth_(std::exchange(o.depth_, 0)) {}
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+        ~Reader();
+
+        Snapshot read(std::uint32_t underlying);
+
+    private:
+        friend class SurfaceStore;
+        friend class Snapshot;
+        Reader(const SurfaceStore* store, ReaderRecord* record) : store_(store), record_(record) {}
+        void unpin();
+
+        const SurfaceStore* store_;
+        ReaderRecord* record_;
+        unsigned depth_ = 0;
+    };
+
+    // Throws std::runtime_error when all max_readers slots are taken.
+    Reader reader() const;
+
+    // Replaces the whole surface; slices are sorted by T here. Returns the new version.
+    std::uint64_t publish(std::uint32_t underlying, std::vector<SurfaceSlice> slices);
+    // Copy of the current surface with the slice at T replaced (or inserted): the shape of a
+    // stream::Pipeline publish callback. Returns the new version.
+    std::uint64_t publish_slice(std::uint32_t underlying, double T, const svi::Params& params);
+
+    // Latest published version, 0 before the first publish; lock- and pin-free
+    std::uint64_t version(std::uint32_t underlying) const {
+        return slots_[check(underlying)].version.load(std::memory_order_acquire);
+    }
+
+    std::size_t underlyings() const { return n_; }
+    // Retired surfaces not yet freed; reclaim() frees what no reader can still see
+    std::size_t pending_reclaim() const;
+    void reclaim();
+
+private:
+    struct alignas(CACHE_LINE) Slot {
+        std::atomic<const Surface*> current{nullptr};
+        std::atomic<std::uint64_t> version{0};
+    };
+
+    std::size_t check(std::uint32_t underlying) const;
+    std::uint64_t install(std::uint32_t underlying, std::unique_ptr<Surface> next);
+    void reclaim_locked();
+
+    std::size_t n_;
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t max_readers_;
+    std::unique_ptr<ReaderRecord[]> readers_;
+    alignas(CACHE_LINE) std::atomic<std::uint64_t> epoch_{1};
+
+    mutable std::mutex write_mutex_;
+    std::vector<std::pair<std::uint64_t, const Surface*>> retired_;   // (unlink epoch, surface)
+};
+
+} // namespace vol::stream
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vol::util {
+
+// n_threads <= 0: hardware concurrency (at least 1)
+int resolve_threads(int n_threads);
+
+// Fixed workers parked on a condition variable between runs. run() hands them a task count
+// and the calling thread joins in; tasks are claimed off an atomic index, so which worker
+// runs a task is unspecified. Callers that need thread-count-independent results write each
+// task's output to its own slot and reduce in task order. The first exception thrown by a
+// task stops further claims and is rethrown from run(). Runs on one pool are serialised by
+// the caller (run is not reentrant).
+class ThreadPool {
+public:
+    // n_threads counts the calling thread: 1 runs everything inline, <= 0 hardware concurrency
+    explicit ThreadPool(int n_threads = 0);
+    ~ThreadPool();   // joins the workers
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return static_cast<int>(threads_.size()) + 1; }
+
+    // fn(task) for task in [0, n)
+    void run(std::size_t n, const std::function<void(std::size_t)>& fn);
+    // fn(task, worker) with worker in [0, size()), for per-thread scratch; 0 is the caller
+    void run_workers(std::size_t n, const std::function<void(std::size_t, int)>& fn);
+
+private:
+    void work(int worker);
+    void drain(int worker);
+
+    std::vector<std::thread> threads_;
+    std::mutex m_;
+    std::condition_variable start_, done_;
+    const std::function<void(std::size_t, int)>* fn_ = nullptr;
+    std::size_t n_ = 0;
+    std::atomic<std::size_t> next_{0};
+    std::uint64_t epoch_ = 0;
+    std::size_t busy_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+};
+
+// One-shot fn(begin, end) over [0, n) in chunks of `grain` items on min(n_threads, chunks)
+// threads. For repeated calls keep a ThreadPool and use for_chunks instead.
+void parallel_for(std::size_t n, int n_threads, std::size_t grain,
+                  const std::function<void(std::size_t, std::size_t)>& fn);
+
+// fn(begin, end) over [0, n) in chunks of `grain` items on an existing pool
+void for_chunks(ThreadPool& pool, std::size_t n, std::size_t grain,
+                const std::function<void(std::size_t, std::size_t)>& fn);
+
+} // namespace vol::util
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "libvol/core/chain.hpp"
+#include "libvol/models/svi.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vol::synth {
+
+// Seeded synthetic option market for benchmarks and tests: underlyings x expiries x
+// strikes of OTM quotes priced off an arbitrage-free SSVI smile per expiry, then made
+// realistic: relative mid noise and spreads that widen into the wings, tick rounding,
+// zero bids where the option is worth less than a tick, and a fraction of crossed quotes.
+//
+// The same config and seed give the same market on every platform: draws come from
+// splitmix64 and normals from math::norm_inv_cdf at full accuracy, never from <random>.
+struct MarketConfig {
+    std::uint64_t seed = 1;
+    std::uint32_t underlyings = 500;
+    std::uint32_t expiries = 30;
+    std::uint32_t strikes = 80;
+    double min_T = 7.0 / 365.0;      // expiries geometrically spaced in [min_T, max_T]
+    double max_T = 3.0;
+    double wing_sd = 4.0;            // strikes span +-wing_sd ATM standard deviations
+    double noise = 0.01;             // relative mid noise at the money, x(1 + |z|) in the wings
+    double half_spread = 0.02;       // relative half spread at the money, x(1 + |z| / 2)
+    double tick = 0.01;
+    double crossed_fraction = 0.005; // quotes published with bid > ask
+};
+
+struct MarketSlice {
+    std::uint32_t underlying;
+    double S, r, q, T;
+    svi::Params truth;               // raw SVI of the SSVI smile the quotes came from
+    std::vector<double> strike, bid, ask, mid;
+    std::vector<std::uint8_t> is_call;
+
+    ExpiryContext expiry() const { return make_expiry(S, r, q, T); }
+    std::size_t size() const { return strike.size(); }
+};
+
+struct Market {
+    MarketConfig cfg;
+    std::vector<MarketSlice> slices;   // underlying-major, expiries ascending
+
+    std::size_t quotes() const;
+};
+
+// Throws std::invalid_argument on zero counts, a non-positive or inverted expiry range, or
+// strikes < 2.
+Market generate_market(const MarketConfig& cfg = {});
+
+} // namespace vol::synth
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vol::telemetry {
+
+// Solver and pipeline telemetry: event counters and per-stage latency histograms.
+//
+// libvol's hot paths report through the VOL_TELEMETRY_* macros below, which expand to
+// nothing unless the library is built with -DVOL_TELEMETRY=ON (CMake option), so the
+// default build carries no instrumentation at all. When compiled in, every thread writes
+// to its own 64-byte aligned slab with plain relaxed load/store pairs (no locked RMW, no
+// shared cache lines); snapshot() sums the slabs. Slabs of exited threads are kept, with
+// their counts, and reused by later threads.
+//
+// Histograms are log-linear (HDR-style): exact below 16 ns, then 16 buckets per power of
+// two, so any recorded value is reported within 1/16 (~6%) of its true value.
+
+enum class Counter : std::uint32_t {
+    IvSolves,                // bs::implied_vol calls
+    IvNoSolution,            // price outside the no-arbitrage bounds or no bracket found
+    IvBracketExpansions,     // upper-bracket widening steps
+    IvBracketLastResort,     // fell back to the full [1e-9, 5] bracket
+    IvBrentFallbacks,        // Newton did not converge, Brent finished the solve
+    IvBrentUnconverged,      // ... and Brent hit its iteration cap too
+    LbfgsbRuns,
+    LbfgsbMaxIter,           // returned maxit without meeting the gradient tolerance
+    LbfgsbStepCollapse,      // step size underflowed before convergence
+    SviFits,                 // fit_raw_svi_report / fit_raw_svi_warm
+    SviFewPoints,            // < 5 points: heuristic parameters, no solve
+    SviStartUnconverged,     // one multi-start local solve rejected as unconverged
+    SviHeuristicFallback,    // no start converged: returned the clamped heuristic start
+    SviWarmColdFallback,     // warm start unusable, paid for the cold multi-start
+    SliceQuotesRejected,     // quote dropped by the slice calibrators (no implied vol)
+    SliceFewQuotes,          // fewer than min_points usable quotes: fallback smile
+    COUNT
+};
+
+enum class Stage : std::uint32_t {
+    SliceFit,                // SVI fit of one slice, after IV inversion
+    PipelineIvBatch,         // one IV-stage drain of up to 1024 quotes
+    PipelineFit,             // one fit-stage job
+    PipelinePublish,         // the publish callback
+    PipelineTickToPublish,   // oldest coalesced tick to publish
+    COUNT
+};
+
+inline constexpr std::size_t N_COUNTERS = static_cast<std::size_t>(Counter::COUNT);
+inline constexpr std::size_t N_STAGES = static_cast<std::size_t>(Stage::COUNT);
+
+const char* name(Counter c);
+const char* name(Stage s);
+
+struct Histogram {
+    std::uint64_t count = 0;
+    std::uint64_t sum_ns = 0;
+    std::uint64_t min_ns = 0;
+    std::uint64_t max_ns = 0;
+    std::vector<std::uint64_t> buckets;   // log-linear, see bucket_lower()
+
+    double mean_ns() const { return count ? static_cast<double>(sum_ns) / static_cast<double>(count) : 0.0; }
+    // Value at quantile q in [0, 1] (bucket midpoint, clamped to [min, max]); 0 if empty
+    std::uint64_t percentile(double q) const;
+};
+
+struct Snapshot {
+    std::array<std::uint64_t, N_COUNTERS> counters{};
+    std::array<Histogram, N_STAGES> stages{};
+
+    std::uint64_t operator[](Counter c) const { return counters[static_cast<std::size_t>(c)]; }
+    const Histogram& operator[](Stage s) const { return stages[static_cast<std::size_t>(s)]; }
+};
+
+// False when libvol was built without VOL_TELEMETRY: snapshots are then all zero
+bool compiled_in();
+
+// Sum over all threads. Concurrent with writers; each value is some recent count.
+Snapshot snapshot();
+
+// Zeroes every slab; increments racing with the reset may survive it
+void reset();
+
+// {"compiled_in": ..., "counters": {name: n}, "stages": {name: {count, mean_ns, min_ns,
+// p50_ns, p90_ns, p99_ns, p999_ns, max_ns}}}
+std::string to_json(const Snapshot& s);
+
+namespace detail {
+
+inline constexpr std::size_t SUB_BITS = 4;
+inline constexpr std::size_t N_BUCKETS = (64 - SUB_BITS + 1) << SUB_BITS;
+
+inline std::size_t bucket_of(std::uint64_t v) {
+    if (v < (1u << SUB_BITS)) return static_cast<std::size_t>(v);
+    const std::size_t e = 63 - static_cast<std::size_t>(std::countl_zero(v));   // >= SUB_BITS
+    const std::size_t sub = static_cast<std::size_t>(v >> (e - SUB_BITS)) & ((1u << SUB_BITS) - 1);
+    return ((e - SUB_BITS + 1) << SUB_BITS) + sub;
+}
+
+struct HistogramSlab {
+    std::atomic<std::uint64_t> count{0}, sum{0}, min{~0ull}, max{0};
+    std::atomic<std::uint64_t> buckets[N_BUCKETS] = {};
+};
+
+struct alignas(64) Slab {
+    std::atomic<std::uint64_t> counters[N_COUNTERS] = {};
+    HistogramSlab stages[N_STAGES];
+    std::atomic<bool> in_use{false};
+};
+
+// Single-writer increment: only the owning thread stores to its slab
+inline void bump(std::atomic<std::uint64_t>& a, std::uint64_t n) {
+    a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+Slab* claim_slab();
+inline thread_local Slab* tls_slab = nullptr;
+
+inline Slab& slab() {
+    Slab* s = tls_slab;
+    return s ? *s : *claim_slab();
+}
+
+} // namespace detail
+
+inline void add(Counter c, std::uint64_t n = 1) {
+    detail::bump(detail::slab().counters[static_cast<std::size_t>(c)], n);
+}
+
+inline void record(Stage s, std::uint64_t ns) {
+    detail::HistogramSlab& h = detail::slab().stages[static_cast<std::size_t>(s)];
+    detail::bump(h.buckets[detail::bucket_of(ns)], 1);
+    detail::bump(h.count, 1);
+    detail::bump(h.sum, ns);
+    if (ns < h.min.load(std::memory_order_relaxed)) h.min.store(ns, std::memory_order_relaxed);
+    if (ns > h.max.load(std::memory_order_relaxed)) h.max.store(ns, std::memory_order_relaxed);
+}
+
+// Records the lifetime of the scope into one stage
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Stage s) : stage_(s), t0_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        const auto dt = std::chrono::steady_clock::now() - t0_;
+        record(stage_, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count()));
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Stage stage_;
+    std::chrono::steady_clock::time_point t0_;
+};
+
+} // namespace vol::telemetry
+
+#define VOL_TELEMETRY_CAT_(a, b) a##b
+#define VOL_TELEMETRY_CAT(a, b) VOL_TELEMETRY_CAT_(a, b)
+
+#if defined(VOL_TELEMETRY)
+#define VOL_TELEMETRY_COUNT(counter) ::vol::telemetry::add(::vol::telemetry::Counter::counter)
+#define VOL_TELEMETRY_ADD(counter, n) ::vol::telemetry::add(::vol::telemetry::Counter::counter, (n))
+#define VOL_TELEMETRY_RECORD(stage, ns) ::vol::telemetry::record(::vol::telemetry::Stage::stage, (ns))
+#define VOL_TELEMETRY_SCOPE(stage) \
+    ::vol::telemetry::ScopedTimer VOL_TELEMETRY_CAT(vol_telemetry_scope_, __LINE__)(::vol::telemetry::Stage::stage)
+#else
+#define VOL_TELEMETRY_COUNT(counter) ((void)0)
+#define VOL_TELEMETRY_ADD(counter, n) ((void)0)
+#define VOL_TELEMETRY_RECORD(stage, ns) ((void)0)
+#define VOL_TELEMETRY_SCOPE(stage) ((void)0)
+#endif
@@ -0,0 +1,199 @@
+#include "libvol/calib/differential_evolution.hpp"
+#include "libvol/util/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace vol::calib {
+
+namespace {
+
+struct Rng {
+    std::uint64_t s;
+
+    std::uint64_t next() {
+        std::uint64_t z = (s += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+    double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+    std::size_t below(std::size_t n) { return static_cast<std::size_t>(uniform() * static_cast<double>(n)); }
+};
+
+double rank_value(double v) {
+    return std::isfinite(v) ? v : std::numeric_limits<double>::infinity();
+}
+
+void validate_bounds(const std::vector<double>& lb, const std::vector<double>& ub) {
+    if (lb.empty() || lb.size() != ub.size()) {
+        throw std::invalid_argument("differential_evolution: lb and ub must have the same nonzero length");
+    }
+    for (std::size_t j = 0; j < lb.size(); ++j) {
+        if (!std::isfinite(lb[j]) || !std::isfinite(ub[j]) || !(lb[j] < ub[j])) {
+            throw std::invalid_argument("differential_evolution: bounds must be finite with lb < ub");
+        }
+    }
+}
+
+std::size_t population_size(const DEConfig& cfg, std::size_t dim) {
+    return cfg.population > 0 ? static_cast<std::size_t>(std::max(cfg.population, 4))
+                              : std::max<std::size_t>(8, 10 * dim);
+}
+
+// One pool per calibration, reused by every generation and the polish: no more than one
+// thread per member
+int pool_threads(const DEConfig& cfg, std::size_t dim) {
+    return static_cast<int>(std::min<std::size_t>(static_cast<std::size_t>(util::resolve_threads(cfg.n_threads)),
+                                                   population_size(cfg, dim)));
+}
+
+// Members and their objective values
+struct Population {
+    std::vector<std::vector<double>> x;
+    std::vector<double> f;
+
+    std::size_t best() const {
+        return static_cast<std::size_t>(std::min_element(f.begin(), f.end()) - f.begin());
+    }
+};
+
+Population evolve(const std::vector<double>& lb,
+                  const std::vector<double>& ub,
+                  const std::function<double(const std::vector<double>&)>& f,
+                  const DEConfig& cfg,
+                  util::ThreadPool& pool,
+                  DEResult& out) {
+    const std::size_t dim = lb.size();
+    const std::size_t P = population_size(cfg, dim);
+    Rng rng{cfg.seed};
+
+    // Latin hypercube start: one member per stratum of every coordinate
+    Population pop;
+    pop.x.assign(P, std::vector<double>(dim));
+    pop.f.assign(P, 0.0);
+    std::vector<std::size_t> perm(P);
+    for (std::size_t j = 0; j < dim; ++j) {
+        std::iota(perm.begin(), perm.end(), std::size_t{0});
+        for (std::size_t i = P - 1; i > 0; --i) std::swap(perm[i], perm[rng.below(i + 1)]);
+        for (std::size_t i = 0; i < P; ++i) {
+            const double u = (static_cast<double>(perm[i]) + rng.uniform()) / static_cast<double>(P);
+            pop.x[i][j] = lb[j] + u * (ub[j] - lb[j]);
+        }
+    }
+    pool.run(P, [&](std::size_t i) { pop.f[i] = rank_value(f(pop.x[i])); });
+    out.evaluations = static_cast<long long>(P);
+
+    std::vector<std::vector<double>> trial(P, std::vector<double>(dim));
+    std::vector<double> ft(P);
+    out.generations = 0;
+    out.converged = false;
+    auto done = [&] {
+        const double best = pop.f[pop.best()];
+        if (cfg.target >= 0.0 && best <= cfg.target) return true;
+        double mean = 0.0;
+        for (double v : pop.f) mean += v;
+        mean /= static_cast<double>(P);
+        if (!std::isfinite(mean)) return false;
+        double var = 0.0;
+        for (double v : pop.f) var += (v - mean) * (v - mean);
+        return std::sqrt(var / static_cast<double>(P)) <= cfg.tol * std::abs(mean) + cfg.atol;
+    };
+
+    while (!(out.converged = done()) && out.generations < cfg.max_generations) {
+        // all randomness is drawn here, before the parallel evaluation
+        const double F = cfg.F_lo + (cfg.F_hi - cfg.F_lo) * rng.uniform();
+        for (std::size_t i = 0; i < P; ++i) {
+            std::size_t r[3];
+            for (int k = 0; k < 3; ++k) {
+                do {
+                    r[k] = rng.below(P);
+                } while (r[k] == i || (k > 0 && r[k] == r[0]) || (k > 1 && r[k] == r[1]));
+            }
+            const std::size_t forced = rng.below(dim);
+            const std::vector<double>& parent = pop.x[i];
+            for (std::size_t j = 0; j < dim; ++j) {
+                double v = parent[j];
+                if (j == forced || rng.uniform() < cfg.CR) {
+                    v = pop.x[r[0]][j] + F * (pop.x[r[1]][j] - pop.x[r[2]][j]);
+                    // bounce back: a random point between the parent and the violated bound
+                    if (v < lb[j]) v = lb[j] + rng.uniform() * (parent[j] - lb[j]);
+                    if (v > ub[j]) v = ub[j] - rng.uniform() * (ub[j] - parent[j]);
+                }
+                trial[i][j] = v;
+            }
+        }
+        pool.run(P, [&](std::size_t i) { ft[i] = rank_value(f(trial[i])); });
+        out.evaluations += static_cast<long long>(P);
+        for (std::size_t i = 0; i < P; ++i) {
+            if (ft[i] <= pop.f[i]) {
+                pop.x[i].swap(trial[i]);
+                pop.f[i] = ft[i];
+            }
+        }
+        ++out.generations;
+    }
+    const std::size_t b = pop.best();
+    out.x = pop.x[b];
+    out.obj = pop.f[b];
+    out.polished = false;
+    return pop;
+}
+
+} // namespace
+
+DEResult differential_evolution(
+    const std::vector<double>& lb,
+    const std::vector<double>& ub,
+    const std::function<double(const std::vector<double>&)>& f,
+    const DEConfig& cfg)
+{
+    validate_bounds(lb, ub);
+    util::ThreadPool pool(pool_threads(cfg, lb.size()));
+    DEResult out{};
+    evolve(lb, ub, f, cfg, pool, out);
+    return out;
+}
+
+DEResult differential_evolution(
+    const std::vector<double>& lb,
+    const std::vector<double>& ub,
+    const std::function<double(const std::vector<double>&)>& f,
+    const std::function<void(const std::vector<double>&, double&, std::vector<double>&)>& f_grad,
+    const DEConfig& cfg)
+{
+    validate_bounds(lb, ub);
+    util::ThreadPool pool(pool_threads(cfg, lb.size()));
+    DEResult out{};
+    const Population pop = evolve(lb, ub, f, cfg, pool, out);
+    if (cfg.polish <= 0) return out;
+
+    // best distinct members, ties broken by index so the choice is deterministic too
+    std::vector<std::size_t> order(pop.f.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return pop.f[a] < pop.f[b]; });
+    std::vector<std::size_t> starts;
+    for (std::size_t i : order) {
+        if (starts.size() >= static_cast<std::size_t>(cfg.polish)) break;
+        if (!std::isfinite(pop.f[i])) break;
+        const bool dup = std::any_of(starts.begin(), starts.end(), [&](std::size_t s) { return pop.x[s] == pop.x[i]; });
+        if (!dup) starts.push_back(i);
+    }
+    std::vector<LSQResult> polished(starts.size());
+    pool.run(starts.size(), [&](std::size_t k) {
+        polished[k] = lbfgsb(pop.x[starts[k]], lb, ub, f_grad, cfg.polish_maxit, cfg.polish_tol);
+    });
+    for (const LSQResult& r : polished) {
+        if (r.obj < out.obj) {
+            out.x = r.x;
+            out.obj = r.obj;
+            out.polished = true;
+        }
+    }
+    return out;
+}
+
+}
@@ -1,4 +1,5 @@
 #include "libvol/calib/least_squares.hpp"
+#include "libvol/util/telemetry.hpp"
 #include <algorithm>
 #include <cmath>
 #include <limits>
@@ -14,6 +15,7 @@ LSQResult lbfgsb(
     int maxit,
     double tol)
 {
+    VOL_TELEMETRY_COUNT(LbfgsbRuns);
     const int n = static_cast<int>(x0.size());
     std::vector<double> x = x0;
     std::vector<double> g(n, 0.0);
@@ -70,11 +72,13 @@ LSQResult lbfgsb(
             // step too big, shrink
             alpha *= 0.5;
             if (alpha < 1e-10) {
-                break;
+                VOL_TELEMETRY_COUNT(LbfgsbStepCollapse);
+                return { best_x, best_f, maxit, false };
             }
         }
     }
 
+    VOL_TELEMETRY_COUNT(LbfgsbMaxIter);
     return { best_x, best_f, maxit, false };
 }
 
@@ -1,7 +1,10 @@
 #include "libvol/calib/svi_slice.hpp"
 #include "libvol/models/black_scholes.hpp"
+#include "libvol/models/american.hpp"
+#include "libvol/util/telemetry.hpp"
 #include <cmath>
 #include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 namespace vol::svi {
@@ -10,11 +13,83 @@ static inline double clamp(double x, double lo, double hi) {
     return std::max(lo, std::min(hi, x));
 }
 
-Params calibrate_slice_from_prices(const std::vector<OptionSpec>& opts, const std::vector<double>& mids, const SliceConfig& cfg)
+namespace {
+
+SlicePoint point(double S, double K, double r, double q, double T, double F, double iv, bool is_call,
+                 const SliceConfig& cfg) {
+    const double kk = std::log(K / F);
+    double weight = 1.0;
+    if (cfg.use_vega_weights) {
+        auto g = bs::price_greeks(S, K, r, q, T, iv, is_call);
+        weight = std::max(cfg.min_vega_eps, g.vega);
+    }
+    // dampen far-wings a bit
+    weight *= 1.0 / (1.0 + std::pow(std::abs(kk), cfg.wing_dampen_pow));
+    return {kk, iv * iv * T, weight};
+}
+
+struct SlicePoints {
+    std::vector<double> k, w, wt;
+
+    explicit SlicePoints(std::size_t n) {
+        k.reserve(n);
+        w.reserve(n);
+        wt.reserve(n);
+    }
+
+    // IV from price, then total variance and weight at log-moneyness k = log(K / F)
+    void add(double S, double K, double r, double q, double T, double F, double mid, bool is_call,
+             const SliceConfig& cfg) {
+        if (mid <= 0.0) return;
+        auto ivr = cfg.american ? american::implied_vol(S, K, r, q, T, mid, is_call, cfg.american_scheme, 1e-10)
+                                : bs::implied_vol(S, K, r, q, T, mid, is_call, 0.2, 1e-10);
+        if (!ivr.converged || !std::isfinite(ivr.iv) || ivr.iv <= 0.0) {
+            VOL_TELEMETRY_COUNT(SliceQuotesRejected);
+            return;
+        }
+        const SlicePoint p = point(S, K, r, q, T, F, ivr.iv, is_call, cfg);
+        k.push_back(p.k);
+        w.push_back(p.w);
+        wt.push_back(p.weight);
+    }
+
+    // Same, with the per-expiry factors and k = log(K / F) precomputed
+    void add(const ExpiryContext& ex, double K, double kk, double mid, bool is_call, const SliceConfig& cfg) {
+        if (mid <= 0.0) return;
+        auto ivr = cfg.american
+            ? american::implied_vol(ex.S, K, ex.r, ex.q, ex.T, mid, is_call, cfg.american_scheme, 1e-10)
+            : bs::implied_vol(ex, K, kk, mid, is_call, 0.2, 1e-10);
+        if (!ivr.converged || !std::isfinite(ivr.iv) || ivr.iv <= 0.0) {
+            VOL_TELEMETRY_COUNT(SliceQuotesRejected);
+            return;
+        }
+
+        double weight = 1.0;
+        if (cfg.use_vega_weights) {
+            auto g = bs::price_greeks(ex, K, kk, ivr.iv, is_call);
+            weight = std::max(cfg.min_vega_eps, g.vega);
+        }
+        weight *= 1.0 / (1.0 + std::pow(std::abs(kk), cfg.wing_dampen_pow));
+
+        k.push_back(kk);
+        w.push_back(ivr.iv * ivr.iv * ex.T);
+        wt.push_back(weight);
+    }
+
+    FitResult fit(const SliceConfig& cfg) const { return calibrate_slice_variance(k, w, wt, cfg); }
+};
+
+FitResult empty_fit() {
+    return {Params{1e-8, 0.1, 0.0, 0.0, 0.2}, std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
+}
+
+} // namespace
+
+FitResult calibrate_slice_report(const std::vector<OptionSpec>& opts, const std::vector<double>& mids, const SliceConfig& cfg)
 {
     const std::size_t n = std::min(opts.size(), mids.size());
     if (n == 0) {
-        return Params{1e-8, 0.1, 0.0, 0.0, 0.2};
+        return empty_fit();
     }
 
     // slice should be single maturity, if not something didn't work in compiling
@@ -26,44 +101,89 @@ Params calibrate_slice_from_prices(const std::vector<OptionSpec>& opts, const st
         }
     }
 
-    std::vector<double> kvals; kvals.reserve(n);
-    std::vector<double> w_market; w_market.reserve(n);
-    std::vector<double> weights; weights.reserve(n);
-
+    SlicePoints pts(n);
     for (std::size_t i = 0; i < n; ++i) {
         const auto& o = opts[i];
-        const double mid = mids[i];
-        if (mid <= 0.0) continue;
-
-        // IV from price
-        auto ivr = bs::implied_vol(o.S, o.K, o.r, o.q, o.T, mid, o.is_call, 0.2, 1e-10);
-        if (!ivr.converged || !std::isfinite(ivr.iv) || ivr.iv <= 0.0) continue;
-
         const double F = o.S * std::exp((o.r - o.q) * o.T);
-        const double k = std::log(o.K / F);
-        const double w = ivr.iv * ivr.iv * o.T;
+        pts.add(o.S, o.K, o.r, o.q, o.T, F, mids[i], o.is_call, cfg);
+    }
+    return pts.fit(cfg);
+}
 
-        double wt = 1.0;
-        if (cfg.use_vega_weights) {
-            auto g = bs::price_greeks(o.S, o.K, o.r, o.q, o.T, ivr.iv, o.is_call);
-            wt = std::max(cfg.min_vega_eps, g.vega);
-        }
-        // dampen far-wings a bit
-        wt *= 1.0 / (1.0 + std::pow(std::abs(k), cfg.wing_dampen_pow));
+FitResult calibrate_slice_report(const SliceQuotes& quotes, const SliceConfig& cfg)
+{
+    const std::size_t n = std::min(quotes.strikes.size(), quotes.mids.size());
+    if (quotes.is_call.size() < n) {
+        throw std::invalid_argument("calibrate_slice: is_call column shorter than strikes/mids");
+    }
+    if (n == 0) {
+        return empty_fit();
+    }
+    if (!(quotes.T > 0.0) || !(quotes.forward > 0.0) || !(quotes.discount > 0.0)) {
+        throw std::invalid_argument("calibrate_slice: T, forward and discount must be positive");
+    }
+    if (cfg.american) {
+        throw std::invalid_argument("calibrate_slice: American quotes need spot, r and q (use OptionSpec or Chain)");
+    }
 
-        kvals.push_back(k);
-        w_market.push_back(w);
-        weights.push_back(wt);
+    // Forward/discount form: spot = F and q = r reproduce the same BS prices
+    const double F = quotes.forward;
+    const double r = -std::log(quotes.discount) / quotes.T;
+    const ExpiryContext ex = make_expiry(F, r, r, quotes.T);
+    const double inv_F = 1.0 / F;
+    SlicePoints pts(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double K = quotes.strikes[i];
+        pts.add(ex, K, std::log(K * inv_F), quotes.mids[i], quotes.is_call[i] != 0, cfg);
     }
+    return pts.fit(cfg);
+}
 
-    if (kvals.size() < static_cast<std::size_t>(std::max(3, cfg.min_points))) {
+SlicePoint slice_point(double S, double K, double r, double q, double T, double iv, bool is_call,
+                       const SliceConfig& cfg)
+{
+    return point(S, K, r, q, T, S * std::exp((r - q) * T), iv, is_call, cfg);
+}
+
+FitResult calibrate_slice_variance(const std::vector<double>& k, const std::vector<double>& w,
+                                   const std::vector<double>& weights, const SliceConfig& cfg)
+{
+    VOL_TELEMETRY_SCOPE(SliceFit);
+    if (w.size() != k.size() || weights.size() != k.size()) {
+        throw std::invalid_argument("calibrate_slice_variance: k, w and weights must have the same length");
+    }
+    if (k.size() < static_cast<std::size_t>(std::max(3, cfg.min_points))) {
+        VOL_TELEMETRY_COUNT(SliceFewQuotes);
         // fallback symmetric, low-curvature
-        const double kmin = (kvals.empty() ? -0.1 : *std::min_element(kvals.begin(), kvals.end()));
-        const double kmax = (kvals.empty() ?  0.1 : *std::max_element(kvals.begin(), kvals.end()));
-        return Params{1e-8, 0.1, 0.0, 0.5 * (kmin + kmax), 0.2};
+        const double kmin = (k.empty() ? -0.1 : *std::min_element(k.begin(), k.end()));
+        const double kmax = (k.empty() ?  0.1 : *std::max_element(k.begin(), k.end()));
+        return {Params{1e-8, 0.1, 0.0, 0.5 * (kmin + kmax), 0.2}, std::numeric_limits<double>::quiet_NaN(), 0,
+                static_cast<int>(k.size()), false};
     }
+    return cfg.warm_start ? fit_raw_svi_warm(k, w, weights, *cfg.warm_start) : fit_raw_svi_report(k, w, weights);
+}
+
+Params calibrate_slice(const Chain& chain, std::span<const double> mids, const SliceConfig& cfg)
+{
+    const std::size_t n = std::min(chain.size(), mids.size());
+    if (n == 0) {
+        return Params{1e-8, 0.1, 0.0, 0.0, 0.2};
+    }
+    SlicePoints pts(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pts.add(chain.expiry, chain.K[i], chain.k[i], mids[i], chain.is_call[i] != 0, cfg);
+    }
+    return pts.fit(cfg).params;
+}
 
-    return fit_raw_svi(kvals, w_market, weights);
+Params calibrate_slice_from_prices(const std::vector<OptionSpec>& opts, const std::vector<double>& mids, const SliceConfig& cfg)
+{
+    return calibrate_slice_report(opts, mids, cfg).params;
+}
+
+Params calibrate_slice(const SliceQuotes& quotes, const SliceConfig& cfg)
+{
+    return calibrate_slice_report(quotes, cfg).params;
 }
 
 } // namespace vol::svi
@@ -0,0 +1,249 @@
+#include "libvol/io/chain_snapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vol::io {
+
+namespace {
+
+constexpr char MAGIC[8] = {'V', 'O', 'L', 'S', 'N', 'A', 'P', '\0'};
+constexpr std::size_t HEADER_BYTES = 128;
+constexpr std::size_t ALIGN = 64;
+
+enum Column { STRIKE, BID, ASK, MID, IS_CALL, N_COLUMNS };
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_bytes;
+    std::uint64_t n_rows;
+    std::uint64_t n_slices;
+    std::uint64_t file_bytes;
+    std::uint64_t slice_offset;
+    std::uint64_t column_offset[N_COLUMNS];
+};
+static_assert(sizeof(Header) <= HEADER_BYTES, "snapshot header must fit its reserved block");
+static_assert(sizeof(SliceRecord) == 48, "SliceRecord layout is part of the file format");
+
+std::size_t align_up(std::size_t x) {
+    return (x + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+// count Ts at offset lie inside a size-byte file, aligned for T. Written so no term can
+// wrap: the header values are untrusted and offset + count * sizeof(T) overflows silently.
+template <class T>
+bool fits(std::uint64_t offset, std::uint64_t count, std::size_t size) {
+    return offset <= size && count <= (size - offset) / sizeof(T) && offset % alignof(T) == 0;
+}
+
+} // namespace
+
+void SnapshotWriter::add_slice(std::uint32_t underlying,
+                               double T,
+                               double forward,
+                               double discount,
+                               std::span<const double> strike,
+                               std::span<const double> bid,
+                               std::span<const double> ask,
+                               std::span<const double> mid,
+                               std::span<const std::uint8_t> is_call) {
+    const std::size_t n = strike.size();
+    if (bid.size() != n || ask.size() != n || mid.size() != n || is_call.size() != n) {
+        throw std::invalid_argument("SnapshotWriter::add_slice: column lengths differ");
+    }
+    if (!(T > 0.0) || !(forward > 0.0) || !(discount > 0.0)) {
+        throw std::invalid_argument("SnapshotWriter::add_slice: T, forward and discount must be positive");
+    }
+    const std::uint64_t begin = strike_.size();
+    slices_.push_back({underlying, 0, T, forward, discount, begin, begin + n});
+    strike_.insert(strike_.end(), strike.begin(), strike.end());
+    bid_.insert(bid_.end(), bid.begin(), bid.end());
+    ask_.insert(ask_.end(), ask.begin(), ask.end());
+    mid_.insert(mid_.end(), mid.begin(), mid.end());
+    is_call_.insert(is_call_.end(), is_call.begin(), is_call.end());
+}
+
+void SnapshotWriter::write(const std::string& path) const {
+    const std::size_t n = strike_.size();
+    Header h{};
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version = SNAPSHOT_VERSION;
+    h.header_bytes = HEADER_BYTES;
+    h.n_rows = n;
+    h.n_slices = slices_.size();
+    h.slice_offset = HEADER_BYTES;
+    std::size_t pos = align_up(HEADER_BYTES + slices_.size() * sizeof(SliceRecord));
+    for (int c = STRIKE; c < IS_CALL; ++c) {
+        h.column_offset[c] = pos;
+        pos = align_up(pos + n * sizeof(double));
+    }
+    h.column_offset[IS_CALL] = pos;
+    h.file_bytes = pos + n;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("SnapshotWriter: cannot open " + path);
+    }
+    std::size_t written = 0;
+    auto put = [&](std::uint64_t offset, const void* src, std::size_t bytes) {
+        static const char zeros[ALIGN] = {};
+        while (written < offset) {
+            const std::size_t pad = std::min<std::size_t>(ALIGN, offset - written);
+            out.write(zeros, static_cast<std::streamsize>(pad));
+            written += pad;
+        }
+        out.write(static_cast<const char*>(src), static_cast<std::streamsize>(bytes));
+        written += bytes;
+    };
+    put(0, &h, sizeof(h));
+    put(h.slice_offset, slices_.data(), slices_.size() * sizeof(SliceRecord));
+    put(h.column_offset[STRIKE], strike_.data(), n * sizeof(double));
+    put(h.column_offset[BID], bid_.data(), n * sizeof(double));
+    put(h.column_offset[ASK], ask_.data(), n * sizeof(double));
+    put(h.column_offset[MID], mid_.data(), n * sizeof(double));
+    put(h.column_offset[IS_CALL], is_call_.data(), n);
+    if (!out) {
+        throw std::runtime_error("SnapshotWriter: write failed for " + path);
+    }
+}
+
+ChainSnapshot ChainSnapshot::open(const std::string& path) {
+    ChainSnapshot snap;
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("ChainSnapshot: cannot open " + path);
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_BYTES)) {
+        ::close(fd);
+        throw std::runtime_error("ChainSnapshot: file too small for a snapshot header: " + path);
+    }
+    void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("ChainSnapshot: mmap failed for " + path);
+    }
+    snap.data_ = static_cast<const std::byte*>(p);
+    snap.size_ = static_cast<std::size_t>(st.st_size);
+    snap.mapped_ = true;
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("ChainSnapshot: cannot open " + path);
+    }
+    snap.buffer_.resize(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(snap.buffer_.data()), static_cast<std::streamsize>(snap.buffer_.size()));
+    snap.data_ = snap.buffer_.data();
+    snap.size_ = snap.buffer_.size();
+    if (snap.size_ < HEADER_BYTES) {
+        throw std::runtime_error("ChainSnapshot: file too small for a snapshot header: " + path);
+    }
+#endif
+
+    Header h;
+    std::memcpy(&h, snap.data_, sizeof(h));
+    if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("ChainSnapshot: bad magic in " + path);
+    }
+    if (h.version != SNAPSHOT_VERSION) {
+        throw std::runtime_error("ChainSnapshot: unsupported format version " + std::to_string(h.version) +
+                                 " in " + path);
+    }
+    const std::uint64_t n = h.n_rows;
+    bool ok = h.file_bytes == snap.size_ && h.header_bytes == HEADER_BYTES &&
+              fits<SliceRecord>(h.slice_offset, h.n_slices, snap.size_) &&
+              fits<std::uint8_t>(h.column_offset[IS_CALL], n, snap.size_);
+    for (int c = STRIKE; c < IS_CALL && ok; ++c) {
+        ok = fits<double>(h.column_offset[c], n, snap.size_);
+    }
+    if (!ok) {
+        throw std::runtime_error("ChainSnapshot: truncated or inconsistent file " + path);
+    }
+
+    auto col = [&](int c) {
+        return std::span<const double>(reinterpret_cast<const double*>(snap.data_ + h.column_offset[c]), n);
+    };
+    snap.rows_ = n;
+    snap.slices_ = std::span<const SliceRecord>(
+        reinterpret_cast<const SliceRecord*>(snap.data_ + h.slice_offset), h.n_slices);
+    snap.strike_ = col(STRIKE);
+    snap.bid_ = col(BID);
+    snap.ask_ = col(ASK);
+    snap.mid_ = col(MID);
+    snap.is_call_ = std::span<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t*>(snap.data_ + h.column_offset[IS_CALL]), n);
+    for (const auto& s : snap.slices_) {
+        if (s.begin > s.end || s.end > n) {
+            throw std::runtime_error("ChainSnapshot: slice row range out of bounds in " + path);
+        }
+    }
+    return snap;
+}
+
+ChainSnapshot::ChainSnapshot(ChainSnapshot&& other) noexcept {
+    *this = std::move(other);
+}
+
+ChainSnapshot& ChainSnapshot::operator=(ChainSnapshot&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, false);
+        buffer_ = std::move(other.buffer_); // heap storage moves without relocating, spans stay valid
+        rows_ = std::exchange(other.rows_, 0);
+        slices_ = std::exchange(other.slices_, {});
+        strike_ = std::exchange(other.strike_, {});
+        bid_ = std::exchange(other.bid_, {});
+        ask_ = std::exchange(other.ask_, {});
+        mid_ = std::exchange(other.mid_, {});
+        is_call_ = std::exchange(other.is_call_, {});
+    }
+    return *this;
+}
+
+ChainSnapshot::~ChainSnapshot() {
+    release();
+}
+
+void ChainSnapshot::release() noexcept {
+#if !defined(_WIN32)
+    if (mapped_ && data_ != nullptr) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+}
+
+std::uint32_t ChainSnapshot::version() const {
+    Header h;
+    std::memcpy(&h, data_, sizeof(h));
+    return h.version;
+}
+
+SliceView ChainSnapshot::slice(std::size_t i) const {
+    const SliceRecord& s = slices_[i];
+    const std::size_t b = static_cast<std::size_t>(s.begin);
+    const std::size_t len = static_cast<std::size_t>(s.end - s.begin);
+    return {s.underlying, s.T, s.forward, s.discount,
+            strike_.subspan(b, len), bid_.subspan(b, len), ask_.subspan(b, len),
+            mid_.subspan(b, len), is_call_.subspan(b, len)};
+}
+
+} // namespace vol::io
@@ -0,0 +1,372 @@
+#include "libvol/io/shm_surface.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vol::io {
+
+namespace {
+
+constexpr char MAGIC[8] = {'V', 'O', 'L', 'S', 'H', 'M', '\0', '\0'};
+constexpr std::size_t HEADER_BYTES = 128;
+constexpr std::size_t ALIGN = 64;
+constexpr std::size_t WORDS = sizeof(ShmSlice) / sizeof(double);
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_bytes;
+    std::uint32_t max_underlyings;
+    std::uint32_t max_slices;
+    std::uint64_t record_bytes;
+    std::uint64_t segment_bytes;
+    std::int64_t writer_pid;
+    std::atomic<std::uint32_t> ready;   // set last by the writer, after the records exist
+};
+
+struct RecordHeader {
+    std::atomic<std::uint64_t> seq;   // odd while the writer is inside the record
+    std::atomic<std::uint64_t> published_ns;
+    std::atomic<std::uint32_t> n_slices;
+    std::uint32_t underlying;
+    std::byte pad[40];
+};
+
+static_assert(sizeof(Header) <= HEADER_BYTES, "shm header must fit its reserved block");
+static_assert(sizeof(RecordHeader) == ALIGN, "record header is one cache line");
+static_assert(sizeof(ShmSlice) == 8 * sizeof(double), "ShmSlice layout is part of the segment format");
+// the seqlock words are shared between processes, so they must not fall back to a lock
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic_ref<double>::is_always_lock_free,
+              "shared-memory surfaces need lock-free 64-bit atomics");
+
+std::size_t record_bytes(std::uint32_t max_slices) {
+    return sizeof(RecordHeader) + std::size_t{max_slices} * sizeof(ShmSlice);
+}
+
+std::uint64_t steady_ns() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+// Slice payload words: relaxed atomics on both sides, ordered by the seqlock fences, so a
+// torn read is detected rather than undefined
+double* words(std::byte* record) {
+    return reinterpret_cast<double*>(record + sizeof(RecordHeader));
+}
+double* words(const std::byte* record) {
+    return words(const_cast<std::byte*>(record));
+}
+
+#if !defined(_WIN32)
+// kill(pid, 0) probes without signalling; EPERM still means the process exists
+bool pid_alive(std::int64_t pid) {
+    if (pid <= 0) return false;
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+// Writer pid recorded in an existing segment, or 0 if it is too small or not ours
+std::int64_t existing_writer(const std::string& name) {
+    const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return 0;
+    struct stat st {};
+    std::int64_t pid = 0;
+    if (::fstat(fd, &st) == 0 && st.st_size >= static_cast<off_t>(HEADER_BYTES)) {
+        void* p = ::mmap(nullptr, HEADER_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) {
+            const auto* h = static_cast<const Header*>(p);
+            if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) == 0) pid = h->writer_pid;
+            ::munmap(p, HEADER_BYTES);
+        }
+    }
+    ::close(fd);
+    return pid;
+}
+#endif
+
+} // namespace
+
+// Writer ------------------------------------------------------------------------------
+
+ShmSurfaceWriter ShmSurfaceWriter::create(const std::string& name, std::uint32_t max_underlyings,
+                                          std::uint32_t max_slices) {
+    if (max_underlyings == 0 || max_slices == 0) {
+        throw std::invalid_argument("ShmSurfaceWriter: capacities must be positive");
+    }
+    ShmSurfaceWriter w;
+    w.name_ = name;
+    w.max_underlyings_ = max_underlyings;
+    w.max_slices_ = max_slices;
+    w.record_bytes_ = record_bytes(max_slices);
+    w.size_ = HEADER_BYTES + std::size_t{max_underlyings} * w.record_bytes_;
+#if !defined(_WIN32)
+    // an existing segment is only taken over once its writer is gone; a reader that is
+    // still mapped keeps the old (unlinked) memory until it detaches
+    int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        const std::int64_t pid = existing_writer(name);
+        if (pid_alive(pid)) {
+            throw std::runtime_error("ShmSurfaceWriter: " + name + " is owned by live writer pid " +
+                                     std::to_string(pid));
+        }
+        ::shm_unlink(name.c_str());
+        fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0) {
+        throw std::runtime_error("ShmSurfaceWriter: cannot create shared memory " + name);
+    }
+    if (::ftruncate(fd, static_cast<off_t>(w.size_)) != 0) {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw std::runtime_error("ShmSurfaceWriter: cannot size shared memory " + name);
+    }
+    void* p = ::mmap(nullptr, w.size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        throw std::runtime_error("ShmSurfaceWriter: mmap failed for " + name);
+    }
+    w.data_ = static_cast<std::byte*>(p);
+#else
+    throw std::runtime_error("ShmSurfaceWriter: POSIX shared memory is not available on this platform");
+#endif
+
+    // the new segment is zero-filled; construct the header and records in place
+    Header* h = new (w.data_) Header{};
+    std::memcpy(h->magic, MAGIC, sizeof(MAGIC));
+    h->version = SHM_VERSION;
+    h->header_bytes = HEADER_BYTES;
+    h->max_underlyings = max_underlyings;
+    h->max_slices = max_slices;
+    h->record_bytes = w.record_bytes_;
+    h->segment_bytes = w.size_;
+#if !defined(_WIN32)
+    h->writer_pid = static_cast<std::int64_t>(::getpid());
+#endif
+    for (std::uint32_t u = 0; u < max_underlyings; ++u) {
+        RecordHeader* r = new (w.data_ + HEADER_BYTES + u * w.record_bytes_) RecordHeader{};
+        r->underlying = u;
+    }
+    h->ready.store(1, std::memory_order_release);
+    return w;
+}
+
+std::uint64_t ShmSurfaceWriter::publish(std::uint32_t underlying, std::span<const ShmSlice> slices) {
+    if (underlying >= max_underlyings_) {
+        throw std::invalid_argument("ShmSurfaceWriter::publish: underlying index out of range");
+    }
+    if (slices.size() > max_slices_) {
+        throw std::invalid_argument("ShmSurfaceWriter::publish: more slices than the segment holds");
+    }
+    std::byte* rec = data_ + HEADER_BYTES + underlying * record_bytes_;
+    auto* r = reinterpret_cast<RecordHeader*>(rec);
+    const std::uint64_t seq = r->seq.load(std::memory_order_relaxed);
+    r->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const double* src = reinterpret_cast<const double*>(slices.data());
+    double* dst = words(rec);
+    for (std::size_t i = 0; i < slices.size() * WORDS; ++i) {
+        std::atomic_ref<double>(dst[i]).store(src[i], std::memory_order_relaxed);
+    }
+    r->n_slices.store(static_cast<std::uint32_t>(slices.size()), std::memory_order_relaxed);
+    r->published_ns.store(steady_ns(), std::memory_order_relaxed);
+
+    r->seq.store(seq + 2, std::memory_order_release);
+    return (seq + 2) / 2;
+}
+
+void ShmSurfaceWriter::remove(const std::string& name) {
+#if !defined(_WIN32)
+    ::shm_unlink(name.c_str());
+#endif
+}
+
+ShmSurfaceWriter::ShmSurfaceWriter(ShmSurfaceWriter&& other) noexcept {
+    *this = std::move(other);
+}
+
+ShmSurfaceWriter& ShmSurfaceWriter::operator=(ShmSurfaceWriter&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        name_ = std::move(other.name_);
+        max_underlyings_ = std::exchange(other.max_underlyings_, 0);
+        max_slices_ = std::exchange(other.max_slices_, 0);
+        record_bytes_ = std::exchange(other.record_bytes_, 0);
+    }
+    return *this;
+}
+
+ShmSurfaceWriter::~ShmSurfaceWriter() {
+    release();
+}
+
+void ShmSurfaceWriter::release() noexcept {
+#if !defined(_WIN32)
+    if (data_ != nullptr) ::munmap(data_, size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+// Reader ------------------------------------------------------------------------------
+
+ShmSurfaceReader ShmSurfaceReader::attach(const std::string& name, std::chrono::milliseconds max_wait) {
+    ShmSurfaceReader rd;
+    rd.max_wait_ns_ = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(max_wait, std::chrono::milliseconds(0)))
+            .count());
+#if !defined(_WIN32)
+    const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw std::runtime_error("ShmSurfaceReader: no shared memory named " + name);
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_BYTES)) {
+        ::close(fd);
+        throw std::runtime_error("ShmSurfaceReader: segment too small for a header: " + name);
+    }
+    void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("ShmSurfaceReader: mmap failed for " + name);
+    }
+    rd.data_ = static_cast<const std::byte*>(p);
+    rd.size_ = static_cast<std::size_t>(st.st_size);
+#else
+    throw std::runtime_error("ShmSurfaceReader: POSIX shared memory is not available on this platform");
+#endif
+
+    const auto* h = reinterpret_cast<const Header*>(rd.data_);
+    if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("ShmSurfaceReader: bad magic in " + name);
+    }
+    if (h->version != SHM_VERSION) {
+        throw std::runtime_error("ShmSurfaceReader: unsupported format version " + std::to_string(h->version) +
+                                 " in " + name);
+    }
+    if (h->ready.load(std::memory_order_acquire) != 1) {
+        throw std::runtime_error("ShmSurfaceReader: segment not initialised yet: " + name);
+    }
+    const bool ok = h->header_bytes == HEADER_BYTES && h->max_slices > 0 &&
+                    h->record_bytes == record_bytes(h->max_slices) && h->segment_bytes == rd.size_ &&
+                    HEADER_BYTES + std::size_t{h->max_underlyings} * h->record_bytes <= rd.size_;
+    if (!ok) {
+        throw std::runtime_error("ShmSurfaceReader: inconsistent segment header in " + name);
+    }
+    rd.max_underlyings_ = h->max_underlyings;
+    rd.max_slices_ = h->max_slices;
+    rd.record_bytes_ = static_cast<std::size_t>(h->record_bytes);
+    return rd;
+}
+
+ShmRead ShmSurfaceReader::read(std::uint32_t underlying, std::span<ShmSlice> out) const {
+    if (underlying >= max_underlyings_) {
+        throw std::invalid_argument("ShmSurfaceReader::read: underlying index out of range");
+    }
+    if (out.size() < max_slices_) {
+        throw std::invalid_argument("ShmSurfaceReader::read: output shorter than max_slices()");
+    }
+    const std::byte* rec = data_ + HEADER_BYTES + underlying * record_bytes_;
+    const auto* r = reinterpret_cast<const RecordHeader*>(rec);
+    const double* src = words(rec);
+    double* dst = reinterpret_cast<double*>(out.data());
+    std::uint64_t deadline = 0;
+    for (unsigned spins = 0;; ++spins) {
+        const std::uint64_t seq = r->seq.load(std::memory_order_acquire);
+        if (spins > 64 && spins % 64 == 1) {
+            // past the fast path: the writer was descheduled, stalled or died mid-record.
+            // A dead writer leaves the record odd for good, so say so rather than wait.
+            const std::uint64_t now = steady_ns();
+            if (deadline == 0) deadline = now + max_wait_ns_;
+#if !defined(_WIN32)
+            if ((seq & 1u) && !pid_alive(writer_pid())) {
+                throw std::runtime_error("ShmSurfaceReader::read: writer pid " + std::to_string(writer_pid()) +
+                                         " died while publishing underlying " + std::to_string(underlying));
+            }
+#endif
+            if (now > deadline) {
+                throw std::runtime_error("ShmSurfaceReader::read: no consistent copy of underlying " +
+                                         std::to_string(underlying) + " within max_wait");
+            }
+        }
+        if (seq & 1u) {
+            // the writer is mid-record for a few hundred ns; only yield if it was descheduled
+            if (spins > 64) std::this_thread::yield();
+            continue;
+        }
+        const std::size_t n = std::min<std::size_t>(r->n_slices.load(std::memory_order_relaxed), max_slices_);
+        const std::uint64_t t = r->published_ns.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < n * WORDS; ++i) {
+            dst[i] = std::atomic_ref<double>(const_cast<double&>(src[i])).load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (r->seq.load(std::memory_order_relaxed) == seq) return {seq / 2, t, n};
+    }
+}
+
+std::vector<ShmSlice> ShmSurfaceReader::read(std::uint32_t underlying) const {
+    std::vector<ShmSlice> out(max_slices_);
+    out.resize(read(underlying, out).n_slices);
+    return out;
+}
+
+std::uint64_t ShmSurfaceReader::version(std::uint32_t underlying) const {
+    if (underlying >= max_underlyings_) {
+        throw std::invalid_argument("ShmSurfaceReader::version: underlying index out of range");
+    }
+    const auto* r = reinterpret_cast<const RecordHeader*>(data_ + HEADER_BYTES + underlying * record_bytes_);
+    return r->seq.load(std::memory_order_acquire) / 2;
+}
+
+std::int64_t ShmSurfaceReader::writer_pid() const {
+    return reinterpret_cast<const Header*>(data_)->writer_pid;
+}
+
+ShmSurfaceReader::ShmSurfaceReader(ShmSurfaceReader&& other) noexcept {
+    *this = std::move(other);
+}
+
+ShmSurfaceReader& ShmSurfaceReader::operator=(ShmSurfaceReader&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        max_underlyings_ = std::exchange(other.max_underlyings_, 0);
+        max_slices_ = std::exchange(other.max_slices_, 0);
+        record_bytes_ = std::exchange(other.record_bytes_, 0);
+        max_wait_ns_ = std::exchange(other.max_wait_ns_, 0);
+    }
+    return *this;
+}
+
+ShmSurfaceReader::~ShmSurfaceReader() {
+    release();
+}
+
+void ShmSurfaceReader::release() noexcept {
+#if !defined(_WIN32)
+    if (data_ != nullptr) ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} // namespace vol::io
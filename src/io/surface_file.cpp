@@ -0,0 +1,313 @@
+#include "libvol/io/surface_file.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vol::io {
+
+namespace {
+
+constexpr char MAGIC[8] = {'V', 'O', 'L', 'S', 'U', 'R', 'F', '\0'};
+constexpr std::size_t HEADER_BYTES = 128;
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_bytes;
+    std::uint32_t record_bytes;
+    std::uint32_t reserved;
+    std::uint64_t n_records;
+    std::uint64_t file_bytes;
+    std::uint64_t record_offset;
+    std::uint64_t timestamp;
+    std::uint64_t checksum;
+};
+static_assert(sizeof(Header) <= HEADER_BYTES, "surface file header must fit its reserved block");
+static_assert(sizeof(SurfaceRecord) == 96, "SurfaceRecord layout is part of the file format");
+
+constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ull;
+constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+constexpr std::uint64_t P3 = 0x165667B19E3779F9ull;
+
+std::uint64_t rotl(std::uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+std::uint64_t mix(std::uint64_t acc, std::uint64_t v) {
+    return rotl(acc + v * P2, 31) * P1;
+}
+
+// Four independent lanes over 32-byte stripes (the XXH64 round), folded with the tail and
+// length; word-at-a-time, so verifying is cheap next to the refits it guards.
+std::uint64_t checksum(const std::byte* p, std::size_t bytes, std::uint64_t seed) {
+    std::uint64_t lane[4] = {seed + P1 + P2, seed + P2, seed, seed - P1};
+    std::size_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        for (int l = 0; l < 4; ++l) {
+            std::uint64_t v;
+            std::memcpy(&v, p + i + 8 * l, 8);
+            lane[l] = mix(lane[l], v);
+        }
+    }
+    std::uint64_t h = rotl(lane[0], 1) + rotl(lane[1], 7) + rotl(lane[2], 12) + rotl(lane[3], 18);
+    for (int l = 0; l < 4; ++l) h = (h ^ mix(0, lane[l])) * P1 + P3;
+    for (; i + 8 <= bytes; i += 8) {
+        std::uint64_t v;
+        std::memcpy(&v, p + i, 8);
+        h = rotl(h ^ mix(0, v), 27) * P1 + P3;
+    }
+    for (; i < bytes; ++i) h = rotl(h ^ (static_cast<std::uint64_t>(p[i]) * P3), 11) * P1;
+    h ^= bytes;
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    return h ^ (h >> 32);
+}
+
+bool record_less(const SurfaceRecord& a, const SurfaceRecord& b) {
+    return a.underlying != b.underlying ? a.underlying < b.underlying : a.T < b.T;
+}
+
+#if !defined(_WIN32)
+// write(2) until done; false on any error other than EINTR
+bool write_all(int fd, const void* data, std::size_t bytes) {
+    const char* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        const ssize_t n = ::write(fd, p, bytes);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        p += n;
+        bytes -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+// fsync of the directory holding path, so a rename into it survives a crash. Filesystems
+// that cannot sync a directory report EINVAL, which is not an error here.
+bool sync_parent(const std::string& path) {
+    const std::size_t slash = path.rfind('/');
+    const std::string dir = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+    const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    const bool ok = ::fsync(fd) == 0 || errno == EINVAL;
+    ::close(fd);
+    return ok;
+}
+#endif
+
+} // namespace
+
+void SurfaceFileWriter::add(std::uint32_t underlying, double T, double forward, double discount,
+                            const svi::FitResult& fit) {
+    SurfaceRecord r{};
+    r.underlying = underlying;
+    r.flags = fit.converged ? SURFACE_CONVERGED : 0u;
+    r.T = T;
+    r.forward = forward;
+    r.discount = discount;
+    r.params = fit.params;
+    r.rmse = fit.rmse;
+    r.iterations = fit.iterations;
+    r.n_points = fit.n_points;
+    add(r);
+}
+
+void SurfaceFileWriter::add(const SurfaceRecord& record) {
+    if (!(record.T > 0.0) || !(record.forward > 0.0) || !(record.discount > 0.0)) {
+        throw std::invalid_argument("SurfaceFileWriter::add: T, forward and discount must be positive");
+    }
+    SurfaceRecord r = record;
+    r.reserved = 0;
+    records_.push_back(r);
+}
+
+void SurfaceFileWriter::write(const std::string& path, std::uint64_t timestamp) const {
+    std::vector<SurfaceRecord> sorted = records_;
+    std::stable_sort(sorted.begin(), sorted.end(), record_less);
+    const std::size_t n = sorted.size();
+    const std::size_t record_bytes = n * sizeof(SurfaceRecord);
+
+    Header h{};
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version = SURFACE_FILE_VERSION;
+    h.header_bytes = HEADER_BYTES;
+    h.record_bytes = sizeof(SurfaceRecord);
+    h.n_records = n;
+    h.record_offset = HEADER_BYTES; // already 64-byte aligned
+    h.file_bytes = h.record_offset + record_bytes;
+    h.timestamp = timestamp;
+    h.checksum = checksum(reinterpret_cast<const std::byte*>(sorted.data()), record_bytes, n);
+
+    const std::string tmp = path + ".tmp";
+    static const char zeros[HEADER_BYTES] = {};
+#if !defined(_WIN32)
+    // the data must be on disk before the rename publishes it, and the rename itself only
+    // lasts once the directory entry is synced
+    const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("SurfaceFileWriter: cannot open " + tmp);
+    }
+    const bool written = write_all(fd, &h, sizeof(h)) && write_all(fd, zeros, h.record_offset - sizeof(h)) &&
+                         write_all(fd, sorted.data(), record_bytes) && ::fsync(fd) == 0;
+    if (::close(fd) != 0 || !written) {
+        std::remove(tmp.c_str());
+        throw std::runtime_error("SurfaceFileWriter: write failed for " + tmp);
+    }
+#else
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("SurfaceFileWriter: cannot open " + tmp);
+        }
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        out.write(zeros, static_cast<std::streamsize>(h.record_offset - sizeof(h)));
+        out.write(reinterpret_cast<const char*>(sorted.data()), static_cast<std::streamsize>(record_bytes));
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("SurfaceFileWriter: write failed for " + tmp);
+        }
+    }
+#endif
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        throw std::runtime_error("SurfaceFileWriter: cannot replace " + path);
+    }
+#if !defined(_WIN32)
+    if (!sync_parent(path)) {
+        throw std::runtime_error("SurfaceFileWriter: cannot sync the directory of " + path);
+    }
+#endif
+}
+
+SurfaceFile SurfaceFile::open(const std::string& path, bool verify) {
+    SurfaceFile file;
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("SurfaceFile: cannot open " + path);
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_BYTES)) {
+        ::close(fd);
+        throw std::runtime_error("SurfaceFile: file too small for a surface header: " + path);
+    }
+    void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("SurfaceFile: mmap failed for " + path);
+    }
+    file.data_ = static_cast<const std::byte*>(p);
+    file.size_ = static_cast<std::size_t>(st.st_size);
+    file.mapped_ = true;
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("SurfaceFile: cannot open " + path);
+    }
+    file.buffer_.resize(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(file.buffer_.data()), static_cast<std::streamsize>(file.buffer_.size()));
+    file.data_ = file.buffer_.data();
+    file.size_ = file.buffer_.size();
+    if (file.size_ < HEADER_BYTES) {
+        throw std::runtime_error("SurfaceFile: file too small for a surface header: " + path);
+    }
+#endif
+
+    Header h;
+    std::memcpy(&h, file.data_, sizeof(h));
+    if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("SurfaceFile: bad magic in " + path);
+    }
+    if (h.version != SURFACE_FILE_VERSION) {
+        throw std::runtime_error("SurfaceFile: unsupported format version " + std::to_string(h.version) + " in " +
+                                 path);
+    }
+    const bool ok = h.file_bytes == file.size_ && h.header_bytes == HEADER_BYTES &&
+                    h.record_bytes == sizeof(SurfaceRecord) && h.record_offset % alignof(SurfaceRecord) == 0 &&
+                    h.record_offset >= HEADER_BYTES && h.record_offset <= file.size_ &&
+                    h.n_records <= (file.size_ - h.record_offset) / sizeof(SurfaceRecord) &&
+                    h.record_offset + h.n_records * sizeof(SurfaceRecord) == file.size_;
+    if (!ok) {
+        throw std::runtime_error("SurfaceFile: truncated or inconsistent file " + path);
+    }
+    const std::byte* rec = file.data_ + h.record_offset;
+    if (verify && checksum(rec, h.n_records * sizeof(SurfaceRecord), h.n_records) != h.checksum) {
+        throw std::runtime_error("SurfaceFile: checksum mismatch in " + path);
+    }
+    file.records_ = std::span<const SurfaceRecord>(reinterpret_cast<const SurfaceRecord*>(rec), h.n_records);
+    if (!std::is_sorted(file.records_.begin(), file.records_.end(), record_less)) {
+        throw std::runtime_error("SurfaceFile: records out of order in " + path);
+    }
+    return file;
+}
+
+SurfaceFile::SurfaceFile(SurfaceFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+SurfaceFile& SurfaceFile::operator=(SurfaceFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, false);
+        buffer_ = std::move(other.buffer_); // heap storage moves without relocating, spans stay valid
+        records_ = std::exchange(other.records_, {});
+    }
+    return *this;
+}
+
+SurfaceFile::~SurfaceFile() {
+    release();
+}
+
+void SurfaceFile::release() noexcept {
+#if !defined(_WIN32)
+    if (mapped_ && data_ != nullptr) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+    records_ = {};
+}
+
+std::uint32_t SurfaceFile::version() const {
+    Header h;
+    std::memcpy(&h, data_, sizeof(h));
+    return h.version;
+}
+
+std::uint64_t SurfaceFile::timestamp() const {
+    Header h;
+    std::memcpy(&h, data_, sizeof(h));
+    return h.timestamp;
+}
+
+std::span<const SurfaceRecord> SurfaceFile::underlying(std::uint32_t u) const {
+    const auto lo = std::lower_bound(records_.begin(), records_.end(), u,
+                                     [](const SurfaceRecord& r, std::uint32_t v) { return r.underlying < v; });
+    const auto hi = std::upper_bound(lo, records_.end(), u,
+                                     [](std::uint32_t v, const SurfaceRecord& r) { return v < r.underlying; });
+    return records_.subspan(static_cast<std::size_t>(lo - records_.begin()), static_cast<std::size_t>(hi - lo));
+}
+
+} // namespace vol::io
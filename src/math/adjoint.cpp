@@ -0,0 +1,25 @@
+#include "libvol/math/adjoint.hpp"
+
+namespace vol::ad {
+
+void Tape::backward(const Var& y, double seed) {
+    adjoints_.assign(ends_.size(), 0.0);
+    if (y.is_constant()) return;
+    adjoints_[y.index()] = seed;
+    // statements only refer to earlier ones, so one pass from y down to the inputs is enough
+    for (std::size_t k = y.index(); k >= 1; --k) {
+        const double a = adjoints_[k];
+        if (a == 0.0) continue;
+        const std::uint32_t end = ends_[k];
+        for (std::uint32_t j = ends_[k - 1]; j < end; ++j) {
+            const detail::Operand& op = operands_[j];
+            adjoints_[op.index] += op.partial * a;
+        }
+    }
+}
+
+double Tape::adjoint(const Var& x) const {
+    return x.index() < adjoints_.size() && !x.is_constant() ? adjoints_[x.index()] : 0.0;
+}
+
+} // namespace vol::ad
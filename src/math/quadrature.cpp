@@ -1,5 +1,7 @@
 #include "libvol/math/quadrature.hpp"
 
+#include "libvol/core/constants.hpp"
+
 #include <cmath>
 #include <mutex>
 #include <stdexcept>
@@ -73,6 +75,63 @@ GaussLaguerreRule build_rule(int n) {
     return rule;
 }
 
+ClenshawCurtisRule build_cc_rule(int n) {
+    if (n < 2 || n % 2 != 0) {
+        throw std::invalid_argument("Clenshaw-Curtis order must be even and >= 2");
+    }
+    ClenshawCurtisRule rule;
+    rule.nodes.resize(n + 1);
+    rule.weights.resize(n + 1);
+    for (int j = 0; j <= n; ++j) {
+        const double th = vol::PI * j / n;
+        double s = 0.0;
+        for (int k = 1; k <= n / 2; ++k) {
+            const double b = (2 * k == n) ? 1.0 : 2.0;
+            s += b / (4.0 * k * k - 1.0) * std::cos(2.0 * k * th);
+        }
+        const double c = (j == 0 || j == n) ? 1.0 : 2.0;
+        rule.nodes[j] = 0.5 * (1.0 - std::cos(th));
+        rule.weights[j] = 0.5 * c * (1.0 - s) / n; // 0.5 maps [-1, 1] onto [0, 1]
+    }
+    return rule;
+}
+
+// Newton on P_n from the Chebyshev-like initial guesses; the rule is symmetric, so only
+// the positive half is solved for.
+GaussLegendreRule build_gl_rule(int n) {
+    if (n <= 0) {
+        throw std::invalid_argument("Gauss-Legendre order must be positive");
+    }
+    GaussLegendreRule rule;
+    rule.nodes.resize(n);
+    rule.weights.resize(n);
+    for (int i = 0; i < (n + 1) / 2; ++i) {
+        double x = std::cos(vol::PI * (i + 0.75) / (n + 0.5));
+        double dP = 1.0;
+        for (int it = 0; it < MAX_ITERS; ++it) {
+            double P = 1.0;
+            double Pm1 = 0.0;
+            for (int k = 1; k <= n; ++k) {
+                const double Pm2 = Pm1;
+                Pm1 = P;
+                P = ((2.0 * k - 1.0) * x * Pm1 - (k - 1.0) * Pm2) / k;
+            }
+            dP = n * (x * P - Pm1) / (x * x - 1.0);
+            const double delta = P / dP;
+            x -= delta;
+            if (std::abs(delta) <= EPS) {
+                break;
+            }
+        }
+        const double w = 2.0 / ((1.0 - x * x) * dP * dP);
+        rule.nodes[i] = -x;
+        rule.nodes[n - 1 - i] = x;
+        rule.weights[i] = w;
+        rule.weights[n - 1 - i] = w;
+    }
+    return rule;
+}
+
 } // namespace
 
 const GaussLaguerreRule& gauss_laguerre_rule(int n) {
@@ -89,4 +148,32 @@ const GaussLaguerreRule& gauss_laguerre_rule(int n) {
     return inserted_it->second;
 }
 
+const ClenshawCurtisRule& clenshaw_curtis_rule(int n) {
+    static std::mutex mtx;
+    static std::unordered_map<int, ClenshawCurtisRule> cache;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = cache.find(n);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    auto [inserted_it, inserted] = cache.emplace(n, ClenshawCurtisRule{});
+    inserted_it->second = build_cc_rule(n);
+    return inserted_it->second;
+}
+
+const GaussLegendreRule& gauss_legendre_rule(int n) {
+    static std::mutex mtx;
+    static std::unordered_map<int, GaussLegendreRule> cache;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = cache.find(n);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    auto [inserted_it, inserted] = cache.emplace(n, GaussLegendreRule{});
+    inserted_it->second = build_gl_rule(n);
+    return inserted_it->second;
+}
+
 } // namespace vol::math
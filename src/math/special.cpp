@@ -0,0 +1,62 @@
+#include "libvol/math/special.hpp"
+
+#include "libvol/core/constants.hpp"
+#include "special_kernels.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace vol::math {
+
+double norm_pdf(double x) {
+    return detail::norm_pdf(x);
+}
+
+double norm_cdf(double x, Accuracy acc) {
+    switch (acc) {
+    case Accuracy::High: return detail::cdf_cody(x);
+    case Accuracy::Fast: return detail::cdf_as(x);
+    case Accuracy::Full: break;
+    }
+    return detail::cdf_full(x);
+}
+
+double norm_inv_cdf(double p, Accuracy acc) {
+    if (!(p > 0.0)) {
+        return p == 0.0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    }
+    if (!(p < 1.0)) {
+        return p == 1.0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    }
+    // Work in the lower half: 1 - p is exact for p >= 0.5, and the refinement then
+    // compares against the small tail probability rather than something close to 1.
+    const double pt = p < 0.5 ? p : 1.0 - p;
+    double x = detail::inv_cdf_acklam(pt);
+    // High refines with erfc as well: the scalar std::erfc is cheaper than the Cody
+    // rational plus its exp, so there is nothing to gain from the looser tier here.
+    if (acc != Accuracy::Fast) {
+        x = detail::halley_refine(x, pt, detail::cdf_full);
+    }
+    return p < 0.5 ? x : -x;
+}
+
+double norm_log_cdf(double x) {
+    if (x > 0.0) {
+        return std::log1p(-0.5 * std::erfc(x * detail::SQRT1_2));
+    }
+    if (x > -20.0) {
+        return std::log(0.5 * std::erfc(-x * detail::SQRT1_2));
+    }
+    // Asymptotic expansion Phi(x) ~ phi(x) / -x * sum_k (-1)^k (2k-1)!! / x^{2k}; at x <= -20
+    // eight terms are below double precision.
+    const double z = 1.0 / (x * x);
+    double series = 1.0;
+    double term = 1.0;
+    for (int k = 1; k <= 8; ++k) {
+        term *= -(2.0 * k - 1.0) * z;
+        series += term;
+    }
+    return -0.5 * x * x - std::log(-x) - 0.5 * std::log(2.0 * vol::PI) + std::log(series);
+}
+
+} // namespace vol::math
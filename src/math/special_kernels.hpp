@@ -0,0 +1,130 @@
+#pragma once
+
+// Branch-free normal-distribution kernels shared by the scalar (special.cpp) and batch
+// (special_simd.cpp) entry points. Everything here is inline and select-based so that the
+// batch loops vectorise; the scalar file is compiled without fast-math.
+
+#include "libvol/core/constants.hpp"
+
+#include <cmath>
+
+// The Cody kernel is too large for GCC's default inliner, and a call inside the batch loop
+// stops it vectorising.
+#if defined(__GNUC__)
+#define VOL_KERNEL_INLINE inline __attribute__((always_inline))
+#else
+#define VOL_KERNEL_INLINE inline
+#endif
+
+namespace vol::math::detail {
+
+inline constexpr double SQRT1_2 = 0.70710678118654752440;
+inline constexpr double SQRT2PI = 2.50662827463100050242;
+
+inline double norm_pdf(double x) {
+    return vol::INV_SQRT2PI * std::exp(-0.5 * x * x);
+}
+
+inline double cdf_full(double x) {
+    return 0.5 * std::erfc(-x * SQRT1_2);
+}
+
+// Lower-tail probability 0.5 * erfc(y) for y >= 0 from Cody's (1969) rational Chebyshev
+// approximations (the CALERF ranges y <= 0.46875, <= 4, > 4), all three evaluated and
+// selected so the batch loop stays branch-free. exp(-y^2) is taken in one piece (CALERF
+// splits it), which costs ~y^2 ulps of relative error in the far tail: < 1e-13 overall.
+VOL_KERNEL_INLINE double half_erfc_cody(double y) {
+    const double ysq = y * y;
+    double xnum = 1.85777706184603153e-1 * ysq;
+    double xden = ysq;
+    xnum = (xnum + 3.16112374387056560e00) * ysq;
+    xden = (xden + 2.36012909523441209e01) * ysq;
+    xnum = (xnum + 1.13864154151050156e02) * ysq;
+    xden = (xden + 2.44024637934444173e02) * ysq;
+    xnum = (xnum + 3.77485237685302021e02) * ysq;
+    xden = (xden + 1.28261652607737228e03) * ysq;
+    const double erf_small = y * (xnum + 3.20937758913846947e03) / (xden + 2.84423683343917062e03);
+
+    xnum = 2.15311535474403846e-8 * y;
+    xden = y;
+    xnum = (xnum + 5.64188496988670089e-1) * y;
+    xden = (xden + 1.57449261107098347e01) * y;
+    xnum = (xnum + 8.88314979438837594e00) * y;
+    xden = (xden + 1.17693950891312499e02) * y;
+    xnum = (xnum + 6.61191906371416295e01) * y;
+    xden = (xden + 5.37181101862009858e02) * y;
+    xnum = (xnum + 2.98635138197400131e02) * y;
+    xden = (xden + 1.62138957456669019e03) * y;
+    xnum = (xnum + 8.81952221241769090e02) * y;
+    xden = (xden + 3.29079923573345963e03) * y;
+    xnum = (xnum + 1.71204761263407058e03) * y;
+    xden = (xden + 4.36261909014324716e03) * y;
+    xnum = (xnum + 2.05107837782607147e03) * y;
+    xden = (xden + 3.43936767414372164e03) * y;
+    const double mid = (xnum + 1.23033935479799725e03) / (xden + 1.23033935480374942e03);
+
+    const double z = 1.0 / ysq;
+    xnum = 1.63153871373020978e-2 * z;
+    xden = z;
+    xnum = (xnum + 3.05326634961232344e-1) * z;
+    xden = (xden + 2.56852019228982242e00) * z;
+    xnum = (xnum + 3.60344899949804439e-1) * z;
+    xden = (xden + 1.87295284992346725e00) * z;
+    xnum = (xnum + 1.25781726111229246e-1) * z;
+    xden = (xden + 5.27905102951428412e-1) * z;
+    xnum = (xnum + 1.60837851487422766e-2) * z;
+    xden = (xden + 6.05183413124413191e-2) * z;
+    const double r = z * (xnum + 6.58749161529837803e-4) / (xden + 2.33520497626869185e-3);
+    const double large = (5.6418958354775628695e-1 - r) / y;
+
+    const double scale = std::exp(-ysq);
+    const double tail = scale * (y <= 4.0 ? mid : large);
+    return 0.5 * (y <= 0.46875 ? 1.0 - erf_small : tail);
+}
+
+VOL_KERNEL_INLINE double cdf_cody(double x) {
+    const double lower = half_erfc_cody(std::abs(x) * SQRT1_2);
+    return x > 0.0 ? 1.0 - lower : lower;
+}
+
+// Abramowitz & Stegun 26.2.17, absolute error < 7.5e-8
+inline double cdf_as(double x) {
+    const double a = std::abs(x);
+    const double t = 1.0 / (1.0 + 0.2316419 * a);
+    const double poly = t * (0.319381530 + t * (-0.356563782 + t * (1.781477937 + t * (-1.821255978 + t * 1.330274429))));
+    const double lower = norm_pdf(a) * poly;
+    return x > 0.0 ? 1.0 - lower : lower;
+}
+
+// Acklam's rational approximation of the inverse normal CDF, relative error < 1.15e-9.
+// Both tails use the same rational in q = sqrt(-2 log(min(p, 1 - p))).
+inline double inv_cdf_acklam(double p) {
+    constexpr double P_LOW = 0.02425;
+    const double qc = p - 0.5;
+    const double r = qc * qc;
+    const double central =
+        (((((-3.969683028665376e+01 * r + 2.209460984245205e+02) * r - 2.759285104469687e+02) * r +
+           1.383577518672690e+02) * r - 3.066479806614716e+01) * r + 2.506628277459239e+00) * qc /
+        (((((-5.447609879822406e+01 * r + 1.615858368580409e+02) * r - 1.556989798598866e+02) * r +
+           6.680131188771972e+01) * r - 1.328068155288572e+01) * r + 1.0);
+    const double pt = p < 0.5 ? p : 1.0 - p;
+    const double q = std::sqrt(-2.0 * std::log(pt));
+    const double tail_lo =
+        (((((-7.784894002430293e-03 * q - 3.223964580411365e-01) * q - 2.400758277161838e+00) * q -
+           2.549732539343734e+00) * q + 4.374664141464968e+00) * q + 2.938163982698783e+00) /
+        ((((7.784695709041462e-03 * q + 3.224671290700398e-01) * q + 2.445134137142996e+00) * q +
+          3.754408661907416e+00) * q + 1.0);
+    const double tail = p < 0.5 ? tail_lo : -tail_lo;
+    return (pt < P_LOW) ? tail : central;
+}
+
+// One Halley step on Phi(x) = p using the given CDF; squares the Acklam error. Callers pass
+// the lower-tail probability (p <= 0.5) so that the residual is not taken against ~1.
+template <class Cdf>
+inline double halley_refine(double x, double p, const Cdf& cdf) {
+    const double e = cdf(x) - p;
+    const double u = e * SQRT2PI * std::exp(0.5 * x * x);
+    return x - u / (1.0 + 0.5 * x * u);
+}
+
+} // namespace vol::math::detail
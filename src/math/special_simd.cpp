@@ -0,0 +1,95 @@
+// Batch forms of the normal-distribution functions. Built with -ffast-math under
+// VOL_ENABLE_SIMD (see CMakeLists.txt) so glibc's vector exp/log/erfc are used; the
+// kernels are select-based and the loops carry no special cases beyond the p-range clamp.
+#include "libvol/math/special.hpp"
+
+#include "special_kernels.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+// glibc >= 2.35 ships a vector erfc in libmvec (x86-64, declared under -ffast-math). It is
+// faster than the Cody rational and more accurate, so High batch calls go through it.
+#if defined(__FAST_MATH__) && defined(__x86_64__) && defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 35))
+#define VOL_VECTOR_ERFC 1
+#else
+#define VOL_VECTOR_ERFC 0
+#endif
+
+namespace vol::math {
+
+namespace {
+
+void check_out(std::size_t n, std::size_t out_n, const char* fn) {
+    if (out_n < n) {
+        throw std::invalid_argument(std::string(fn) + ": output span shorter than input");
+    }
+}
+
+template <class Kernel>
+void apply(std::span<const double> in, std::span<double> out, const Kernel& kernel) {
+    const double* __restrict src = in.data();
+    double* dst = out.data();
+    const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(in.size());
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        dst[i] = kernel(src[i]);
+    }
+}
+
+// Inverse CDF via the lower half, see norm_inv_cdf; endpoints handled with selects so the
+// loop stays vectorisable (the kernels produce NaN there, which the select discards).
+template <class Refine>
+double inv_lower(double p, const Refine& refine) {
+    const double pt = p < 0.5 ? p : 1.0 - p;
+    const double x = refine(detail::inv_cdf_acklam(pt), pt);
+    const double inf = std::numeric_limits<double>::infinity();
+    const double signed_x = p < 0.5 ? x : -x;
+    return p <= 0.0 ? -inf : (p >= 1.0 ? inf : signed_x);
+}
+
+} // namespace
+
+void norm_pdf(std::span<const double> x, std::span<double> out) {
+    check_out(x.size(), out.size(), "norm_pdf");
+    apply(x, out, [](double v) { return detail::norm_pdf(v); });
+}
+
+void norm_cdf(std::span<const double> x, std::span<double> out, Accuracy acc) {
+    check_out(x.size(), out.size(), "norm_cdf");
+    switch (acc) {
+    case Accuracy::High:
+        if (VOL_VECTOR_ERFC) break;
+        apply(x, out, [](double v) { return detail::cdf_cody(v); });
+        return;
+    case Accuracy::Fast: apply(x, out, [](double v) { return detail::cdf_as(v); }); return;
+    case Accuracy::Full: break;
+    }
+    apply(x, out, [](double v) { return detail::cdf_full(v); });
+}
+
+void norm_inv_cdf(std::span<const double> p, std::span<double> out, Accuracy acc) {
+    check_out(p.size(), out.size(), "norm_inv_cdf");
+    switch (acc) {
+    case Accuracy::Fast:
+        apply(p, out, [](double v) { return inv_lower(v, [](double x, double) { return x; }); });
+        return;
+    case Accuracy::High:
+        if (VOL_VECTOR_ERFC) break;
+        apply(p, out, [](double v) {
+            return inv_lower(v, [](double x, double pt) { return detail::halley_refine(x, pt, detail::cdf_cody); });
+        });
+        return;
+    case Accuracy::Full: break;
+    }
+    apply(p, out, [](double v) {
+        return inv_lower(v, [](double x, double pt) { return detail::halley_refine(x, pt, detail::cdf_full); });
+    });
+}
+
+} // namespace vol::math
@@ -0,0 +1,503 @@
+#include "libvol/models/american.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/math/quadrature.hpp"
+#include "libvol/core/constants.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace vol::american {
+
+namespace {
+
+constexpr int MAX_NODES = 64;
+constexpr int FALLBACK_STEPS = 2000;
+constexpr double SQRT1_2 = 0.70710678118654752440;
+// boundary moves below this (in sqrt H = |log(B / X)|) end the iteration early
+constexpr double SETTLED = 1e-13;
+
+inline double cdf(double x) { return 0.5 * std::erfc(-x * SQRT1_2); }
+inline double pdf(double x) { return vol::INV_SQRT2PI * std::exp(-0.5 * x * x); }
+
+// Unit-strike European put: value, spot derivatives and calendar theta
+struct Euro { double v, dv, d2v, theta; };
+
+inline Euro european_put(double s, double r, double q, double T, double vol) {
+    const double sqT = std::sqrt(T);
+    const double vs = vol * sqT;
+    const double dfr = std::exp(-r * T), dfq = std::exp(-q * T);
+    const double dp = (std::log(s) + (r - q) * T) / vs + 0.5 * vs;
+    const double dm = dp - vs;
+    const double Nm = cdf(-dm), Np = cdf(-dp);
+    const double n_dp = dfq * pdf(dp);
+    return {dfr * Nm - s * dfq * Np, -dfq * Np, n_dp / (s * vs),
+            -0.5 * s * n_dp * vol / sqT - q * s * dfq * Np + r * dfr * Nm};
+}
+
+enum class Regime { Boundary, European, Tree };
+
+// Put-frame regime: early exercise needs r > 0, and q < r <= 0 has two boundaries
+inline Regime regime(double r, double q) {
+    if (r > 0.0) return Regime::Boundary;
+    return q >= r ? Regime::European : Regime::Tree;
+}
+
+void check_scheme(const Scheme& s) {
+    if (s.nodes < 2 || s.nodes > MAX_NODES || s.iterations < 1 || s.quad_order < 1 || s.premium_order < 1) {
+        throw std::invalid_argument("american: invalid collocation scheme");
+    }
+}
+
+// Weights R_j(z) of the Chebyshev interpolant through the node values: with nodes at
+// z_j = cos(j pi / n), H(z) = sum_j R_j(z) H_j. The node at expiry (j = n) has H = 0 and
+// is left out, so n weights are written, stride apart.
+void interpolation_row(int n, double z, double* row, std::size_t stride) {
+    double Tk[MAX_NODES + 1];
+    Tk[0] = 1.0;
+    Tk[1] = z;
+    for (int k = 2; k <= n; ++k) Tk[k] = 2.0 * z * Tk[k - 1] - Tk[k - 2];
+    for (int j = 0; j < n; ++j) {
+        double s = 0.5 * (Tk[0] + ((j % 2) ? -Tk[n] : Tk[n]));
+        for (int k = 1; k < n; ++k) s += std::cos(vol::PI * j * k / n) * Tk[k];
+        row[j * stride] = (j == 0 ? 1.0 : 2.0) * s / n;
+    }
+}
+
+// Everything that depends on the scheme but not on the market: collocation nodes, the
+// Gauss-Legendre points of both integrals in theta with u = tau sin^2(theta), and the
+// interpolation weights of the boundary at those points. Cached per scheme, as the
+// quadrature rules are. Weights are stored node-major ([j][k]) so the boundary at all
+// points of one integral is a sum of contiguous rows.
+struct Tables {
+    int n = 0, l = 0, p = 0;
+    std::vector<double> node;            // sqrt(tau_i / T), i = 0..n-1 (tau_0 = T)
+    std::vector<double> in_sn2, in_cs;   // l points, shared by every node
+    std::vector<double> in_w;
+    std::vector<double> in_row;          // [i][j][k], n * n * l
+    std::vector<double> pr_cs, pr_w;     // p points
+    std::vector<double> pr_row;          // [j][k], n * p
+};
+
+Tables build_tables(const Scheme& s) {
+    Tables t;
+    t.n = s.nodes;
+    t.l = s.quad_order;
+    t.p = s.premium_order;
+    const int n = t.n;
+    t.node.resize(n);
+    for (int i = 0; i < n; ++i) t.node[i] = 0.5 * (1.0 + std::cos(vol::PI * i / n));
+
+    // theta = pi / 4 (1 + y) maps the Gauss-Legendre points onto [0, pi / 2]
+    const auto& gl_in = vol::math::gauss_legendre_rule(t.l);
+    t.in_sn2.resize(t.l);
+    t.in_cs.resize(t.l);
+    t.in_w.resize(t.l);
+    t.in_row.resize(static_cast<std::size_t>(n) * n * t.l);
+    for (int k = 0; k < t.l; ++k) {
+        const double th = 0.25 * vol::PI * (1.0 + gl_in.nodes[k]);
+        const double sn = std::sin(th);
+        t.in_sn2[k] = sn * sn;
+        t.in_cs[k] = std::cos(th);
+        t.in_w[k] = 0.25 * vol::PI * gl_in.weights[k] * sn;
+        for (int i = 0; i < n; ++i) {
+            // sqrt(u / T) = node_i sin(theta)
+            interpolation_row(n, 2.0 * t.node[i] * sn - 1.0, &t.in_row[static_cast<std::size_t>(i) * n * t.l + k],
+                              static_cast<std::size_t>(t.l));
+        }
+    }
+
+    const auto& gl_pr = vol::math::gauss_legendre_rule(t.p);
+    t.pr_cs.resize(t.p);
+    t.pr_w.resize(t.p);
+    t.pr_row.resize(static_cast<std::size_t>(n) * t.p);
+    for (int k = 0; k < t.p; ++k) {
+        const double th = 0.25 * vol::PI * (1.0 + gl_pr.nodes[k]);
+        const double sn = std::sin(th);
+        t.pr_cs[k] = std::cos(th);
+        t.pr_w[k] = 0.25 * vol::PI * gl_pr.weights[k] * sn;
+        interpolation_row(n, 2.0 * sn - 1.0, &t.pr_row[k], static_cast<std::size_t>(t.p));
+    }
+    return t;
+}
+
+const Tables& tables(const Scheme& s) {
+    static std::mutex mtx;
+    static std::map<std::tuple<int, int, int>, Tables> cache;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto key = std::make_tuple(s.nodes, s.quad_order, s.premium_order);
+    auto it = cache.find(key);
+    if (it == cache.end()) it = cache.emplace(key, build_tables(s)).first;
+    return it->second;
+}
+
+// log B at m quadrature points from node-major interpolation weights (n rows of m)
+inline void log_boundary(const double* __restrict rows, const double* H, int n, int m, double log_X,
+                         double* __restrict out) {
+    std::fill(out, out + m, 0.0);
+    for (int j = 0; j < n; ++j) {
+        const double h = H[j];
+        const double* __restrict row = rows + static_cast<std::size_t>(j) * m;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (int k = 0; k < m; ++k) out[k] += row[k] * h;
+    }
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+    for (int k = 0; k < m; ++k) out[k] = log_X - std::sqrt(std::max(out[k], 0.0));
+}
+
+// QD+ approximation of the put boundary at one expiry (Li, 2010): the root in (0, X] of
+//   (1 - e^{-q tau} Phi(-d+(S))) S + (lambda + c0(S)) (1 - S - p(S)) = 0
+// with p the European put, by secant steps from start. Only the starting point of the
+// fixed-point iteration, so a few digits are enough.
+double qd_plus(double r, double q, double tau, double vol, double X, double start) {
+    const double h = 1.0 - std::exp(-r * tau);
+    const double alpha = 2.0 * r / (vol * vol);
+    const double beta = 2.0 * (r - q) / (vol * vol);
+    const double disc = std::sqrt((beta - 1.0) * (beta - 1.0) + 4.0 * alpha / h);
+    const double lambda = 0.5 * (1.0 - beta - disc);
+    const double dlambda = alpha / (h * h * disc);
+    const double lb = 2.0 * lambda + beta - 1.0;
+    const double er = std::exp(r * tau);
+    auto g = [&](double S) {
+        const Euro p = european_put(S, r, q, tau, vol);
+        const double A = 1.0 - S - p.v;
+        const double c0 = -(1.0 - h) * alpha / lb * (1.0 / h - p.theta * er / (r * A) + dlambda / lb);
+        return (1.0 + p.dv) * S + (lambda + c0) * A;
+    };
+    double S0 = start, S1 = start * (1.0 - 1e-4);
+    double g0 = g(S0), g1 = g(S1);
+    for (int it = 0; it < 12; ++it) {
+        const double dg = g1 - g0;
+        // at start = X with a tiny tau, A = 1 - S - p vanishes and g is not finite; the
+        // last finite iterate is a good enough start
+        if (!(std::abs(dg) > 1e-300) || std::abs(S1 - S0) <= 1e-9 * S1) break;
+        const double next = std::clamp(S1 - g1 * (S1 - S0) / dg, 0.5 * S1, X);
+        if (!std::isfinite(next)) break;
+        S0 = S1;
+        g0 = g1;
+        S1 = next;
+        g1 = g(S1);
+    }
+    return S1;
+}
+
+// Exercise boundary of a unit-strike put as H_i = log(B(tau_i) / X)^2 at the collocation
+// nodes, tau_0 = T first (the node at expiry, H = 0, is implicit).
+struct Boundary {
+    double X = 1.0;
+    double log_X = 0.0;
+    double H[MAX_NODES];
+
+    // log B(T): the boundary today, below which the put is exercised at once
+    double log_at_valuation() const { return log_X - std::sqrt(H[0]); }
+};
+
+// Per-thread scratch for the quadrature loops
+struct Scratch {
+    std::vector<double> er, eq, lb;
+};
+
+Scratch& scratch() {
+    thread_local Scratch s;
+    return s;
+}
+
+// Andersen-Lake-Offengenden fixed point for the unit-strike put boundary. At node tau the
+// boundary solves B = exp(-(r - q) tau) N(tau, B) / D(tau, B); in their FP-B form
+//   N = phi(d-(tau, B)) / (vol sqrt(tau)) + r int_0^tau e^{ru} phi(d-(tau - u, B / B(u))) / (vol sqrt(tau - u)) du
+//   D = phi(d+(tau, B)) / (vol sqrt(tau)) + Phi(d+(tau, B))
+//       + q int_0^tau e^{qu} [phi(d+(..)) / (vol sqrt(tau - u)) + Phi(d+(..))] du
+// and in the FP-A form
+//   N = Phi(d-(tau, B)) + r int_0^tau e^{ru} Phi(d-(..)) du
+//   D = Phi(d+(tau, B)) + q int_0^tau e^{qu} Phi(d+(..)) du
+// The integrals run over u = tau sin^2(theta): sqrt(u) and sqrt(tau - u) are then smooth in
+// theta, so both the square-root behaviour of B near expiry and the 1 / sqrt(tau - u)
+// singularity drop out and Gauss-Legendre converges geometrically.
+//
+// FP-B converges faster, but where the vol is low against the rate its map has slope
+// below -1 in B and the iteration diverges. The first pass measures that slope at every
+// node and switches the solve to FP-A if any node is unstable.
+void solve_boundary(double r, double q, double T, double vol, const Scheme& scheme, const Tables& tb,
+                    Boundary& b) {
+    const int n = tb.n;
+    const int l = tb.l;
+    b.X = q > 0.0 ? std::min(1.0, r / q) : 1.0;
+    b.log_X = std::log(b.X);
+    const double log_X = b.log_X;
+
+    double tau[MAX_NODES];
+    for (int i = 0; i < n; ++i) tau[i] = T * tb.node[i] * tb.node[i];
+
+    // QD+ start, from the shortest expiry out, each solve seeded with the previous root
+    double start = b.X;
+    for (int i = n - 1; i >= 0; --i) {
+        start = qd_plus(r, q, tau[i], vol, b.X, start);
+        const double h = std::log(start) - log_X;
+        b.H[i] = h * h;
+    }
+
+    // discounting along the quadrature points does not change between iterations
+    Scratch& ws = scratch();
+    const std::size_t m = static_cast<std::size_t>(n) * l;
+    ws.er.resize(m);
+    ws.eq.resize(m);
+    if (ws.lb.size() < static_cast<std::size_t>(l)) ws.lb.resize(l);
+    for (int i = 0; i < n; ++i) {
+        double* __restrict er = &ws.er[static_cast<std::size_t>(i) * l];
+        double* __restrict eq = &ws.eq[static_cast<std::size_t>(i) * l];
+        const double* __restrict sn2 = tb.in_sn2.data();
+        const double* __restrict w = tb.in_w.data();
+        const double ti = tau[i];
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (int k = 0; k < l; ++k) {
+            er[k] = w[k] * std::exp(r * ti * sn2[k]);
+            eq[k] = w[k] * std::exp(q * ti * sn2[k]);
+        }
+    }
+
+    const double drift = r - q;
+    const double mu = drift + 0.5 * vol * vol;
+    const double* __restrict cs = tb.in_cs.data();
+    double* __restrict lb = ws.lb.data();
+    bool fp_a = false;
+    bool checked = false;
+    double next_H[MAX_NODES];
+
+    for (int it = 0; it < scheme.iterations; ++it) {
+        double moved = 0.0;
+        for (int i = 0; i < n; ++i) {
+            const double t = tau[i];
+            const double v0 = vol * std::sqrt(t);
+            const double log_B = log_X - std::sqrt(b.H[i]);
+            const double dp0 = (log_B + mu * t) / v0;
+            const double dm0 = dp0 - v0;
+            const double scale = std::exp(-drift * t);
+            const double* __restrict er = &ws.er[static_cast<std::size_t>(i) * l];
+            const double* __restrict eq = &ws.eq[static_cast<std::size_t>(i) * l];
+            log_boundary(&tb.in_row[static_cast<std::size_t>(i) * n * l], b.H, n, l, log_X, lb);
+
+            double N, D;
+            if (fp_a) {
+                double sN = 0.0, sD = 0.0;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd reduction(+:sN,sD)
+#endif
+                for (int k = 0; k < l; ++k) {
+                    const double vs = v0 * cs[k];
+                    const double dp = (log_B - lb[k] + mu * t * cs[k] * cs[k]) / vs;
+                    sN += er[k] * cs[k] * cdf(dp - vs);
+                    sD += eq[k] * cs[k] * cdf(dp);
+                }
+                // du = 2 tau sin cos dtheta
+                N = cdf(dm0) + 2.0 * r * t * sN;
+                D = cdf(dp0) + 2.0 * q * t * sD;
+            } else {
+                double sN = 0.0, sD = 0.0, sDc = 0.0, dN = 0.0, dD = 0.0;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd reduction(+:sN,sD,sDc,dN,dD)
+#endif
+                for (int k = 0; k < l; ++k) {
+                    const double vs = v0 * cs[k];
+                    const double dp = (log_B - lb[k] + mu * t * cs[k] * cs[k]) / vs;
+                    const double dm = dp - vs;
+                    const double pm = er[k] * pdf(dm);
+                    const double pp = eq[k] * pdf(dp);
+                    sN += pm;
+                    sD += pp;
+                    sDc += eq[k] * cs[k] * cdf(dp);
+                    dN -= pm * dm / vs;
+                    dD += pp * (1.0 - dp / vs);
+                }
+                // du / (vol sqrt(tau - u)) = 2 sqrt(tau) / vol sin dtheta
+                const double jac = 2.0 * t / v0;
+                const double pm0 = pdf(dm0) / v0, pp0 = pdf(dp0) / v0;
+                N = pm0 + r * jac * sN;
+                D = pp0 + cdf(dp0) + q * (jac * sD + 2.0 * t * sDc);
+                if (!checked) {
+                    // slope of the map at this node, the rest of the boundary held fixed
+                    const double BdN = -dm0 / v0 * pm0 + r * jac * dN;
+                    const double BdD = pp0 * (1.0 - dp0 / v0) + q * jac * dD;
+                    const double slope = scale * (BdN / D - N * BdD / (D * D)) * std::exp(-log_B);
+                    fp_a = fp_a || slope < -1.0;
+                }
+            }
+
+            const double B = std::min(scale * N / D, b.X);
+            const double h = B > 0.0 ? std::log(B) - log_X : -50.0;
+            next_H[i] = h * h;
+            moved = std::max(moved, std::abs(std::abs(h) - std::sqrt(b.H[i])));
+        }
+        if (!checked) {
+            checked = true;
+            if (fp_a) {
+                // restart from the QD+ boundary with FP-A
+                it = -1;
+                continue;
+            }
+        }
+        std::copy(next_H, next_H + n, b.H);
+        if (moved <= SETTLED) break;
+    }
+}
+
+// Unit-strike put on the converged boundary: value, first and second spot derivatives
+struct PutValue { double v, dv, d2v; };
+
+PutValue put_value(double s, double r, double q, double T, double vol, const Tables& tb, const Boundary& b,
+                   bool derivatives) {
+    const Euro eu = european_put(s, r, q, T, vol);
+    const int p = tb.p;
+    Scratch& ws = scratch();
+    if (ws.lb.size() < static_cast<std::size_t>(p)) ws.lb.resize(p);
+    double* __restrict lb = ws.lb.data();
+    log_boundary(tb.pr_row.data(), b.H, tb.n, p, b.log_X, lb);
+
+    const double mu = r - q + 0.5 * vol * vol;
+    const double log_s = std::log(s);
+    const double vT = vol * std::sqrt(T);
+    const double* __restrict cs = tb.pr_cs.data();
+    const double* __restrict pw = tb.pr_w.data();
+
+    // early-exercise premium over u = T sin^2(theta), du = 2 T sin cos dtheta
+    double pv = 0.0, pd = 0.0, pg = 0.0;
+    if (!derivatives) {
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd reduction(+:pv)
+#endif
+        for (int k = 0; k < p; ++k) {
+            const double t = T * cs[k] * cs[k];
+            const double vs = vT * cs[k];
+            const double dp = (log_s - lb[k] + mu * t) / vs;
+            const double w = 2.0 * T * pw[k] * cs[k];
+            pv += w * (r * std::exp(-r * t) * cdf(vs - dp) - q * s * std::exp(-q * t) * cdf(-dp));
+        }
+        return {eu.v + pv, eu.dv, eu.d2v};
+    }
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd reduction(+:pv,pd,pg)
+#endif
+    for (int k = 0; k < p; ++k) {
+        const double t = T * cs[k] * cs[k];
+        const double vs = vT * cs[k];
+        const double dp = (log_s - lb[k] + mu * t) / vs;
+        const double dm = dp - vs;
+        const double w = 2.0 * T * pw[k] * cs[k];
+        const double rdf = r * std::exp(-r * t);
+        const double qdf = q * std::exp(-q * t);
+        const double Np = cdf(-dp);
+        const double pdm = pdf(dm) / vs;
+        const double pdp = pdf(dp) / vs;
+        pv += w * (rdf * cdf(-dm) - s * qdf * Np);
+        pd += w * (qdf * pdp - rdf * pdm / s - qdf * Np);
+        pg += w * (rdf * pdm * (1.0 + dm / vs) / (s * s) + qdf * pdp * (1.0 - dp / vs) / s);
+    }
+    return {eu.v + pv, eu.dv + pd, eu.d2v + pg};
+}
+
+// Put-frame inputs after put-call symmetry: a call on S struck at K is a put on K struck
+// at S with r and q swapped, and the unit-strike put is priced at s = spot / strike.
+struct Frame {
+    double s, scale, r, q;
+};
+
+inline Frame frame(double S, double K, double r, double q, bool is_call) {
+    if (is_call) return {K / S, S, q, r};
+    return {S / K, K, r, q};
+}
+
+} // namespace
+
+double price(double S, double K, double r, double q, double T, double vol, bool is_call, const Scheme& scheme) {
+    check_scheme(scheme);
+    if (T <= 0.0 || vol <= 0.0) return is_call ? std::max(0.0, S - K) : std::max(0.0, K - S);
+    const Frame f = frame(S, K, r, q, is_call);
+    switch (regime(f.r, f.q)) {
+    case Regime::European: return vol::bs::price(S, K, r, q, T, vol, is_call);
+    case Regime::Tree: return vol::binom::price(S, K, r, q, T, vol, FALLBACK_STEPS, is_call, true);
+    case Regime::Boundary: break;
+    }
+    const Tables& tb = tables(scheme);
+    Boundary b;
+    solve_boundary(f.r, f.q, T, vol, scheme, tb, b);
+    if (std::log(f.s) <= b.log_at_valuation()) return f.scale * (1.0 - f.s);
+    return f.scale * put_value(f.s, f.r, f.q, T, vol, tb, b, false).v;
+}
+
+PriceGreeks price_greeks(double S, double K, double r, double q, double T, double vol, bool is_call,
+                         const Scheme& scheme) {
+    check_scheme(scheme);
+    if (T <= 0.0 || vol <= 0.0) {
+        const double p = is_call ? std::max(0.0, S - K) : std::max(0.0, K - S);
+        return {p, (is_call ? (S > K ? 1.0 : 0.0) : (S < K ? -1.0 : 0.0)), 0.0, 0.0, 0.0, 0.0};
+    }
+    const Frame f = frame(S, K, r, q, is_call);
+    switch (regime(f.r, f.q)) {
+    case Regime::European: {
+        const auto g = vol::bs::price_greeks(S, K, r, q, T, vol, is_call);
+        return {g.price, g.delta, g.gamma, g.vega, g.theta, g.rho};
+    }
+    case Regime::Tree: return vol::binom::price_greeks(S, K, r, q, T, vol, FALLBACK_STEPS, is_call, true);
+    case Regime::Boundary: break;
+    }
+
+    const Tables& tb = tables(scheme);
+    Boundary b;
+    solve_boundary(f.r, f.q, T, vol, scheme, tb, b);
+    PutValue pv{1.0 - f.s, -1.0, 0.0};
+    double theta = 0.0;
+    if (std::log(f.s) > b.log_at_valuation()) {
+        pv = put_value(f.s, f.r, f.q, T, vol, tb, b, true);
+        // calendar theta from the pricing PDE in the continuation region
+        theta = f.scale * (f.r * pv.v - (f.r - f.q) * f.s * pv.dv - 0.5 * vol * vol * f.s * f.s * pv.d2v);
+    }
+
+    // spot derivatives back out of the unit-strike frame: V = K v(S / K) for puts and
+    // V = S v(K / S) for calls
+    const double value = f.scale * pv.v;
+    const double delta = is_call ? pv.v - f.s * pv.dv : pv.dv;
+    const double gamma = is_call ? f.s * f.s * pv.d2v / S : pv.d2v / K;
+
+    const double hvol = std::max(1e-8, 1e-4 * std::max(1.0, vol));
+    const double vol_dn = std::max(1e-12, vol - hvol);
+    const double vega = (price(S, K, r, q, T, vol + hvol, is_call, scheme) -
+                         price(S, K, r, q, T, vol_dn, is_call, scheme)) / (vol + hvol - vol_dn);
+    const double hr = std::max(1e-8, 1e-5 * std::max(1.0, std::fabs(r)));
+    const double rho = (price(S, K, r + hr, q, T, vol, is_call, scheme) -
+                        price(S, K, r - hr, q, T, vol, is_call, scheme)) / (2.0 * hr);
+
+    return {value, delta, gamma, vega, theta, rho};
+}
+
+double exercise_boundary(double K, double r, double q, double T, double vol, bool is_call, double tau,
+                         const Scheme& scheme) {
+    check_scheme(scheme);
+    const double rp = is_call ? q : r;
+    const double qp = is_call ? r : q;
+    if (T <= 0.0 || vol <= 0.0 || regime(rp, qp) != Regime::Boundary) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    const Tables& tb = tables(scheme);
+    Boundary b;
+    solve_boundary(rp, qp, T, vol, scheme, tb, b);
+    double row[MAX_NODES];
+    interpolation_row(tb.n, 2.0 * std::sqrt(std::clamp(tau, 0.0, T) / T) - 1.0, row, 1);
+    double H = 0.0;
+    for (int j = 0; j < tb.n; ++j) H += row[j] * b.H[j];
+    const double unit = b.X * std::exp(-std::sqrt(std::max(H, 0.0)));
+    return is_call ? K / unit : K * unit;
+}
+
+} // namespace vol::american
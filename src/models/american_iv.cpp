@@ -0,0 +1,121 @@
+#include "libvol/models/american.hpp"
+#include "libvol/math/root_finders.hpp"
+#include "libvol/util/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+namespace vol::american {
+
+namespace {
+
+constexpr double MIN_SIGMA = 1e-3;
+constexpr double MAX_SIGMA = 5.0;
+constexpr int MAX_STEPS = 30;
+constexpr int MAX_BRENT_ITERS = 100;
+
+bs::IVResult failed() {
+    return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
+}
+
+} // namespace
+
+bs::IVResult implied_vol(double S, double K, double r, double q, double T, double target, bool is_call,
+                         const Scheme& scheme, double tol) {
+    if (!(std::isfinite(S) && std::isfinite(K) && std::isfinite(r) && std::isfinite(q) && std::isfinite(T) &&
+          std::isfinite(target))) {
+        return failed();
+    }
+    if (S <= 0.0 || K <= 0.0 || T <= 0.0 || target < 0.0) {
+        return failed();
+    }
+
+    // same regimes as price(): no early exercise means the European solver is exact
+    const bool european = is_call ? (q <= 0.0 && r >= q) : (r <= 0.0 && q >= r);
+    if (european) {
+        return bs::implied_vol(S, K, r, q, T, target, is_call, 0.2, tol);
+    }
+
+    // the American price runs from intrinsic (vol -> 0) to S for calls and K for puts
+    const double intrinsic = is_call ? std::max(0.0, S - K) : std::max(0.0, K - S);
+    const double max_price = is_call ? S : K;
+    if (target < intrinsic * (1.0 - 1e-10) || target >= max_price * (1.0 - 1e-12)) {
+        return failed();
+    }
+    if (target <= intrinsic * (1.0 + 1e-4) + 1e-14) {
+        return {0.0, 0, 0, true};
+    }
+
+    const double vol_tol = std::max(1e-12, tol);
+    const double price_tol = std::max(1e-12, 1e-10 * std::max(1.0, target));
+    auto f = [&](double sigma) { return price(S, K, r, q, T, sigma, is_call, scheme) - target; };
+
+    // The American price is increasing in vol: every evaluation moves one end of the bracket.
+    // The ends start unevaluated, so the bounds are only used to keep steps inside.
+    double lo = MIN_SIGMA, hi = MAX_SIGMA;
+    double f_lo = std::numeric_limits<double>::quiet_NaN(), f_hi = f_lo;
+
+    // European IV of the American price overstates the vol by the premium's worth of vega
+    const auto eu = bs::implied_vol(S, K, r, q, T, target, is_call, 0.2, 1e-8);
+    double sigma = eu.converged && eu.iv > MIN_SIGMA && eu.iv < MAX_SIGMA ? eu.iv : 0.3;
+
+    double prev = std::numeric_limits<double>::quiet_NaN(), f_prev = prev;
+    int steps = 0;
+    for (; steps < MAX_STEPS; ++steps) {
+        const double fs = f(sigma);
+        if (std::abs(fs) <= price_tol) {
+            return {sigma, steps + 1, 0, true};
+        }
+        if (fs > 0.0) {
+            hi = sigma;
+            f_hi = fs;
+        } else {
+            lo = sigma;
+            f_lo = fs;
+        }
+
+        // secant on the American price once there are two points, BS vega before that
+        double slope = std::isfinite(prev) && sigma != prev ? (fs - f_prev) / (sigma - prev) : 0.0;
+        if (!(slope > 0.0)) slope = bs::price_greeks(S, K, r, q, T, sigma, is_call).vega;
+        double next = slope > 1e-12 ? sigma - fs / slope : 0.5 * (lo + hi);
+        if (!(next > lo && next < hi)) next = 0.5 * (lo + hi);
+
+        prev = sigma;
+        f_prev = fs;
+        if (std::abs(next - sigma) <= vol_tol) {
+            return {next, steps + 1, 0, true};
+        }
+        sigma = next;
+    }
+
+    // fall back to Brent on the bracket, closing any end that was never evaluated
+    if (!std::isfinite(f_lo)) f_lo = f(lo);
+    if (!std::isfinite(f_hi)) f_hi = f(hi);
+    if (!(f_lo <= 0.0 && f_hi >= 0.0)) {
+        return {std::numeric_limits<double>::quiet_NaN(), steps, 0, false};
+    }
+    const auto br = vol::root::brent(f, lo, hi, vol_tol, MAX_BRENT_ITERS);
+    return {br.x, steps, br.iters, br.converged};
+}
+
+void implied_vol(const Chain& chain, std::span<const double> prices, std::span<bs::IVResult> out,
+                 const Scheme& scheme, int n_threads, double tol) {
+    const std::size_t n = chain.size();
+    if (prices.size() != n || out.size() != n) {
+        throw std::invalid_argument("american::implied_vol(Chain): prices/out length must match the chain");
+    }
+    const ExpiryContext& ex = chain.expiry;
+    auto solve = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = implied_vol(ex.S, chain.K[i], ex.r, ex.q, ex.T, prices[i], chain.is_call[i] != 0, scheme, tol);
+        }
+    };
+
+    // each quote is a handful of boundary solves, so even short chains are worth splitting
+    vol::util::parallel_for(n, n_threads, 4, solve);
+}
+
+} // namespace vol::american
@@ -2,7 +2,11 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <barrier>
+#include <cfloat>
 #include <limits>
+#include <stdexcept>
+#include <thread>
 
 namespace vol::binom {
 
@@ -27,9 +31,111 @@ namespace {
         return {dt, u, d, p, disc};
     }
 
-    //CRR engine
+    struct Node {
+        double disc, prob, d, K;
+        bool is_call, is_american;
+    };
+
+    // One backward step for positions [lo, hi): V[j] and S[j] move from layer n + 1 to n in
+    // place, ascending so V[j + 1] still holds layer n + 1. Returns true if exercise beat
+    // continuation at any of them. Serial and tiled engines share it, so they agree bit for bit.
+    template <bool American, bool Call>
+    bool induct_range(const Node& c, double* V, double* S, int lo, int hi) {
+        const double disc = c.disc, prob = c.prob, d = c.d, K = c.K;
+        double exercised = 0.0;   // a double flag keeps every lane the same width
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd reduction(max:exercised)
+#endif
+        for (int j = lo; j < hi; ++j) {
+            double v = disc * (prob * V[j + 1] + (1.0 - prob) * V[j]);
+            const double S_nj = S[j] / d;
+            if constexpr (American) {
+                // std::max spelled out: its reference return keeps the loop from vectorising
+                const double x = Call ? S_nj - K : K - S_nj;
+                const double exer = 0.0 < x ? x : 0.0;
+                exercised = exer > v + 1e-16 ? 1.0 : exercised;
+                v = v < exer ? exer : v;
+            }
+            // far out-of-the-money values decay into denormals, whose arithmetic is ~50x slower;
+            // flushing at the store (not before the compare) keeps the loop vectorisable
+            V[j] = v < DBL_MIN ? 0.0 : v;
+            S[j] = S_nj;
+        }
+        return exercised != 0.0;
+    }
+
+    inline bool induct(const Node& c, double* V, double* S, int lo, int hi) {
+        if (!c.is_american) return induct_range<false, false>(c, V, S, lo, hi);
+        return c.is_call ? induct_range<true, true>(c, V, S, lo, hi) : induct_range<true, false>(c, V, S, lo, hi);
+    }
+
+    // Bands of cfg.layers layers from layer `top` down while at least two tiles fit; returns the
+    // layer reached. Every worker walks the same band schedule and takes tiles w, w + T, ...
+    int induct_tiled(const Node& c, std::vector<double>& V, std::vector<double>& S, int top,
+                     const LatticeConfig& cfg, int& earliest_ex_step)
+    {
+        const int B = cfg.block;
+        const int L = std::min(cfg.layers, B);
+        if (top + 1 < 2 * B) return top;
+        const int max_tiles = (top + 1) / B;
+        const int workers = std::min(max_tiles, cfg.n_threads > 0 ? cfg.n_threads
+                                                 : static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+
+        // edge[b * L + k]: V at tile b's first node after k layers of the current band
+        std::vector<double> edge(static_cast<std::size_t>(max_tiles) * L);
+        std::vector<int> ex(workers, -1);
+        std::barrier sync(workers);
+
+        auto work = [&](int w) {
+            std::vector<double> tv(L + 1), ts(L + 1);
+            int seen = -1;
+            for (int n0 = top; n0 + 1 >= 2 * B; n0 -= L) {
+                const int tiles = (n0 + 1) / B;
+                // trapezoids: tile b owns [b B, end), the last tile absorbs the remainder
+                for (int b = w; b < tiles; b += workers) {
+                    const int a = b * B;
+                    const int end = b + 1 < tiles ? a + B : n0 + 1;
+                    double* e = edge.data() + static_cast<std::size_t>(b) * L;
+                    for (int k = 1; k <= L; ++k) {
+                        e[k - 1] = V[a];
+                        if (induct(c, V.data(), S.data(), a, end - k)) seen = std::max(seen, n0 - k);
+                    }
+                }
+                sync.arrive_and_wait();
+                // triangles: positions [end - L, end) of every tile but the last, whose position
+                // end - k still holds layer k - 1; node end reads the right neighbour's edge column
+                for (int b = w; b + 1 < tiles; b += workers) {
+                    const int end = (b + 1) * B;
+                    const double* e = edge.data() + static_cast<std::size_t>(b + 1) * L;
+                    for (int k = 1; k <= L; ++k) {
+                        tv[L - k] = V[end - k];
+                        ts[L - k] = S[end - k];
+                        tv[L] = e[k - 1];
+                        if (induct(c, tv.data(), ts.data(), L - k, L)) seen = std::max(seen, n0 - k);
+                    }
+                    std::copy(tv.begin(), tv.begin() + L, V.begin() + (end - L));
+                    std::copy(ts.begin(), ts.begin() + L, S.begin() + (end - L));
+                }
+                sync.arrive_and_wait();
+            }
+            ex[w] = seen;
+        };
+
+        std::vector<std::thread> pool;
+        for (int w = 1; w < workers; ++w) pool.emplace_back(work, w);
+        work(0);
+        for (auto& t : pool) t.join();
+
+        for (int e : ex) earliest_ex_step = std::max(earliest_ex_step, e);
+        int n0 = top;
+        while (n0 + 1 >= 2 * B) n0 -= L;
+        return n0;
+    }
+
+    //CRR engine; tiled when cfg is non-null
     double price_crr(double S0, double K, double r, double q, double T, double vol,
-                    int steps, bool is_call, bool is_american, int* early_ex_step_out)
+                    int steps, bool is_call, bool is_american, int* early_ex_step_out,
+                    const LatticeConfig* cfg = nullptr)
     {
         if (steps <= 0) {
             // degenerate: fallback to intrinsic at expiry
@@ -53,25 +159,15 @@ namespace {
             Sj *= ud;
         }
 
+        // the first layer met going backwards with exercise beating continuation
         int earliest_ex_step = -1;
+        const Node c{p.disc, prob, p.d, K, is_call, is_american};
+        const int top = cfg ? induct_tiled(c, V, S, steps, *cfg, earliest_ex_step) : steps;
 
         //backward induction
-        for (int n = steps - 1; n >= 0; --n) {
-            for (int j = 0; j <= n; ++j) {
-                const double cont = p.disc * (prob * V[j + 1] + (1.0 - prob) * V[j]);
-                if (is_american) {
-                    const double S_nj = S[j] / p.d;
-                    const double exer = intrinsic(is_call, S_nj, K);
-                    const double vn = std::max(cont, exer);
-                    if (earliest_ex_step == -1 && exer > cont + 1e-16) {
-                        earliest_ex_step = n;
-                    }
-                    V[j] = vn;
-                    S[j] = S_nj;
-                } else {
-                    V[j] = cont;
-                    S[j] = S[j] / p.d;
-                }
+        for (int n = top - 1; n >= 0; --n) {
+            if (induct(c, V.data(), S.data(), 0, n + 1) && earliest_ex_step == -1) {
+                earliest_ex_step = n;
             }
         }
 
@@ -79,6 +175,12 @@ namespace {
         return V[0];
     }
 
+    void validate(const LatticeConfig& cfg) {
+        if (cfg.block <= 0 || cfg.layers <= 0) {
+            throw std::invalid_argument("binom: LatticeConfig block and layers must be positive");
+        }
+    }
+
     inline double safe_dt_for_theta(double T) {
         const double min_dt = 1.0 / 3650.0;       // ~0.1 day
         const double frac_T = 0.05 * T;           // 5% of T
@@ -100,6 +202,22 @@ BinomialResult price_w_info(double S, double K, double r, double q, double T,
     return {px, earliest};
 }
 
+double price_parallel(double S, double K, double r, double q, double T, double vol, int steps, bool is_call, bool is_american,
+                      const LatticeConfig& cfg)
+{
+    validate(cfg);
+    return price_crr(S, K, r, q, T, vol, steps, is_call, is_american, nullptr, &cfg);
+}
+
+BinomialResult price_w_info_parallel(double S, double K, double r, double q, double T, double vol, int steps,
+                                     bool is_call, bool is_american, const LatticeConfig& cfg)
+{
+    validate(cfg);
+    int earliest = -1;
+    const double px = price_crr(S, K, r, q, T, vol, steps, is_call, is_american, &earliest, &cfg);
+    return {px, earliest};
+}
+
 PriceGreeks price_greeks(double S, double K, double r, double q, double T, double vol, int steps, bool is_call, bool is_american)
 {
     const double base = price(S, K, r, q, T, vol, steps, is_call, is_american);
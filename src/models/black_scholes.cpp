@@ -1,11 +1,14 @@
 #include "libvol/models/black_scholes.hpp"
 #include "libvol/core/constants.hpp"
+#include "libvol/math/adjoint.hpp"
+#include "libvol/math/special.hpp"
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 namespace vol::bs {
     double phi(double x){ return std::exp(-0.5*x*x) * vol::INV_SQRT2PI; }
-    double Phi(double x){ return 0.5 * std::erfc(-x/std::sqrt(2.0)); }
+    double Phi(double x){ return vol::math::norm_cdf(x); }
 
     static inline double d1(double S,double K,double r,double q,double T,double vol, double sqT){
         return (std::log(S/K) + (r - q + 0.5*vol*vol)*T)/(vol*sqT);
@@ -32,6 +35,47 @@ namespace vol::bs {
         return disc*(K*Phi(-d_2) - F*Phi(-d_1));
     }
 
+    ad::Var price(const ad::Var& S,const ad::Var& K,const ad::Var& r,const ad::Var& q,const ad::Var& T,
+                  const ad::Var& vol,bool is_call){
+        if (T.value() <= 0) {
+            return is_call ? ad::max(S-K, 0.0) : ad::max(K-S, 0.0);
+        }
+        const ad::Var vst = vol*ad::sqrt(T);
+        const ad::Var d_1 = (ad::log(S/K) + (r-q)*T)/vst + 0.5*vst;
+        const ad::Var d_2 = d_1 - vst;
+        const ad::Var F_disc = S*ad::exp(-q*T);
+        const ad::Var K_disc = K*ad::exp(-r*T);
+        if (is_call) return F_disc*ad::norm_cdf(d_1) - K_disc*ad::norm_cdf(d_2);
+        return K_disc*ad::norm_cdf(-d_2) - F_disc*ad::norm_cdf(-d_1);
+    }
+
+    // Greeks from d1 and the per-expiry factors; shared by the scalar and chain overloads.
+    // Only the two Phi values the option type needs are evaluated, and the price is
+    // assembled from them instead of calling price() again.
+    static inline PriceGreeks greeks_from_d1(double S,double K,double r,double q,double T,double vol,
+                                             double sqT,double disc,double div_disc,double d_1,bool is_call){
+        const double d_2 = d2(d_1,vol,sqT);
+        const double K_disc = K*disc;
+        const double div_disc_nd1 = div_disc * phi(d_1);
+
+        const double gamma = div_disc_nd1/(S*vol*sqT);
+        const double vega  = S*div_disc_nd1*sqT;
+        const double decay = -0.5*S*div_disc_nd1*vol/sqT;
+
+        if (is_call) {
+            const double phi_d1 = Phi(d_1);
+            const double phi_d2 = Phi(d_2);
+            const double p = S*div_disc*phi_d1 - K_disc*phi_d2;
+            const double theta = decay + q*S*div_disc*phi_d1 - r*K_disc*phi_d2;
+            return { p, div_disc*phi_d1, gamma, vega, theta, T*K_disc*phi_d2 };
+        }
+        const double phi_neg_d1 = Phi(-d_1);
+        const double phi_neg_d2 = Phi(-d_2);
+        const double p = K_disc*phi_neg_d2 - S*div_disc*phi_neg_d1;
+        const double theta = decay - q*S*div_disc*phi_neg_d1 + r*K_disc*phi_neg_d2;
+        return { p, -div_disc*phi_neg_d1, gamma, vega, theta, -T*K_disc*phi_neg_d2 };
+    }
+
     PriceGreeks price_greeks(double S,double K,double r,double q,double T,double vol,bool is_call){
         if (T <= 0.0 || vol <= 0.0) {
             const double p = price(S,K,r,q,T,vol,is_call);
@@ -40,33 +84,41 @@ namespace vol::bs {
 
         // defs for efficiency
         const double disc = std::exp(-r*T);
-        const double K_disc = K*disc; 
-        const double div_disc = std::exp(-q*T); 
+        const double div_disc = std::exp(-q*T);
         const double sqT = std::sqrt(T);
         const double d_1 = d1(S,K,r,q,T,vol,sqT);
-        const double d_2 = d2(d_1,vol,sqT);
-        const double nd1 = phi(d_1);
-        const double div_disc_nd1 = div_disc * nd1;
-        const double phi_d1 = Phi(d_1);
-        const double phi_neg_d1 = Phi(-1.0 * d_1);
-        const double phi_d2 = Phi(d_2);
-        const double phi_neg_d2 = Phi(-1.0 * d_2);
-
-        const double call_delta = div_disc*Phi(d_1);
-        const double delta = is_call ? call_delta : (call_delta - div_disc);
+        return greeks_from_d1(S,K,r,q,T,vol,sqT,disc,div_disc,d_1,is_call);
+    }
 
-        const double gamma = div_disc_nd1/(S*vol*sqT);
-        const double vega  = S*div_disc_nd1*sqT;
+    // --- ExpiryContext / Chain overloads ---
 
-        const double theta_call = -0.5*S*div_disc_nd1*vol/sqT + q*S*div_disc*phi_d1 - r*K_disc*phi_d2;
-        const double theta_put = -0.5*S*div_disc_nd1*vol/sqT - q*S*div_disc*phi_neg_d1 + r*K_disc*phi_neg_d2;
-        const double theta = is_call ? theta_call : theta_put;
+    double price(const ExpiryContext& ex,double K,double k,double vol,bool is_call){
+        if (ex.T <= 0) {
+            return is_call ? std::max(0.0, ex.S-K) : std::max(0.0, K-ex.S);
+        }
+        const double vst = vol*ex.sqrt_T;
+        const double d_1 = (-k + 0.5*vst*vst)/vst;
+        const double d_2 = d_1 - vst;
+        if (is_call) return ex.df_r*(ex.forward*Phi(d_1) - K*Phi(d_2));
+        return ex.df_r*(K*Phi(-d_2) - ex.forward*Phi(-d_1));
+    }
 
-        const double rho_call = T*K_disc*Phi(d_2);
-        const double rho_put = -T*K_disc*Phi(-d_2);
-        const double rho = is_call ? rho_call : rho_put;
+    PriceGreeks price_greeks(const ExpiryContext& ex,double K,double k,double vol,bool is_call){
+        if (ex.T <= 0.0 || vol <= 0.0) {
+            return price_greeks(ex.S,K,ex.r,ex.q,ex.T,vol,is_call);
+        }
+        const double vst = vol*ex.sqrt_T;
+        const double d_1 = (-k + 0.5*vst*vst)/vst;
+        return greeks_from_d1(ex.S,K,ex.r,ex.q,ex.T,vol,ex.sqrt_T,ex.df_r,ex.df_q,d_1,is_call);
+    }
 
-        const double p = price(S,K,r,q,T,vol,is_call);
-        return { p, delta, gamma, vega, theta, rho };
+    void price(const Chain& chain,std::span<const double> vols,std::span<double> out){
+        const std::size_t n = chain.size();
+        if (vols.size() != n || out.size() != n) {
+            throw std::invalid_argument("bs::price(Chain): vols/out length must match the chain");
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = price(chain.expiry, chain.K[i], chain.k[i], vols[i], chain.is_call[i] != 0);
+        }
     }
 } // namespace vol::bs
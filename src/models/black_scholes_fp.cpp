@@ -0,0 +1,188 @@
+// Built with -ffast-math under VOL_ENABLE_SIMD (see CMakeLists.txt) so the batch loops use
+// glibc's vector exp/log/erfc, in both float and double widths.
+#include "libvol/models/black_scholes_fp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// The Greeks kernel is past GCC's inlining limits, and an out-of-line call keeps the
+// batch loops scalar; flatten pulls the kernels into the loop bodies.
+#if defined(__GNUC__)
+#define VOL_FLATTEN __attribute__((flatten))
+#else
+#define VOL_FLATTEN
+#endif
+
+namespace vol::bs::fp {
+
+namespace {
+
+// The option type is passed to the kernels as a Real sign (> 0 for calls) rather than the
+// uint8 flag: a byte load in the loop makes GCC size the vectors by the byte type, which
+// leaves the double loops scalar on AVX2 / AVX-512.
+constexpr std::size_t SIGN_BLOCK = 256;
+
+template <std::floating_point Real, class Body>
+inline void for_each_signed_block(const std::uint8_t* is_call, std::size_t n, Body&& body) {
+    Real sgn[SIGN_BLOCK];
+    for (std::size_t base = 0; base < n; base += SIGN_BLOCK) {
+        const std::size_t m = std::min(SIGN_BLOCK, n - base);
+        for (std::size_t j = 0; j < m; ++j) sgn[j] = is_call[base + j] ? Real(1) : Real(-1);
+        body(base, static_cast<std::ptrdiff_t>(m), static_cast<const Real*>(sgn));
+    }
+}
+
+} // namespace
+
+template <std::floating_point Real>
+VOL_FLATTEN void price_batch(const Real* __restrict S, const Real* __restrict K, const Real* __restrict r,
+                             const Real* __restrict q, const Real* __restrict T, const Real* __restrict vol,
+                             const std::uint8_t* __restrict is_call, std::size_t n, Real* __restrict out) {
+    for_each_signed_block<Real>(is_call, n, [&](std::size_t b, std::ptrdiff_t m, const Real* __restrict sgn) {
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (std::ptrdiff_t i = 0; i < m; ++i) {
+            out[b + i] = price<Real>(S[b + i], K[b + i], r[b + i], q[b + i], T[b + i], vol[b + i], sgn[i] > Real(0));
+        }
+    });
+}
+
+template <std::floating_point Real>
+VOL_FLATTEN void price_greeks_batch(const Real* __restrict S, const Real* __restrict K,
+                                    const Real* __restrict r, const Real* __restrict q,
+                                    const Real* __restrict T, const Real* __restrict vol,
+                                    const std::uint8_t* __restrict is_call, std::size_t n,
+                                    const GreeksSoA<Real>& out) {
+    Real* __restrict price_out = out.price;
+    Real* __restrict delta = out.delta;
+    Real* __restrict gamma = out.gamma;
+    Real* __restrict vega = out.vega;
+    Real* __restrict theta = out.theta;
+    Real* __restrict rho = out.rho;
+    for_each_signed_block<Real>(is_call, n, [&](std::size_t b, std::ptrdiff_t m, const Real* __restrict sgn) {
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (std::ptrdiff_t i = 0; i < m; ++i) {
+            const std::size_t j = b + i;
+            price_greeks<Real>(S[j], K[j], r[j], q[j], T[j], vol[j], sgn[i] > Real(0),
+                               price_out[j], delta[j], gamma[j], vega[j], theta[j], rho[j]);
+        }
+    });
+}
+
+template void price_batch<float>(const float*, const float*, const float*, const float*,
+                                 const float*, const float*, const std::uint8_t*, std::size_t, float*);
+template void price_batch<double>(const double*, const double*, const double*, const double*,
+                                  const double*, const double*, const std::uint8_t*, std::size_t, double*);
+template void price_greeks_batch<float>(const float*, const float*, const float*, const float*,
+                                        const float*, const float*, const std::uint8_t*, std::size_t,
+                                        const GreeksSoA<float>&);
+template void price_greeks_batch<double>(const double*, const double*, const double*, const double*,
+                                         const double*, const double*, const std::uint8_t*, std::size_t,
+                                         const GreeksSoA<double>&);
+
+namespace {
+
+constexpr std::size_t IV_BLOCK = SIGN_BLOCK;
+constexpr int FLOAT_STEPS = 12;
+constexpr int DOUBLE_STEPS = 2;
+constexpr double VOL_LO = 1e-4;
+constexpr double VOL_HI = 10.0;
+
+// One Newton step on the BS price in vol, clamped to [VOL_LO, VOL_HI]. Returns the step.
+template <std::floating_point Real>
+inline Real newton_step(Real S, Real K, Real r, Real q, Real T, Real target, bool is_call, Real& vol) {
+    Real p, delta, gamma, vega, theta, rho;
+    price_greeks<Real>(S, K, r, q, T, vol, is_call, p, delta, gamma, vega, theta, rho);
+    const Real step = (p - target) / std::fmax(vega, Real(1e-12));
+    const Real next = std::clamp(vol - step, Real(VOL_LO), Real(VOL_HI));
+    const Real taken = vol - next;
+    vol = next;
+    return taken;
+}
+
+} // namespace
+
+VOL_FLATTEN void implied_vol_mixed(const double* S, const double* K, const double* r, const double* q,
+                                   const double* T, const double* price, const std::uint8_t* is_call,
+                                   std::size_t n, IVResult* out, double tol) {
+    float sf[IV_BLOCK], kf[IV_BLOCK], rf[IV_BLOCK], qf[IV_BLOCK], tf[IV_BLOCK], pf[IV_BLOCK], vf[IV_BLOCK];
+    float sgn_f[IV_BLOCK];
+    double otm[IV_BLOCK], sgn_d[IV_BLOCK], vd[IV_BLOCK], last[IV_BLOCK];
+
+    for (std::size_t base = 0; base < n; base += IV_BLOCK) {
+        const std::ptrdiff_t m = static_cast<std::ptrdiff_t>(std::min(IV_BLOCK, n - base));
+        const double* S_b = S + base;
+        const double* K_b = K + base;
+        const double* r_b = r + base;
+        const double* q_b = q + base;
+        const double* T_b = T + base;
+        const double* p_b = price + base;
+        const std::uint8_t* c_b = is_call + base;
+
+        // Solve on the out-of-the-money side (put-call parity in double): an ITM price is
+        // mostly intrinsic value and float cannot resolve the time value on top of it.
+        // Start at the inflection point sqrt(2 |log(F/K)| / T), from which Newton on the
+        // price is monotone (Manaster-Koehler), or at the Brenner-Subrahmanyam ATM guess
+        // when that is larger.
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (std::ptrdiff_t i = 0; i < m; ++i) {
+            const double Ti = std::max(T_b[i], 1e-12);
+            const double x = std::log(S_b[i] / K_b[i]) + (r_b[i] - q_b[i]) * Ti;
+            const double S_dq = S_b[i] * std::exp(-q_b[i] * Ti);
+            const bool call = c_b[i] != 0;
+            const bool itm = call ? x > 0.0 : x < 0.0;
+            const double parity = S_dq - K_b[i] * std::exp(-r_b[i] * Ti);
+            otm[i] = itm ? (call ? p_b[i] - parity : p_b[i] + parity) : p_b[i];
+            sgn_d[i] = (itm ? !call : call) ? 1.0 : -1.0;
+            sgn_f[i] = static_cast<float>(sgn_d[i]);
+            const double inflection = std::sqrt(2.0 * std::abs(x) / Ti);
+            const double atm = 2.5066282746310002 * otm[i] / (S_dq * std::sqrt(Ti));
+            sf[i] = static_cast<float>(S_b[i]);
+            kf[i] = static_cast<float>(K_b[i]);
+            rf[i] = static_cast<float>(r_b[i]);
+            qf[i] = static_cast<float>(q_b[i]);
+            tf[i] = static_cast<float>(Ti);
+            pf[i] = static_cast<float>(otm[i]);
+            vf[i] = static_cast<float>(std::clamp(std::max(inflection, atm), VOL_LO, VOL_HI));
+        }
+
+        for (int it = 0; it < FLOAT_STEPS; ++it) {
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+            for (std::ptrdiff_t i = 0; i < m; ++i) {
+                newton_step<float>(sf[i], kf[i], rf[i], qf[i], tf[i], pf[i], sgn_f[i] > 0.0f, vf[i]);
+            }
+        }
+
+        for (std::ptrdiff_t i = 0; i < m; ++i) vd[i] = vf[i];
+        for (int it = 0; it < DOUBLE_STEPS; ++it) {
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+            for (std::ptrdiff_t i = 0; i < m; ++i) {
+                last[i] = newton_step<double>(S_b[i], K_b[i], r_b[i], q_b[i], T_b[i], otm[i], sgn_d[i] > 0.0,
+                                              vd[i]);
+            }
+        }
+
+        for (std::ptrdiff_t i = 0; i < m; ++i) {
+            const bool settled = std::abs(last[i]) <= tol && vd[i] > VOL_LO && vd[i] < VOL_HI && T_b[i] > 0.0;
+            if (settled) {
+                out[base + i] = {vd[i], DOUBLE_STEPS, 0, true};
+            } else {
+                out[base + i] = bs::implied_vol(S_b[i], K_b[i], r_b[i], q_b[i], T_b[i], p_b[i], c_b[i] != 0,
+                                                static_cast<double>(vf[i]), tol);
+            }
+        }
+    }
+}
+
+} // namespace vol::bs::fp
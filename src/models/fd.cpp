@@ -0,0 +1,459 @@
+#include "libvol/models/fd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace vol::fd {
+
+namespace {
+
+// Moneyness grid x_i = 1 + c sinh(xi_i) with its three-point difference weights:
+// f'(x_i) ~ d1m f_{i-1} + d1c f_i + d1p f_{i+1}, likewise d2* for f''.
+struct Grid {
+    std::vector<double> x;
+    std::vector<double> d1m, d1c, d1p, d2m, d2c, d2p;
+
+    int size() const { return static_cast<int>(x.size()); }
+};
+
+Grid make_grid(double x_lo, double x_hi, int steps, double c) {
+    Grid g;
+    const double xi_lo = std::asinh((x_lo - 1.0) / c);
+    const double xi_hi = std::asinh((x_hi - 1.0) / c);
+    g.x.resize(steps + 1);
+    for (int i = 0; i <= steps; ++i) {
+        g.x[i] = 1.0 + c * std::sinh(xi_lo + (xi_hi - xi_lo) * i / steps);
+    }
+    g.d1m.assign(steps + 1, 0.0);
+    g.d1c = g.d1p = g.d2m = g.d2c = g.d2p = g.d1m;
+    for (int i = 1; i < steps; ++i) {
+        const double hm = g.x[i] - g.x[i - 1];
+        const double hp = g.x[i + 1] - g.x[i];
+        g.d1m[i] = -hp / (hm * (hm + hp));
+        g.d1c[i] = (hp - hm) / (hm * hp);
+        g.d1p[i] = hm / (hp * (hm + hp));
+        g.d2m[i] = 2.0 / (hm * (hm + hp));
+        g.d2c[i] = -2.0 / (hm * hp);
+        g.d2p[i] = 2.0 / (hp * (hm + hp));
+    }
+    return g;
+}
+
+// Strikes ("lanes") stepping together on one grid. Node-major storage [i * L + m], so every
+// loop over lanes is contiguous.
+struct Lanes {
+    int L = 0;
+    bool is_call = false;
+    bool is_american = false;
+    std::vector<double> x_spot;   // S / K per lane
+    std::vector<double> vol;      // per lane; ignored with a local-vol surface
+};
+
+// Per-lane result in strike units: V = K v, delta = v', gamma = v'' / K, theta = -K dv/dtau
+struct LaneValue {
+    double v, dv, d2v, dv_dtau;
+};
+
+inline double payoff(bool is_call, double x) { return is_call ? std::max(x - 1.0, 0.0) : std::max(1.0 - x, 0.0); }
+
+// Dirichlet values at the grid ends, tau to expiry
+inline double boundary(bool is_call, bool is_american, double x, double r, double q, double tau, bool upper) {
+    if (is_call != upper) return 0.0;
+    const double forward = is_call ? x * std::exp(-q * tau) - std::exp(-r * tau)
+                                   : std::exp(-r * tau) - x * std::exp(-q * tau);
+    return is_american ? std::max(forward, payoff(is_call, x)) : forward;
+}
+
+// Quadratic through the three nodes around x: value, first and second derivative
+void read_off(const Grid& g, const double* V, int L, int m, double x, double out[3]) {
+    const int n = g.size();
+    int j = static_cast<int>(std::upper_bound(g.x.begin(), g.x.end(), x) - g.x.begin()) - 1;
+    j = std::clamp(j, 0, n - 2);
+    // centre on the nearer node, away from the ends
+    int c = (x - g.x[j] < g.x[j + 1] - x) ? j : j + 1;
+    c = std::clamp(c, 1, n - 2);
+    const double x0 = g.x[c - 1], x1 = g.x[c], x2 = g.x[c + 1];
+    const double f0 = V[(c - 1) * L + m], f1 = V[c * L + m], f2 = V[(c + 1) * L + m];
+    const double w0 = f0 / ((x0 - x1) * (x0 - x2));
+    const double w1 = f1 / ((x1 - x0) * (x1 - x2));
+    const double w2 = f2 / ((x2 - x0) * (x2 - x1));
+    out[0] = w0 * (x - x1) * (x - x2) + w1 * (x - x0) * (x - x2) + w2 * (x - x0) * (x - x1);
+    out[1] = w0 * (2.0 * x - x1 - x2) + w1 * (2.0 * x - x0 - x2) + w2 * (2.0 * x - x0 - x1);
+    out[2] = 2.0 * (w0 + w1 + w2);
+}
+
+// The theta-scheme system for every lane at once, rows 1..n-2:
+//   lo_i V_{i-1} + di_i V_i + up_i V_{i+1} = rhs_i
+// with the boundary values folded into rhs. Brennan-Schwartz projects onto the payoff
+// during back substitution, which therefore has to start from the exercise side: low x for
+// puts, so the elimination runs from the top down, and the reverse for calls.
+//
+// The elimination only depends on the matrix, so it is split out: with constant vol the
+// matrix is the same every step and only the substitution below runs per step. The
+// substitution is a serial chain down the grid in each lane; the lanes are what vectorise.
+struct Factor {
+    std::vector<double> pivot;   // 1 / modified diagonal
+    std::vector<double> carry;   // modified off-diagonal towards the substitution start
+};
+
+void factor_tridiagonal(int n, const Lanes& ln, const double* lo, const double* di, const double* up, Factor& f) {
+    const int L = ln.L;
+    f.pivot.resize(static_cast<std::size_t>(n) * L);
+    f.carry.resize(f.pivot.size());
+    double* __restrict pivot = f.pivot.data();
+    double* __restrict carry = f.carry.data();
+    const int first = ln.is_call ? 1 : n - 2;
+    const int step = ln.is_call ? 1 : -1;
+    const double* along = ln.is_call ? lo : up;   // couples to the already-eliminated row
+    const double* ahead = ln.is_call ? up : lo;
+    for (int i = first; i >= 1 && i <= n - 2; i += step) {
+        const std::size_t o = static_cast<std::size_t>(i) * L;
+        const std::size_t p = o - static_cast<std::ptrdiff_t>(step) * L;
+        const bool start = i == first;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (int m = 0; m < L; ++m) {
+            const double den = start ? di[o + m] : di[o + m] - along[o + m] * carry[p + m];
+            pivot[o + m] = 1.0 / den;
+            carry[o + m] = ahead[o + m] * pivot[o + m];
+        }
+    }
+}
+
+void substitute(const Grid& g, const Lanes& ln, const double* lo, const double* up, const Factor& f,
+                double* __restrict rhs, double* __restrict V, bool project) {
+    const int n = g.size();
+    const int L = ln.L;
+    const double* __restrict pivot = f.pivot.data();
+    const double* __restrict carry = f.carry.data();
+    const int first = ln.is_call ? 1 : n - 2;
+    const int last = ln.is_call ? n - 2 : 1;
+    const int step = ln.is_call ? 1 : -1;
+    const double* along = ln.is_call ? lo : up;
+    for (int i = first;; i += step) {
+        const std::size_t o = static_cast<std::size_t>(i) * L;
+        const std::size_t p = o - static_cast<std::ptrdiff_t>(step) * L;
+        const bool start = i == first;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (int m = 0; m < L; ++m) {
+            rhs[o + m] = (start ? rhs[o + m] : rhs[o + m] - along[o + m] * rhs[p + m]) * pivot[o + m];
+        }
+        if (i == last) break;
+    }
+    // back from the exercise side; the end node behind `last` holds its boundary value
+    for (int i = last;; i -= step) {
+        const std::size_t o = static_cast<std::size_t>(i) * L;
+        const std::size_t nb = o + static_cast<std::ptrdiff_t>(step) * L;
+        const double ex = payoff(ln.is_call, g.x[i]);
+        const bool edge = i == last;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (int m = 0; m < L; ++m) {
+            const double v = edge ? rhs[o + m] : rhs[o + m] - carry[o + m] * V[nb + m];
+            V[o + m] = project ? std::max(v, ex) : v;
+        }
+        if (i == first) break;
+    }
+}
+
+// Projected SOR on the same system, started from the current V (the previous time level)
+void solve_psor(const Grid& g, const Lanes& ln, const double* lo, const double* di, const double* up,
+                const double* rhs, double* V, const Config& cfg) {
+    const int n = g.size();
+    const int L = ln.L;
+    const double w = cfg.psor_omega;
+    for (int it = 0; it < cfg.psor_max_iters; ++it) {
+        double moved = 0.0;
+        for (int i = 1; i < n - 1; ++i) {
+            const std::size_t o = static_cast<std::size_t>(i) * L;
+            const double ex = payoff(ln.is_call, g.x[i]);
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd reduction(max:moved)
+#endif
+            for (int m = 0; m < L; ++m) {
+                const double gs = (rhs[o + m] - lo[o + m] * V[o - L + m] - up[o + m] * V[o + L + m]) / di[o + m];
+                const double v = std::max(ex, V[o + m] + w * (gs - V[o + m]));
+                moved = std::max(moved, std::abs(v - V[o + m]));
+                V[o + m] = v;
+            }
+        }
+        if (moved <= cfg.psor_tol) return;
+    }
+}
+
+// Backward induction for every lane; sigma2_at(i, m, t) gives sigma^2 at node i for lane m
+// and calendar time t. Returns the solution at the spot of each lane.
+template <class Sigma2>
+void run(const Grid& g, const Lanes& ln, double r, double q, double T, const Config& cfg, bool local,
+         const Sigma2& sigma2_at, std::vector<LaneValue>& out) {
+    const int n = g.size();
+    const int L = ln.L;
+    const std::size_t size = static_cast<std::size_t>(n) * L;
+    // op_* hold the spatial operator, lo/di/up the implicit matrix built from it
+    std::vector<double> op_l(size), op_d(size), op_u(size), lo(size), di(size), up(size), rhs(size);
+    std::vector<double> V(size), V1(size), V2(size);   // V1, V2: the two previous time levels, for theta
+    Factor factor;
+    for (int i = 0; i < n; ++i) {
+        const double p = payoff(ln.is_call, g.x[i]);
+        for (int m = 0; m < L; ++m) V[static_cast<std::size_t>(i) * L + m] = p;
+    }
+
+    // L V = 0.5 sigma^2 x^2 V'' + (r - q) x V' - r V, split into the three diagonals
+    const double mu = r - q;
+    auto build_operator = [&](double t) {
+        for (int i = 1; i < n - 1; ++i) {
+            const std::size_t o = static_cast<std::size_t>(i) * L;
+            const double x = g.x[i], x2 = 0.5 * x * x;
+            for (int m = 0; m < L; ++m) {
+                const double s2 = sigma2_at(i, m, t);
+                op_l[o + m] = s2 * x2 * g.d2m[i] + mu * x * g.d1m[i];
+                op_d[o + m] = s2 * x2 * g.d2c[i] + mu * x * g.d1c[i] - r;
+                op_u[o + m] = s2 * x2 * g.d2p[i] + mu * x * g.d1p[i];
+            }
+        }
+    };
+    if (!local) build_operator(0.0);
+
+    const double dt_full = T / cfg.time_steps;
+    double tau = 0.0, tau1 = 0.0, tau2 = 0.0;
+    double built_dt = 0.0;   // theta * dt the matrix was last built for (0: none)
+    const bool use_psor = ln.is_american && cfg.american == AmericanSolver::PSOR;
+
+    // each CN step of the Rannacher start is two implicit Euler half steps
+    const int ie_steps = 2 * std::min(cfg.rannacher_steps, cfg.time_steps);
+    const int total = ie_steps + (cfg.time_steps - ie_steps / 2);
+    for (int s = 0; s < total; ++s) {
+        const bool implicit = s < ie_steps;
+        const double dt = implicit ? 0.5 * dt_full : dt_full;
+        const double theta = implicit ? 1.0 : 0.5;
+        const double tau_next = tau + dt;
+        if (local) {
+            build_operator(T - 0.5 * (tau + tau_next));
+            built_dt = 0.0;
+        }
+
+        if (theta * dt != built_dt) {
+            built_dt = theta * dt;
+            for (std::size_t k = static_cast<std::size_t>(L); k < size - L; ++k) {
+                lo[k] = -built_dt * op_l[k];
+                di[k] = 1.0 - built_dt * op_d[k];
+                up[k] = -built_dt * op_u[k];
+            }
+            // the end nodes are Dirichlet: their coupling goes into rhs instead
+            for (int m = 0; m < L; ++m) {
+                lo[static_cast<std::size_t>(L) + m] = 0.0;
+                up[static_cast<std::size_t>(n - 2) * L + m] = 0.0;
+            }
+            if (!use_psor) factor_tridiagonal(n, ln, lo.data(), di.data(), up.data(), factor);
+        }
+
+        const double ex_dt = (1.0 - theta) * dt;
+        for (int i = 1; i < n - 1; ++i) {
+            const std::size_t o = static_cast<std::size_t>(i) * L;
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+            for (int m = 0; m < L; ++m) {
+                rhs[o + m] = V[o + m] + ex_dt * (op_l[o + m] * V[o - L + m] + op_d[o + m] * V[o + m] +
+                                                 op_u[o + m] * V[o + L + m]);
+            }
+        }
+        std::swap(V2, V1);
+        std::copy(V.begin(), V.end(), V1.begin());
+        const double b_lo = boundary(ln.is_call, ln.is_american, g.x[0], r, q, tau_next, false);
+        const double b_hi = boundary(ln.is_call, ln.is_american, g.x[n - 1], r, q, tau_next, true);
+        for (int m = 0; m < L; ++m) {
+            const std::size_t first = static_cast<std::size_t>(L) + m;
+            const std::size_t last = static_cast<std::size_t>(n - 2) * L + m;
+            V[m] = b_lo;
+            V[static_cast<std::size_t>(n - 1) * L + m] = b_hi;
+            rhs[first] += theta * dt * op_l[first] * b_lo;
+            rhs[last] += theta * dt * op_u[last] * b_hi;
+        }
+        if (use_psor) {
+            solve_psor(g, ln, lo.data(), di.data(), up.data(), rhs.data(), V.data(), cfg);
+        } else {
+            substitute(g, ln, lo.data(), up.data(), factor, rhs.data(), V.data(), ln.is_american);
+        }
+        tau2 = tau1;
+        tau1 = tau;
+        tau = tau_next;
+    }
+
+    // dv/dtau at expiry from the last three levels (second order on the uneven spacing)
+    const double h1 = tau - tau1, h2 = tau1 - tau2;
+    const double c0 = (2.0 * h1 + h2) / (h1 * (h1 + h2));
+    const double c1 = -(h1 + h2) / (h1 * h2);
+    const double c2 = h1 / (h2 * (h1 + h2));
+    out.resize(L);
+    for (int m = 0; m < L; ++m) {
+        double f0[3], f1[3], f2[3];
+        read_off(g, V.data(), L, m, ln.x_spot[m], f0);
+        read_off(g, V1.data(), L, m, ln.x_spot[m], f1);
+        if (total < 2) {
+            out[m] = {f0[0], f0[1], f0[2], (f0[0] - f1[0]) / h1};
+            continue;
+        }
+        read_off(g, V2.data(), L, m, ln.x_spot[m], f2);
+        out[m] = {f0[0], f0[1], f0[2], c0 * f0[0] + c1 * f1[0] + c2 * f2[0]};
+    }
+}
+
+void check_config(const Config& cfg) {
+    if (cfg.space_steps < 3 || cfg.time_steps < 1 || cfg.rannacher_steps < 0 || !(cfg.concentration > 0.0) ||
+        !(cfg.width > 0.0)) {
+        throw std::invalid_argument("fd: invalid grid configuration");
+    }
+}
+
+Grid grid_for(const std::vector<double>& x_spot, double vol_max, double T, const Config& cfg) {
+    const auto [lo, hi] = std::minmax_element(x_spot.begin(), x_spot.end());
+    const double span = cfg.width * vol_max * std::sqrt(T);
+    return make_grid(std::min(*lo, 1.0) * std::exp(-span), std::max(*hi, 1.0) * std::exp(span), cfg.space_steps,
+                     cfg.concentration);
+}
+
+// Grid for constant-vol lanes, wide enough for the largest vol
+Grid constant_grid(double S, double T, std::span<const double> K, std::span<const double> vols, const Config& cfg) {
+    std::vector<double> x_spot;
+    for (double k : K) x_spot.push_back(S / k);
+    return grid_for(x_spot, *std::max_element(vols.begin(), vols.end()), T, cfg);
+}
+
+// Constant vol per lane on grid g: value, delta, gamma and theta for each lane
+void solve_constant(const Grid& g, double S, double r, double q, double T, std::span<const double> K,
+                    std::span<const double> vols, bool is_call, bool is_american, const Config& cfg,
+                    std::vector<LaneValue>& out) {
+    Lanes ln;
+    ln.L = static_cast<int>(K.size());
+    ln.is_call = is_call;
+    ln.is_american = is_american;
+    for (std::size_t m = 0; m < K.size(); ++m) {
+        ln.x_spot.push_back(S / K[m]);
+        ln.vol.push_back(vols[m]);
+    }
+    run(g, ln, r, q, T, cfg, false, [&](int, int m, double) { return ln.vol[m] * ln.vol[m]; }, out);
+}
+
+void check_inputs(double S, double K, double T) {
+    if (!(S > 0.0) || !(K > 0.0) || !(T > 0.0)) {
+        throw std::invalid_argument("fd: S, K and T must be positive");
+    }
+}
+
+PriceGreeks to_greeks(const LaneValue& v, double K) {
+    return {K * v.v, v.dv, v.d2v / K, 0.0, -K * v.dv_dtau, 0.0};
+}
+
+} // namespace
+
+double price(double S, double K, double r, double q, double T, double vol, bool is_call, bool is_american,
+             const Config& cfg) {
+    check_config(cfg);
+    check_inputs(S, K, T);
+    if (!(vol > 0.0)) throw std::invalid_argument("fd: vol must be positive");
+    std::vector<LaneValue> out;
+    solve_constant(constant_grid(S, T, {&K, 1}, {&vol, 1}, cfg), S, r, q, T, {&K, 1}, {&vol, 1}, is_call, is_american,
+                   cfg, out);
+    return K * out[0].v;
+}
+
+PriceGreeks price_greeks(double S, double K, double r, double q, double T, double vol, bool is_call,
+                         bool is_american, const Config& cfg) {
+    PriceGreeks g{};
+    price_greeks_batch(S, r, q, T, {&K, 1}, {&vol, 1}, {reinterpret_cast<const std::uint8_t*>(&is_call), 1},
+                       is_american, {&g, 1}, cfg);
+    return g;
+}
+
+PriceGreeks price_greeks(double S, double K, double r, double q, double T, const LocalVol& local_vol,
+                         bool is_call, bool is_american, const Config& cfg) {
+    check_config(cfg);
+    check_inputs(S, K, T);
+    Lanes ln;
+    ln.L = 1;
+    ln.is_call = is_call;
+    ln.is_american = is_american;
+    ln.x_spot = {S / K};
+    // grid width from the surface around the spot and the strike, today and at expiry. The
+    // bumped solves reuse it, so the grid's discretisation error cancels in the differences.
+    double vol_max = 0.0;
+    for (double s : {S, K}) {
+        for (double t : {0.0, T}) vol_max = std::max(vol_max, local_vol(s, t));
+    }
+    if (!(vol_max > 0.0)) throw std::invalid_argument("fd: local vol must be positive");
+    const Grid g = grid_for(ln.x_spot, vol_max, T, cfg);
+    auto solve = [&](double shift, double rr) {
+        std::vector<LaneValue> out;
+        run(g, ln, rr, q, T, cfg, true,
+            [&](int i, int, double t) {
+                const double s = std::max(local_vol(g.x[i] * K, t) + shift, 0.0);
+                return s * s;
+            },
+            out);
+        return out[0];
+    };
+    PriceGreeks res = to_greeks(solve(0.0, r), K);
+    const double hv = 1e-3, hr = 1e-4;
+    res.vega = K * (solve(hv, r).v - solve(-hv, r).v) / (2.0 * hv);
+    res.rho = K * (solve(0.0, r + hr).v - solve(0.0, r - hr).v) / (2.0 * hr);
+    return res;
+}
+
+void price_greeks_batch(double S, double r, double q, double T, std::span<const double> K,
+                        std::span<const double> vols, std::span<const std::uint8_t> is_call, bool is_american,
+                        std::span<PriceGreeks> out, const Config& cfg) {
+    check_config(cfg);
+    const std::size_t n = K.size();
+    if (vols.size() != n || is_call.size() != n || out.size() != n) {
+        throw std::invalid_argument("fd::price_greeks_batch: K, vols, is_call and out lengths differ");
+    }
+    for (std::size_t m = 0; m < n; ++m) {
+        check_inputs(S, K[m], T);
+        if (!(vols[m] > 0.0)) throw std::invalid_argument("fd: vol must be positive");
+    }
+
+    // calls and puts eliminate in opposite directions, so each side is its own batch
+    for (const bool call : {false, true}) {
+        std::vector<std::size_t> idx;
+        std::vector<double> k, v;
+        for (std::size_t m = 0; m < n; ++m) {
+            if ((is_call[m] != 0) != call) continue;
+            idx.push_back(m);
+            k.push_back(K[m]);
+            v.push_back(vols[m]);
+        }
+        if (idx.empty()) continue;
+
+        // one grid from the unbumped vols for every solve: rebuilding it per bump would move
+        // the nodes and put the change in discretisation error into vega and rho
+        const Grid g = constant_grid(S, T, k, v, cfg);
+        std::vector<LaneValue> base, up, dn;
+        solve_constant(g, S, r, q, T, k, v, call, is_american, cfg, base);
+        for (std::size_t j = 0; j < idx.size(); ++j) out[idx[j]] = to_greeks(base[j], k[j]);
+
+        std::vector<double> v_up(v), v_dn(v), h(v.size());
+        for (std::size_t j = 0; j < v.size(); ++j) {
+            h[j] = 1e-3 * std::max(1.0, v[j]);
+            v_up[j] = v[j] + h[j];
+            v_dn[j] = std::max(0.5 * v[j], v[j] - h[j]);
+        }
+        solve_constant(g, S, r, q, T, k, v_up, call, is_american, cfg, up);
+        solve_constant(g, S, r, q, T, k, v_dn, call, is_american, cfg, dn);
+        for (std::size_t j = 0; j < idx.size(); ++j) out[idx[j]].vega = k[j] * (up[j].v - dn[j].v) / (v_up[j] - v_dn[j]);
+
+        const double hr = 1e-4;
+        solve_constant(g, S, r + hr, q, T, k, v, call, is_american, cfg, up);
+        solve_constant(g, S, r - hr, q, T, k, v, call, is_american, cfg, dn);
+        for (std::size_t j = 0; j < idx.size(); ++j) out[idx[j]].rho = k[j] * (up[j].v - dn[j].v) / (2.0 * hr);
+    }
+}
+
+} // namespace vol::fd
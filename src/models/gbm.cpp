@@ -1,5 +1,6 @@
 #include "libvol/mc/gbm.hpp"
 #include "libvol/models/black_scholes.hpp"
+#include "libvol/math/special.hpp"
 #include "libvol/util/stats.hpp"
 #include <random>
 #include <cmath>
@@ -9,8 +10,36 @@
 
 namespace vol::mc {
 
+namespace {
+
+    // Running sums for one estimator y against the control x, both shifted (x by its known mean,
+    // y by its first sample) so the double accumulators do not cancel
+    struct CVSums {
+        double shift = 0.0;
+        double sy = 0.0, syy = 0.0, sxy = 0.0;
+
+        void add(double y, double x, bool first) {
+            if (first) shift = y;
+            y -= shift;
+            sy += y; syy += y*y; sxy += x*y;
+        }
+
+        // Mean and standard error of y - beta (x - E[x]), beta the sample regression of y on x
+        MCGreek estimate(double sx, double sxx, double n) const {
+            if (n < 2.0) return {shift + sy / n, 0.0};
+            const double vx = (sxx - sx*sx/n) / (n - 1.0);
+            const double vy = (syy - sy*sy/n) / (n - 1.0);
+            const double cov = (sxy - sx*sy/n) / (n - 1.0);
+            const double beta = vx > 0.0 ? cov / vx : 0.0;
+            const double v = std::max(0.0, vy - 2.0*beta*cov + beta*beta*vx);
+            return {shift + (sy - beta*sx) / n, std::sqrt(v / n)};
+        }
+    };
+
+} // namespace
+
     MCResult european_vanilla_gbm(double S,double K,double r,double q,double T,double vol,bool is_call, 
-                                std::uint64_t n_paths, std::uint64_t seed){
+                                std::uint64_t n_paths, std::uint64_t seed, NormalGen gen, vol::math::Accuracy acc){
         
         if (n_paths % 2ULL) ++n_paths;
 
@@ -27,8 +56,32 @@ namespace vol::mc {
         std::vector<double> Y; Y.reserve(pairs);
         std::vector<double> X; X.reserve(pairs);
 
+        // Greeks: pathwise delta and vega, likelihood-ratio gamma, streamed against the same
+        // control. d S_T / d vol = S_T (sqrt(T) z - vol T); d log p / d S = z / (S vol sqrt(T))
+        CVSums delta, vega, gamma;
+        double sx = 0.0, sxx = 0.0;
+        const double sgn = is_call ? 1.0 : -1.0;
+        const double vsT = vol*sqT;
+        const double inv_vsT = vsT > 0.0 ? 1.0 / vsT : 0.0;
+        const double gamma_scale = vsT > 0.0 ? 0.5*disc / (S*S) : 0.0;
+
+        // InverseCDF: uniforms in (0,1) from the top 53 bits, converted a block at a time
+        constexpr std::size_t BLOCK = 1024;
+        std::vector<double> zbuf(gen == NormalGen::InverseCDF ? BLOCK : 0);
+        std::size_t zpos = zbuf.size();
+
         for(std::uint64_t i = 0; i<pairs; ++i){
-            const double z = Z(rng);
+            double z;
+            if (gen == NormalGen::InverseCDF) {
+                if (zpos == zbuf.size()) {
+                    for (double& u : zbuf) u = (static_cast<double>(rng() >> 11) + 0.5) * 0x1.0p-53;
+                    vol::math::norm_inv_cdf(zbuf, zbuf, acc);
+                    zpos = 0;
+                }
+                z = zbuf[zpos++];
+            } else {
+                z = Z(rng);
+            }
             const double ez = vol*sqT*z;
 
             const double STp = S*std::exp(mu*T + ez);
@@ -42,6 +95,15 @@ namespace vol::mc {
 
             Y.push_back(disc * payoff_avg); // target variable
             X.push_back(disc * ST_avg);    
+
+            // sgn S_T on in-the-money legs: the payoff's derivative along S_T, times S_T
+            const double gp = (is_call ? STp > K : STp < K) ? sgn*STp : 0.0;
+            const double gm = (is_call ? STm > K : STm < K) ? sgn*STm : 0.0;
+            const double x = disc*ST_avg - EX;
+            sx += x; sxx += x*x;
+            delta.add(0.5*disc/S * (gp + gm), x, i == 0);
+            vega.add(0.5*disc * (gp*(sqT*z - vol*T) - gm*(sqT*z + vol*T)), x, i == 0);
+            gamma.add(gamma_scale * (gp*(z*inv_vsT - 1.0) - gm*(z*inv_vsT + 1.0)), x, i == 0);
         }
 
         auto [mY, vY] = vol::stats::mean_var(Y);
@@ -62,7 +124,13 @@ namespace vol::mc {
 
         auto [m, v] = vol::stats::mean_var(Ytilde);
         const double se = std::sqrt(v / Ytilde.size());
-        return {m, se, n_paths };
+
+        MCResult res{m, se, n_paths};
+        const double n = static_cast<double>(pairs);
+        res.delta = delta.estimate(sx, sxx, n);
+        res.vega  = vega.estimate(sx, sxx, n);
+        res.gamma = gamma.estimate(sx, sxx, n);
+        return res;
     }
 
 }
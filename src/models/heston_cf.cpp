@@ -0,0 +1,258 @@
+#include "libvol/models/heston_cf.hpp"
+
+#include "heston_kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+namespace vol::heston {
+
+namespace {
+
+// Complex helpers on split (re, im) doubles. Results go through out-parameters rather than
+// a small struct so GCC keeps everything in registers inside the simd loop (struct
+// temporaries defeat its vectoriser), and there is no inf/NaN recovery like std::complex
+// has: the CF arguments are finite by construction.
+inline void cmul(double ar, double ai, double br, double bi, double& re, double& im) {
+    re = ar * br - ai * bi;
+    im = ar * bi + ai * br;
+}
+
+inline void cdiv(double ar, double ai, double br, double bi, double& re, double& im) {
+    const double inv = 1.0 / (br * br + bi * bi);
+    re = (ar * br + ai * bi) * inv;
+    im = (ai * br - ar * bi) * inv;
+}
+
+// Principal branch, matching std::sqrt(std::complex)
+inline void csqrt(double zr, double zi, double& re, double& im) {
+    const double r = std::sqrt(zr * zr + zi * zi);
+    re = std::sqrt(0.5 * (r + zr));
+    im = std::copysign(std::sqrt(0.5 * std::max(r - zr, 0.0)), zi);
+}
+
+// sin(x) is taken as cos(pi/2 - x): GCC fuses a sin/cos pair into sincos, which has no
+// vector variant and would keep the whole loop scalar.
+inline void cexp(double zr, double zi, double& re, double& im) {
+    constexpr double HALF_PI = 1.57079632679489661923;
+    const double m = std::exp(zr);
+    re = m * std::cos(zi);
+    im = m * std::cos(HALF_PI - zi);
+}
+
+// Principal branch, matching std::log(std::complex)
+inline void clog(double zr, double zi, double& re, double& im) {
+    re = 0.5 * std::log(zr * zr + zi * zi);
+    im = std::atan2(zi, zr);
+}
+
+// Tangents of A and D (as in characteristic_batch) in one direction, from d beta, d sigma^2
+// and d T, with the node's values and shared reciprocals passed in:
+//   dd = (beta dbeta + dsigma^2 w / 2) / d,  dg = 2 (d dbeta - beta dd) / (beta + d)^2
+//   de = -e (dd T + d dT),  h = dg e + g de
+//   dA = (dbeta - dd) T + (beta - d) dT + 2 h / (1 - g e) - 2 dg / (1 - g)
+//   dF = (F h - de) / (1 - g e),  dD = ((dbeta - dd) F + (beta - d) dF - D dsigma^2) / sigma^2
+// Called four times per node; GCC would not inline it on its own, and a call stops the loop
+// vectorising.
+[[gnu::always_inline]] inline void ab_tangent(double dbr, double dbi, double ds2, double dT,
+                                              double br, double bi, double dr, double di, double wr, double wi,
+                                              double gr, double gi, double er, double ei, double Fr, double Fi,
+                                              double Dr, double Di, double idr, double idi, double i2r, double i2i,
+                                              double ihr, double ihi, double igr, double igi, double T,
+                                              double inv_sigma2, double& dAr, double& dAi, double& dDr,
+                                              double& dDi) {
+    double tr, ti, ddr, ddi;
+    cmul(br, bi, dbr, dbi, tr, ti);
+    cmul(tr + 0.5 * ds2 * wr, ti + 0.5 * ds2 * wi, idr, idi, ddr, ddi);
+    double xr, xi, yr, yi, dgr, dgi;
+    cmul(dr, di, dbr, dbi, xr, xi);
+    cmul(br, bi, ddr, ddi, yr, yi);
+    cmul(xr - yr, xi - yi, i2r, i2i, dgr, dgi);
+    double der, dei;
+    cmul(er, ei, ddr * T + dr * dT, ddi * T + di * dT, der, dei);
+    der = -der;
+    dei = -dei;
+    double h1r, h1i, h2r, h2i;
+    cmul(dgr, dgi, er, ei, h1r, h1i);
+    cmul(gr, gi, der, dei, h2r, h2i);
+    const double hr = h1r + h2r, hi = h1i + h2i;
+    double ar, ai, cr, ci;
+    cmul(hr, hi, ihr, ihi, ar, ai);
+    cmul(dgr, dgi, igr, igi, cr, ci);
+    const double bmdr = br - dr, bmdi = bi - di;
+    const double dbmdr = dbr - ddr, dbmdi = dbi - ddi;
+    dAr = dbmdr * T + bmdr * dT + 2.0 * (ar - cr);
+    dAi = dbmdi * T + bmdi * dT + 2.0 * (ai - ci);
+    double fhr, fhi, dFr, dFi;
+    cmul(Fr, Fi, hr, hi, fhr, fhi);
+    cmul(fhr - der, fhi - dei, ihr, ihi, dFr, dFi);
+    double p1r, p1i, p2r, p2i;
+    cmul(dbmdr, dbmdi, Fr, Fi, p1r, p1i);
+    cmul(bmdr, bmdi, dFr, dFi, p2r, p2i);
+    dDr = (p1r + p2r - Dr * ds2) * inv_sigma2;
+    dDi = (p1i + p2i - Di * ds2) * inv_sigma2;
+}
+
+} // namespace
+
+void characteristic_batch(const double* __restrict u_re,
+                          const double* __restrict u_im,
+                          std::size_t n,
+                          double logS,
+                          double drift,
+                          double T,
+                          const Params& params,
+                          double* __restrict phi_re,
+                          double* __restrict phi_im) {
+    if (params.sigma <= 0.0) {
+        throw std::invalid_argument("Heston vol-of-vol sigma must be positive");
+    }
+    const double sigma = params.sigma;
+    const double sigma2 = sigma * sigma;
+    const double inv_sigma2 = 1.0 / sigma2;
+    const double kappa = params.kappa;
+    const double rho_sigma = params.rho * sigma;
+    const double kt_s2 = params.kappa * params.theta * inv_sigma2;
+    const double v0 = params.v0;
+    const double x0 = logS + drift;
+    const std::ptrdiff_t count = static_cast<std::ptrdiff_t>(n);
+
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+    for (std::ptrdiff_t j = 0; j < count; ++j) {
+        const double ur = u_re[j];
+        const double ui = u_im[j];
+        // iu = i u, beta = kappa - rho sigma iu
+        const double iur = -ui;
+        const double iui = ur;
+        const double br = kappa - rho_sigma * iur;
+        const double bi = -rho_sigma * iui;
+        // d = sqrt(beta^2 + sigma^2 (iu + u^2))
+        double b2r, b2i, u2r, u2i, dr, di;
+        cmul(br, bi, br, bi, b2r, b2i);
+        cmul(ur, ui, ur, ui, u2r, u2i);
+        csqrt(b2r + sigma2 * (iur + u2r), b2i + sigma2 * (iui + u2i), dr, di);
+        // g = (beta - d) / (beta + d), e = exp(-d T)
+        const double bmdr = br - dr;
+        const double bmdi = bi - di;
+        double gr, gi, er, ei, ger, gei;
+        cdiv(bmdr, bmdi, br + dr, bi + di, gr, gi);
+        cexp(-dr * T, -di * T, er, ei);
+        cmul(gr, gi, er, ei, ger, gei);
+        // C = kappa theta / sigma^2 ((beta - d) T - 2 log((1 - g e) / (1 - g)))
+        double qr, qi, lr, li;
+        cdiv(1.0 - ger, -gei, 1.0 - gr, -gi, qr, qi);
+        clog(qr, qi, lr, li);
+        const double Cr = kt_s2 * (bmdr * T - 2.0 * lr);
+        const double Ci = kt_s2 * (bmdi * T - 2.0 * li);
+        // D = (beta - d) / sigma^2 (1 - e) / (1 - g e)
+        double fr, fi, Dr, Di;
+        cdiv(1.0 - er, -ei, 1.0 - ger, -gei, fr, fi);
+        cmul(bmdr, bmdi, fr, fi, Dr, Di);
+        Dr *= inv_sigma2;
+        Di *= inv_sigma2;
+        cexp(Cr + Dr * v0 + iur * x0, Ci + Di * v0 + iui * x0, phi_re[j], phi_im[j]);
+    }
+}
+
+void detail::characteristic_jet_batch(const double* __restrict u_re,
+                                      const double* __restrict u_im,
+                                      std::size_t n,
+                                      const std::array<double, CF_INPUTS>& x,
+                                      double* __restrict dlog_re,
+                                      double* __restrict dlog_im) {
+    const double kappa = x[0], theta = x[1], sigma = x[2], rho = x[3], v0 = x[4], T = x[5];
+    if (sigma <= 0.0) {
+        throw std::invalid_argument("Heston vol-of-vol sigma must be positive");
+    }
+    const double sigma2 = sigma * sigma;
+    const double inv_sigma2 = 1.0 / sigma2;
+    const double c = kappa * theta * inv_sigma2;
+    const std::ptrdiff_t count = static_cast<std::ptrdiff_t>(n);
+    double* __restrict dk_re = dlog_re;
+    double* __restrict dk_im = dlog_im;
+    double* __restrict dth_re = dlog_re + n;
+    double* __restrict dth_im = dlog_im + n;
+    double* __restrict ds_re = dlog_re + 2 * n;
+    double* __restrict ds_im = dlog_im + 2 * n;
+    double* __restrict dr_re = dlog_re + 3 * n;
+    double* __restrict dr_im = dlog_im + 3 * n;
+    double* __restrict dv_re = dlog_re + 4 * n;
+    double* __restrict dv_im = dlog_im + 4 * n;
+    double* __restrict dt_re = dlog_re + 5 * n;
+    double* __restrict dt_im = dlog_im + 5 * n;
+    double* __restrict df_re = dlog_re + 6 * n;
+    double* __restrict df_im = dlog_im + 6 * n;
+
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+    for (std::ptrdiff_t j = 0; j < count; ++j) {
+        const double ur = u_re[j];
+        const double ui = u_im[j];
+        // values as in characteristic_batch
+        const double iur = -ui;
+        const double iui = ur;
+        const double br = kappa - rho * sigma * iur;
+        const double bi = -rho * sigma * iui;
+        double b2r, b2i, u2r, u2i, dr, di;
+        cmul(br, bi, br, bi, b2r, b2i);
+        cmul(ur, ui, ur, ui, u2r, u2i);
+        const double wr = iur + u2r, wi = iui + u2i;   // w = iu + u^2
+        csqrt(b2r + sigma2 * wr, b2i + sigma2 * wi, dr, di);
+        const double bmdr = br - dr, bmdi = bi - di;
+        const double bpdr = br + dr, bpdi = bi + di;
+        double gr, gi, er, ei, ger, gei;
+        cdiv(bmdr, bmdi, bpdr, bpdi, gr, gi);
+        cexp(-dr * T, -di * T, er, ei);
+        cmul(gr, gi, er, ei, ger, gei);
+        double qr, qi, lr, li;
+        cdiv(1.0 - ger, -gei, 1.0 - gr, -gi, qr, qi);
+        clog(qr, qi, lr, li);
+        const double Ar = bmdr * T - 2.0 * lr;
+        const double Ai = bmdi * T - 2.0 * li;
+        double Fr, Fi, Dr, Di;
+        cdiv(1.0 - er, -ei, 1.0 - ger, -gei, Fr, Fi);
+        cmul(bmdr, bmdi, Fr, Fi, Dr, Di);
+        Dr *= inv_sigma2;
+        Di *= inv_sigma2;
+
+        // shared factors: 1 / d, 2 / (beta + d)^2, 1 / (1 - g e), 1 / (1 - g)
+        double idr, idi, s2r, s2i, i2r, i2i, ihr, ihi, igr, igi;
+        cdiv(1.0, 0.0, dr, di, idr, idi);
+        cmul(bpdr, bpdi, bpdr, bpdi, s2r, s2i);
+        cdiv(2.0, 0.0, s2r, s2i, i2r, i2i);
+        cdiv(1.0, 0.0, 1.0 - ger, -gei, ihr, ihi);
+        cdiv(1.0, 0.0, 1.0 - gr, -gi, igr, igi);
+
+        // d beta: kappa 1, sigma -rho iu, rho -sigma iu, T 0; d sigma^2 only along sigma
+        double Akr, Aki, Dkr, Dki, Asr, Asi, Dsr, Dsi, Arr, Ari, Drr, Dri, Atr, Ati, Dtr, Dti;
+#define VOL_AB_NODE br, bi, dr, di, wr, wi, gr, gi, er, ei, Fr, Fi, Dr, Di, idr, idi, i2r, i2i, ihr, ihi, igr, igi, T, inv_sigma2
+        ab_tangent(1.0, 0.0, 0.0, 0.0, VOL_AB_NODE, Akr, Aki, Dkr, Dki);
+        ab_tangent(-rho * iur, -rho * iui, 2.0 * sigma, 0.0, VOL_AB_NODE, Asr, Asi, Dsr, Dsi);
+        ab_tangent(-sigma * iur, -sigma * iui, 0.0, 0.0, VOL_AB_NODE, Arr, Ari, Drr, Dri);
+        ab_tangent(0.0, 0.0, 0.0, 1.0, VOL_AB_NODE, Atr, Ati, Dtr, Dti);
+#undef VOL_AB_NODE
+
+        // log phi = c A + v0 D + iu log F with c = kappa theta / sigma^2
+        dk_re[j] = theta * inv_sigma2 * Ar + c * Akr + v0 * Dkr;
+        dk_im[j] = theta * inv_sigma2 * Ai + c * Aki + v0 * Dki;
+        dth_re[j] = kappa * inv_sigma2 * Ar;
+        dth_im[j] = kappa * inv_sigma2 * Ai;
+        ds_re[j] = -2.0 * c / sigma * Ar + c * Asr + v0 * Dsr;
+        ds_im[j] = -2.0 * c / sigma * Ai + c * Asi + v0 * Dsi;
+        dr_re[j] = c * Arr + v0 * Drr;
+        dr_im[j] = c * Ari + v0 * Dri;
+        dv_re[j] = Dr;
+        dv_im[j] = Di;
+        dt_re[j] = c * Atr + v0 * Dtr;
+        dt_im[j] = c * Ati + v0 * Dti;
+        df_re[j] = iur;
+        df_im[j] = iui;
+    }
+}
+
+} // namespace vol::heston
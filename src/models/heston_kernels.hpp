@@ -0,0 +1,24 @@
+#pragma once
+
+// Characteristic-function pieces shared by the adjoint pricer (heston_aad.cpp) and the
+// maturity-grouped calibration objective (heston_objective.cpp).
+
+#include "libvol/models/heston.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace vol::heston::detail {
+
+inline constexpr std::size_t CF_INPUTS = 7;   // kappa, theta, sigma, rho, v0, T, log forward
+
+// d log phi / d input (CF_INPUTS order, x holds their values) for n nodes at once, on the
+// characteristic_batch kernel (heston_cf.cpp): hand-differentiated tangents of the
+// little-trap form on split doubles, so the node loop vectorises. Input-major:
+// dlog_re[i * n + j] is node j, input i. phi itself is left to characteristic_batch, so
+// prices and objectives that take their derivatives from here take their values from the
+// same kernel as the plain pricer.
+void characteristic_jet_batch(const double* u_re, const double* u_im, std::size_t n,
+                              const std::array<double, CF_INPUTS>& x, double* dlog_re, double* dlog_im);
+
+} // namespace vol::heston::detail
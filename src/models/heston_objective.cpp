@@ -0,0 +1,276 @@
+#include "libvol/models/heston_objective.hpp"
+
+#include "libvol/core/constants.hpp"
+#include "libvol/math/quadrature.hpp"
+#include "libvol/models/heston_cf.hpp"
+#include "libvol/util/parallel.hpp"
+
+#include "heston_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace vol::heston {
+
+namespace {
+
+using Cplx = std::complex<double>;
+constexpr std::size_t N_PARAMS = 5;
+constexpr std::size_t CHUNK = 16;   // strikes per phase-two task
+
+// One maturity: its quotes and, after phase one, the K-independent integrand at each node,
+// base1 = w e^u phi(u - i) / phi(-i) and base2 = w e^u phi(u), with their d log / d params
+struct Group {
+    double S, r, q, T;
+    std::vector<std::size_t> quotes;
+    std::vector<Cplx> base1, base2;
+    std::vector<Cplx> dlog1, dlog2;   // node-major, N_PARAMS per node
+};
+
+struct Task {
+    std::size_t group, begin, end;   // range of the group's quote list
+};
+
+// Per-thread SoA scratch for one group's nodes: [0, n) at u - i, [n, 2n) at u, 2n at -i
+struct NodeWorkspace {
+    std::vector<double> u_re, u_im, phi_re, phi_im, dlog_re, dlog_im;
+
+    void resize(std::size_t m) {
+        u_re.resize(m);
+        u_im.resize(m);
+        phi_re.resize(m);
+        phi_im.resize(m);
+        dlog_re.resize(detail::CF_INPUTS * m);
+        dlog_im.resize(detail::CF_INPUTS * m);
+    }
+};
+
+NodeWorkspace& node_workspace() {
+    thread_local NodeWorkspace ws;
+    return ws;
+}
+
+} // namespace
+
+struct ParallelObjective::Impl {
+    std::vector<OptionSpec> opts;
+    std::vector<double> mids, weights;
+    int n_gl;
+    std::vector<Group> groups;
+    std::vector<Task> tasks;
+    // per-quote outputs, summed in quote order after each evaluation
+    std::vector<double> price, f;
+    std::vector<double> g;   // N_PARAMS per quote
+    std::mutex eval;
+    util::ThreadPool pool;
+
+    Impl(std::vector<OptionSpec> o, std::vector<double> m, std::vector<double> w, int threads, int gl)
+        : opts(std::move(o)), mids(std::move(m)), weights(std::move(w)), n_gl(gl), pool(threads) {}
+
+    void cf_values(Group& grp, const Params& p);
+    void cf_jets(Group& grp, const Params& p);
+    void price_quotes(const Task& t, bool with_grad);
+    void evaluate(const Params& p, bool with_grad);
+};
+
+void ParallelObjective::Impl::cf_values(Group& grp, const Params& p) {
+    const auto& rule = vol::math::gauss_laguerre_rule(n_gl);
+    const std::size_t n = rule.nodes.size();
+    const std::size_t m = 2 * n + 1;
+    auto& ws = node_workspace();
+    ws.resize(m);
+    for (std::size_t j = 0; j < n; ++j) {
+        ws.u_re[j] = ws.u_re[n + j] = rule.nodes[j];
+        ws.u_im[j] = -1.0;
+        ws.u_im[n + j] = 0.0;
+    }
+    ws.u_re[2 * n] = 0.0;
+    ws.u_im[2 * n] = -1.0;
+    characteristic_batch(ws.u_re.data(), ws.u_im.data(), m, std::log(grp.S), (grp.r - grp.q) * grp.T, grp.T, p,
+                         ws.phi_re.data(), ws.phi_im.data());
+    const Cplx inv_minus_i = 1.0 / Cplx(ws.phi_re[2 * n], ws.phi_im[2 * n]);
+    grp.base1.resize(n);
+    grp.base2.resize(n);
+    for (std::size_t j = 0; j < n; ++j) {
+        const double scale = rule.weights[j] * std::exp(rule.nodes[j]);
+        grp.base1[j] = scale * Cplx(ws.phi_re[j], ws.phi_im[j]) * inv_minus_i;
+        grp.base2[j] = scale * Cplx(ws.phi_re[n + j], ws.phi_im[n + j]);
+    }
+}
+
+// The bases come from cf_values, so f is the same with and without the gradient; only the
+// d log phi are added, from the batch jet kernel over the same nodes
+void ParallelObjective::Impl::cf_jets(Group& grp, const Params& p) {
+    cf_values(grp, p);
+    const std::size_t n = grp.base1.size();
+    const std::size_t m = 2 * n + 1;
+    const std::array<double, detail::CF_INPUTS> x{p.kappa, p.theta, p.sigma, p.rho, p.v0, grp.T,
+                                                  std::log(grp.S) + (grp.r - grp.q) * grp.T};
+    auto& ws = node_workspace();
+    detail::characteristic_jet_batch(ws.u_re.data(), ws.u_im.data(), m, x, ws.dlog_re.data(), ws.dlog_im.data());
+    auto dlog = [&](std::size_t i, std::size_t node) { return Cplx(ws.dlog_re[i * m + node], ws.dlog_im[i * m + node]); };
+    grp.dlog1.resize(n * N_PARAMS);
+    grp.dlog2.resize(n * N_PARAMS);
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < N_PARAMS; ++i) {
+            grp.dlog1[j * N_PARAMS + i] = dlog(i, j) - dlog(i, 2 * n);
+            grp.dlog2[j * N_PARAMS + i] = dlog(i, n + j);
+        }
+    }
+}
+
+void ParallelObjective::Impl::price_quotes(const Task& t, bool with_grad) {
+    const Group& grp = groups[t.group];
+    const auto& rule = vol::math::gauss_laguerre_rule(n_gl);
+    const std::size_t n = rule.nodes.size();
+    const double fwd_leg = grp.S * std::exp(-grp.q * grp.T);
+    const double disc_r = std::exp(-grp.r * grp.T);
+    for (std::size_t k = t.begin; k < t.end; ++k) {
+        const std::size_t idx = grp.quotes[k];
+        const OptionSpec& o = opts[idx];
+        const double w = weights.empty() ? 1.0 : weights[idx];
+        double* gi = g.data() + idx * N_PARAMS;
+        if (grp.T <= 0.0) {
+            price[idx] = o.is_call ? std::max(0.0, o.S - o.K) : std::max(0.0, o.K - o.S);
+            const double res = price[idx] - mids[idx];
+            f[idx] = 0.5 * w * res * res;
+            std::fill(gi, gi + N_PARAMS, 0.0);
+            continue;
+        }
+        const double log_strike = std::log(o.K);
+        double p1 = 0.0, p2 = 0.0;
+        double dp1[N_PARAMS] = {}, dp2[N_PARAMS] = {};
+        for (std::size_t j = 0; j < n; ++j) {
+            const double u = rule.nodes[j];
+            const double angle = -u * log_strike;
+            // e^{-i u logK} / (i u)
+            const Cplx phase_over_iu(std::sin(angle) / u, -std::cos(angle) / u);
+            const Cplx t1 = phase_over_iu * grp.base1[j];
+            const Cplx t2 = phase_over_iu * grp.base2[j];
+            p1 += t1.real();
+            p2 += t2.real();
+            if (with_grad) {
+                for (std::size_t i = 0; i < N_PARAMS; ++i) {
+                    dp1[i] += (t1 * grp.dlog1[j * N_PARAMS + i]).real();
+                    dp2[i] += (t2 * grp.dlog2[j * N_PARAMS + i]).real();
+                }
+            }
+        }
+        // clamped probabilities do not move
+        const double P1 = 0.5 + p1 / vol::PI, P2 = 0.5 + p2 / vol::PI;
+        const double s1 = P1 < 0.0 || P1 > 1.0 ? 0.0 : fwd_leg / vol::PI;
+        const double s2 = P2 < 0.0 || P2 > 1.0 ? 0.0 : o.K * disc_r / vol::PI;
+        const double call = fwd_leg * std::clamp(P1, 0.0, 1.0) - o.K * disc_r * std::clamp(P2, 0.0, 1.0);
+        price[idx] = o.is_call ? call : call - (fwd_leg - o.K * disc_r);
+        const double res = price[idx] - mids[idx];
+        f[idx] = 0.5 * w * res * res;
+        if (with_grad) {
+            for (std::size_t i = 0; i < N_PARAMS; ++i) gi[i] = w * res * (s1 * dp1[i] - s2 * dp2[i]);
+        }
+    }
+}
+
+void ParallelObjective::Impl::evaluate(const Params& p, bool with_grad) {
+    if (p.sigma <= 0.0) {
+        throw std::invalid_argument("Heston vol-of-vol sigma must be positive");
+    }
+    pool.run(groups.size(), [&](std::size_t i) {
+        if (groups[i].T <= 0.0) return;
+        if (with_grad) {
+            cf_jets(groups[i], p);
+        } else {
+            cf_values(groups[i], p);
+        }
+    });
+    pool.run(tasks.size(), [&](std::size_t i) { price_quotes(tasks[i], with_grad); });
+}
+
+ParallelObjective::ParallelObjective(std::vector<OptionSpec> opts,
+                                     std::vector<double> mids,
+                                     std::vector<double> weights,
+                                     int n_threads,
+                                     int n_gl) {
+    if (mids.size() != opts.size() || (!weights.empty() && weights.size() != opts.size())) {
+        throw std::invalid_argument("ParallelObjective: opts, mids and weights lengths differ");
+    }
+    if (n_gl <= 0) {
+        throw std::invalid_argument("Gauss-Laguerre order must be positive");
+    }
+    for (const OptionSpec& o : opts) {
+        if (o.S <= 0.0 || o.K <= 0.0) {
+            throw std::invalid_argument("Spot and strike must be positive");
+        }
+    }
+    impl_ = std::make_unique<Impl>(std::move(opts), std::move(mids), std::move(weights), n_threads, n_gl);
+    Impl& im = *impl_;
+
+    std::map<std::tuple<double, double, double, double>, std::size_t> index;
+    for (std::size_t i = 0; i < im.opts.size(); ++i) {
+        const OptionSpec& o = im.opts[i];
+        const auto key = std::make_tuple(o.S, o.r, o.q, o.T);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            it = index.emplace(key, im.groups.size()).first;
+            im.groups.push_back({o.S, o.r, o.q, o.T, {}, {}, {}, {}, {}});
+        }
+        im.groups[it->second].quotes.push_back(i);
+    }
+    for (std::size_t gi = 0; gi < im.groups.size(); ++gi) {
+        const std::size_t n = im.groups[gi].quotes.size();
+        for (std::size_t b = 0; b < n; b += CHUNK) im.tasks.push_back({gi, b, std::min(n, b + CHUNK)});
+    }
+    im.price.resize(im.opts.size());
+    im.f.resize(im.opts.size());
+    im.g.resize(im.opts.size() * N_PARAMS);
+}
+
+ParallelObjective::~ParallelObjective() = default;
+ParallelObjective::ParallelObjective(ParallelObjective&&) noexcept = default;
+ParallelObjective& ParallelObjective::operator=(ParallelObjective&&) noexcept = default;
+
+double ParallelObjective::operator()(const Params& p, Params* grad) {
+    Impl& im = *impl_;
+    std::lock_guard<std::mutex> lock(im.eval);
+    im.evaluate(p, grad != nullptr);
+    double f = 0.0;
+    double g[N_PARAMS] = {};
+    for (std::size_t i = 0; i < im.opts.size(); ++i) {
+        f += im.f[i];
+        if (grad) {
+            for (std::size_t k = 0; k < N_PARAMS; ++k) g[k] += im.g[i * N_PARAMS + k];
+        }
+    }
+    if (grad) *grad = Params{g[0], g[1], g[2], g[3], g[4]};
+    return f;
+}
+
+void ParallelObjective::prices(const Params& p, std::span<double> out) {
+    Impl& im = *impl_;
+    if (out.size() != im.opts.size()) {
+        throw std::invalid_argument("ParallelObjective::prices: out length must match the quotes");
+    }
+    std::lock_guard<std::mutex> lock(im.eval);
+    im.evaluate(p, false);
+    std::copy(im.price.begin(), im.price.end(), out.begin());
+}
+
+std::size_t ParallelObjective::quotes() const {
+    return impl_->opts.size();
+}
+
+std::size_t ParallelObjective::maturities() const {
+    return impl_->groups.size();
+}
+
+int ParallelObjective::threads() const {
+    return impl_->pool.size();
+}
+
+} // namespace vol::heston
@@ -0,0 +1,551 @@
+#include "libvol/models/heston_proxy.hpp"
+#include "libvol/util/parallel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <numbers>
+#include <stdexcept>
+
+namespace vol::heston {
+
+namespace {
+
+constexpr char MAGIC[8] = {'V', 'O', 'L', 'C', 'H', 'E', 'B', '\0'};
+constexpr int MAX_NODES = 256;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t n_axes;
+    std::uint32_t is_call;
+    std::int32_t n_gl;
+    std::int32_t check_points;
+    std::int32_t checked;
+    std::uint64_t seed;
+    double moneyness, T, params[5], r, q;
+    double max_abs_error, rms_error, tail, build_seconds;
+    std::uint64_t n_coeffs;
+    std::uint64_t checksum;
+};
+
+struct FileAxis {
+    std::uint32_t dim;
+    std::int32_t nodes;
+    double lo, hi;
+};
+
+// FNV-1a over the coefficient bytes; proxies are loaded once, so bytewise is fine
+std::uint64_t checksum(const std::vector<double>& v) {
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    const auto* p = reinterpret_cast<const unsigned char*>(v.data());
+    for (std::size_t i = 0; i < v.size() * sizeof(double); ++i) h = (h ^ p[i]) * 0x100000001b3ull;
+    return h;
+}
+
+bool is_param(ProxyDim d) {
+    return d != ProxyDim::Moneyness && d != ProxyDim::T;
+}
+
+double& slot(ProxyDim d, double& moneyness, double& T, Params& p) {
+    switch (d) {
+    case ProxyDim::Moneyness: return moneyness;
+    case ProxyDim::T: return T;
+    case ProxyDim::Kappa: return p.kappa;
+    case ProxyDim::Theta: return p.theta;
+    case ProxyDim::Sigma: return p.sigma;
+    case ProxyDim::Rho: return p.rho;
+    default: return p.v0;
+    }
+}
+
+double value_of(ProxyDim d, double moneyness, double T, Params p) {
+    return slot(d, moneyness, T, p);
+}
+
+// Index into Params order (kappa, theta, sigma, rho, v0) of a parameter axis
+int param_index(ProxyDim d) {
+    return static_cast<int>(d) - static_cast<int>(ProxyDim::Kappa);
+}
+
+double to_unit(const ProxyAxis& a, double v) {
+    return std::clamp((2.0 * v - a.lo - a.hi) / (a.hi - a.lo), -1.0, 1.0);
+}
+
+double from_unit(const ProxyAxis& a, double x) {
+    return 0.5 * (a.lo + a.hi) + 0.5 * (a.hi - a.lo) * x;
+}
+
+// T_0..T_{n-1} at x in [-1, 1]
+void chebyshev_basis(double x, int n, double* b) {
+    b[0] = 1.0;
+    if (n > 1) b[1] = x;
+    for (int k = 2; k < n; ++k) b[k] = 2.0 * x * b[k - 1] - b[k - 2];
+}
+
+// d/dv of T_k(x(v)) = k U_{k-1}(x) * dx/dv
+void chebyshev_basis_derivative(double x, int n, double dx_dv, double* b) {
+    double u_prev = 0.0, u = 1.0;   // U_{-1}, U_0
+    b[0] = 0.0;
+    for (int k = 1; k < n; ++k) {
+        b[k] = k * u * dx_dv;
+        const double next = 2.0 * x * u - u_prev;
+        u_prev = u;
+        u = next;
+    }
+}
+
+void axpy(double s, const double* x, double* y, std::size_t n) {
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+    for (std::size_t i = 0; i < n; ++i) y[i] += s * x[i];
+}
+
+// Sums out axis `a` of a row-major tensor with shape dims against basis b
+std::vector<double> contract_axis(const std::vector<double>& c, const std::vector<int>& dims, std::size_t a,
+                                  const double* b) {
+    std::size_t outer = 1, inner = 1;
+    for (std::size_t i = 0; i < a; ++i) outer *= static_cast<std::size_t>(dims[i]);
+    for (std::size_t i = a + 1; i < dims.size(); ++i) inner *= static_cast<std::size_t>(dims[i]);
+    const auto n = static_cast<std::size_t>(dims[a]);
+    std::vector<double> out(outer * inner, 0.0);
+    for (std::size_t o = 0; o < outer; ++o) {
+        double* dst = out.data() + o * inner;
+        for (std::size_t j = 0; j < n; ++j) axpy(b[j], c.data() + (o * n + j) * inner, dst, inner);
+    }
+    return out;
+}
+
+// body(i) over [0, n), 16 indices per task
+template <class Body>
+void for_each_index(std::size_t n, int n_threads, const Body& body) {
+    util::parallel_for(n, n_threads, 16, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) body(i);
+    });
+}
+
+std::uint64_t splitmix64(std::uint64_t& s) {
+    std::uint64_t z = (s += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+double uniform(std::uint64_t& s) {
+    return static_cast<double>(splitmix64(s) >> 11) * 0x1.0p-53;
+}
+
+void validate(const ProxyConfig& cfg) {
+    if (cfg.axes.empty()) {
+        throw std::invalid_argument("ChebyshevProxy: at least one axis is required");
+    }
+    bool seen[N_PROXY_DIMS] = {};
+    for (const ProxyAxis& a : cfg.axes) {
+        const auto d = static_cast<std::size_t>(a.dim);
+        if (d >= N_PROXY_DIMS || seen[d]) {
+            throw std::invalid_argument("ChebyshevProxy: unknown or repeated axis");
+        }
+        seen[d] = true;
+        if (!(a.lo < a.hi) || a.nodes < 2 || a.nodes > MAX_NODES) {
+            throw std::invalid_argument("ChebyshevProxy: axis needs lo < hi and 2..256 nodes");
+        }
+    }
+    // lowest corner of every input over the box (pinned values where there is no axis)
+    double m = cfg.moneyness, T = cfg.T;
+    Params lo = cfg.params, hi = cfg.params;
+    double m_hi = m, T_hi = T;
+    for (const ProxyAxis& a : cfg.axes) {
+        slot(a.dim, m, T, lo) = a.lo;
+        slot(a.dim, m_hi, T_hi, hi) = a.hi;
+    }
+    if (!(m > 0.0) || !(T > 0.0) || !(lo.sigma > 0.0) || !(lo.rho >= -1.0) || !(hi.rho <= 1.0) ||
+        !(lo.kappa >= 0.0) || !(lo.theta >= 0.0) || !(lo.v0 >= 0.0)) {
+        throw std::invalid_argument("ChebyshevProxy: box leaves the Heston domain");
+    }
+    if (cfg.n_gl <= 0) {
+        throw std::invalid_argument("ChebyshevProxy: n_gl must be positive");
+    }
+}
+
+} // namespace
+
+ChebyshevProxy ChebyshevProxy::build(const ProxyConfig& cfg) {
+    validate(cfg);
+    const auto t0 = std::chrono::steady_clock::now();
+    ChebyshevProxy proxy;
+    proxy.cfg_ = cfg;
+    const std::size_t D = cfg.axes.size();
+    std::vector<int> dims(D);
+    std::size_t n_total = 1;
+    for (std::size_t a = 0; a < D; ++a) {
+        dims[a] = cfg.axes[a].nodes;
+        n_total *= static_cast<std::size_t>(dims[a]);
+    }
+
+    // prices at the tensor of first-kind Chebyshev points x_j = cos(pi (j + 1/2) / n)
+    std::vector<double> values(n_total);
+    for_each_index(n_total, cfg.n_threads, [&](std::size_t idx) {
+        double m = cfg.moneyness, T = cfg.T;
+        Params p = cfg.params;
+        std::size_t rest = idx;
+        for (std::size_t a = D; a-- > 0;) {
+            const auto n = static_cast<std::size_t>(dims[a]);
+            const double j = static_cast<double>(rest % n);
+            rest /= n;
+            slot(cfg.axes[a].dim, m, T, p) =
+                from_unit(cfg.axes[a], std::cos(std::numbers::pi * (j + 0.5) / static_cast<double>(n)));
+        }
+        values[idx] = price_cf(1.0, m, cfg.r, cfg.q, T, p, cfg.is_call, cfg.n_gl);
+    });
+
+    // values -> coefficients, one axis at a time: c_k = (2 - [k = 0]) / n sum_j f_j T_k(x_j)
+    for (std::size_t a = 0; a < D; ++a) {
+        const int n = dims[a];
+        std::vector<double> M(static_cast<std::size_t>(n) * n);
+        for (int k = 0; k < n; ++k) {
+            for (int j = 0; j < n; ++j) {
+                M[static_cast<std::size_t>(k) * n + j] =
+                    (k == 0 ? 1.0 : 2.0) / n * std::cos(std::numbers::pi * k * (j + 0.5) / n);
+            }
+        }
+        std::size_t outer = 1, inner = 1;
+        for (std::size_t i = 0; i < a; ++i) outer *= static_cast<std::size_t>(dims[i]);
+        for (std::size_t i = a + 1; i < D; ++i) inner *= static_cast<std::size_t>(dims[i]);
+        std::vector<double> next(n_total, 0.0);
+        for (std::size_t o = 0; o < outer; ++o) {
+            for (int k = 0; k < n; ++k) {
+                double* dst = next.data() + (o * n + k) * inner;
+                for (int j = 0; j < n; ++j) {
+                    axpy(M[static_cast<std::size_t>(k) * n + j], values.data() + (o * n + j) * inner, dst, inner);
+                }
+            }
+        }
+        values.swap(next);
+    }
+    proxy.coeffs_ = std::move(values);
+    proxy.tail_ = proxy.tail();
+    if (cfg.check_points > 0) proxy.check_ = proxy.check(cfg.check_points, cfg.seed);
+    proxy.build_seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return proxy;
+}
+
+double ChebyshevProxy::tail() const {
+    // |c| summed over the top-degree slice of each axis
+    const std::size_t D = cfg_.axes.size();
+    double sum = 0.0;
+    for (std::size_t idx = 0; idx < coeffs_.size(); ++idx) {
+        std::size_t rest = idx;
+        bool top = false;
+        for (std::size_t a = D; a-- > 0;) {
+            const auto n = static_cast<std::size_t>(cfg_.axes[a].nodes);
+            top = top || rest % n == n - 1;
+            rest /= n;
+        }
+        if (top) sum += std::abs(coeffs_[idx]);
+    }
+    return sum;
+}
+
+double ChebyshevProxy::evaluate(const double* x) const {
+    thread_local std::vector<double> buf;
+    double basis[MAX_NODES];
+    const std::size_t D = cfg_.axes.size();
+    std::size_t size = coeffs_.size();
+    buf.resize(size / static_cast<std::size_t>(cfg_.axes[0].nodes));
+
+    // outermost axis first, so every step is an axpy over long contiguous rows: the rows of
+    // axis a are summed into row 0 in place (later rows are only read, row 0 is scaled first)
+    const double* src = coeffs_.data();
+    double* dst = buf.data();
+    for (std::size_t a = 0; a < D; ++a) {
+        const int n = cfg_.axes[a].nodes;
+        const std::size_t inner = size / static_cast<std::size_t>(n);
+        chebyshev_basis(to_unit(cfg_.axes[a], x[a]), n, basis);
+        const double b0 = basis[0];
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (std::size_t i = 0; i < inner; ++i) dst[i] = b0 * src[i];
+        for (int j = 1; j < n; ++j) axpy(basis[j], src + static_cast<std::size_t>(j) * inner, dst, inner);
+        src = dst;
+        size = inner;
+    }
+    return dst[0];
+}
+
+bool ChebyshevProxy::contains(double moneyness, double T, const Params& params) const {
+    bool on_axis[N_PROXY_DIMS] = {};
+    for (const ProxyAxis& a : cfg_.axes) {
+        const double v = value_of(a.dim, moneyness, T, params);
+        if (!(v >= a.lo && v <= a.hi)) return false;
+        on_axis[static_cast<std::size_t>(a.dim)] = true;
+    }
+    for (std::size_t d = 0; d < N_PROXY_DIMS; ++d) {
+        if (on_axis[d]) continue;
+        const auto dim = static_cast<ProxyDim>(d);
+        const double v = value_of(dim, moneyness, T, params);
+        const double pinned = value_of(dim, cfg_.moneyness, cfg_.T, cfg_.params);
+        if (!(std::abs(v - pinned) <= 1e-12 * std::max(1.0, std::abs(pinned)))) return false;
+    }
+    return true;
+}
+
+double ChebyshevProxy::price(double S, double K, double T, const Params& params) const {
+    const double m = K / S;
+    if (!contains(m, T, params)) {
+        return price_cf(S, K, cfg_.r, cfg_.q, T, params, cfg_.is_call, cfg_.n_gl);
+    }
+    double x[N_PROXY_DIMS];
+    for (std::size_t a = 0; a < cfg_.axes.size(); ++a) x[a] = value_of(cfg_.axes[a].dim, m, T, params);
+    return S * evaluate(x);
+}
+
+ChebyshevProxy ChebyshevProxy::contract(const Params& params, ChebyshevProxy* grad) const {
+    ChebyshevProxy out;
+    out.cfg_ = cfg_;
+    out.cfg_.axes.clear();
+    out.cfg_.check_points = 0;
+    for (const ProxyAxis& a : cfg_.axes) {
+        if (!is_param(a.dim)) out.cfg_.axes.push_back(a);
+    }
+    if (out.cfg_.axes.empty()) {
+        // scalar series: a single-point axis at the pinned moneyness gives evaluate() one sweep
+        out.cfg_.axes.push_back({ProxyDim::Moneyness, cfg_.moneyness, cfg_.moneyness, 1});
+    }
+    // an exact restriction of the series, so the parent's error statistics carry over
+    out.check_ = check_;
+    out.tail_ = tail_;
+    out.build_seconds_ = build_seconds_;
+
+    // In axis order, so the first (largest) contraction runs over the longest rows. The
+    // gradient is carried forward: a parameter's derivative tensor branches off the value
+    // with the differentiated basis, then follows the value through the later axes.
+    std::vector<int> dims;
+    for (const ProxyAxis& a : cfg_.axes) dims.push_back(a.nodes);
+    std::vector<double> value;
+    const std::vector<double>* src = &coeffs_;   // no copy of the full tensor
+    std::vector<double> deriv[5];
+    bool on_axis[5] = {};
+    double basis[MAX_NODES], dbasis[MAX_NODES];
+    std::size_t removed = 0;
+    for (std::size_t a = 0; a < cfg_.axes.size(); ++a) {
+        const ProxyAxis& ax = cfg_.axes[a];
+        if (!is_param(ax.dim)) continue;
+        const std::size_t pos = a - removed++;
+        const double v = std::clamp(value_of(ax.dim, 0.0, 0.0, params), ax.lo, ax.hi);
+        const double x = to_unit(ax, v);
+        chebyshev_basis(x, ax.nodes, basis);
+        if (grad) {
+            for (int i = 0; i < 5; ++i) {
+                if (on_axis[i]) deriv[i] = contract_axis(deriv[i], dims, pos, basis);
+            }
+            const int k = param_index(ax.dim);
+            chebyshev_basis_derivative(x, ax.nodes, 2.0 / (ax.hi - ax.lo), dbasis);
+            deriv[k] = contract_axis(*src, dims, pos, dbasis);
+            on_axis[k] = true;
+        }
+        value = contract_axis(*src, dims, pos, basis);
+        src = &value;
+        dims.erase(dims.begin() + static_cast<std::ptrdiff_t>(pos));
+        double unused_m = 0.0, unused_T = 0.0;
+        slot(ax.dim, unused_m, unused_T, out.cfg_.params) = v;
+    }
+    if (src != &value) value = coeffs_;   // no parameter axes
+    if (grad) {
+        for (int i = 0; i < 5; ++i) {
+            grad[i] = out;
+            grad[i].coeffs_ = on_axis[i] ? std::move(deriv[i]) : std::vector<double>(value.size(), 0.0);
+        }
+    }
+    out.coeffs_ = std::move(value);
+    return out;
+}
+
+ChebyshevProxy ChebyshevProxy::bind(const Params& params) const {
+    return contract(params, nullptr);
+}
+
+ChebyshevProxy ChebyshevProxy::bind(const Params& params, ChebyshevProxy (&grad)[5]) const {
+    return contract(params, grad);
+}
+
+ProxyCheck ChebyshevProxy::check(int n, std::uint64_t seed) const {
+    if (n <= 0) return {0.0, 0.0, 0};
+    std::vector<double> err(static_cast<std::size_t>(n));
+    std::vector<double> points(static_cast<std::size_t>(n) * cfg_.axes.size());
+    std::uint64_t s = seed;
+    for (double& x : points) x = uniform(s);
+    for_each_index(err.size(), cfg_.n_threads, [&](std::size_t i) {
+        double m = cfg_.moneyness, T = cfg_.T;
+        Params p = cfg_.params;
+        double x[N_PROXY_DIMS];
+        for (std::size_t a = 0; a < cfg_.axes.size(); ++a) {
+            const ProxyAxis& ax = cfg_.axes[a];
+            x[a] = ax.lo + (ax.hi - ax.lo) * points[i * cfg_.axes.size() + a];
+            slot(ax.dim, m, T, p) = x[a];
+        }
+        err[i] = evaluate(x) - price_cf(1.0, m, cfg_.r, cfg_.q, T, p, cfg_.is_call, cfg_.n_gl);
+    });
+    ProxyCheck out{0.0, 0.0, n};
+    for (double e : err) {
+        out.max_abs_error = std::max(out.max_abs_error, std::abs(e));
+        out.rms_error += e * e;
+    }
+    out.rms_error = std::sqrt(out.rms_error / n);
+    return out;
+}
+
+void ChebyshevProxy::save(const std::string& path) const {
+    FileHeader h{};
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version = PROXY_FILE_VERSION;
+    h.n_axes = static_cast<std::uint32_t>(cfg_.axes.size());
+    h.is_call = cfg_.is_call ? 1u : 0u;
+    h.n_gl = cfg_.n_gl;
+    h.check_points = cfg_.check_points;
+    h.checked = check_.points;
+    h.seed = cfg_.seed;
+    h.moneyness = cfg_.moneyness;
+    h.T = cfg_.T;
+    const Params& p = cfg_.params;
+    const double params[5] = {p.kappa, p.theta, p.sigma, p.rho, p.v0};
+    std::memcpy(h.params, params, sizeof(params));
+    h.r = cfg_.r;
+    h.q = cfg_.q;
+    h.max_abs_error = check_.max_abs_error;
+    h.rms_error = check_.rms_error;
+    h.tail = tail_;
+    h.build_seconds = build_seconds_;
+    h.n_coeffs = coeffs_.size();
+    h.checksum = checksum(coeffs_);
+
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("ChebyshevProxy: cannot open " + tmp);
+        }
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        for (const ProxyAxis& a : cfg_.axes) {
+            const FileAxis fa{static_cast<std::uint32_t>(a.dim), a.nodes, a.lo, a.hi};
+            out.write(reinterpret_cast<const char*>(&fa), sizeof(fa));
+        }
+        out.write(reinterpret_cast<const char*>(coeffs_.data()),
+                  static_cast<std::streamsize>(coeffs_.size() * sizeof(double)));
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("ChebyshevProxy: write failed for " + tmp);
+        }
+    }
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        throw std::runtime_error("ChebyshevProxy: cannot replace " + path);
+    }
+}
+
+ChebyshevProxy ChebyshevProxy::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("ChebyshevProxy: cannot open " + path);
+    }
+    FileHeader h{};
+    in.read(reinterpret_cast<char*>(&h), sizeof(h));
+    if (!in || std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("ChebyshevProxy: not a proxy file: " + path);
+    }
+    if (h.version != PROXY_FILE_VERSION) {
+        throw std::runtime_error("ChebyshevProxy: unsupported format version " + std::to_string(h.version) +
+                                 " in " + path);
+    }
+    if (h.n_axes == 0 || h.n_axes > N_PROXY_DIMS) {
+        throw std::runtime_error("ChebyshevProxy: inconsistent file " + path);
+    }
+    ChebyshevProxy proxy;
+    ProxyConfig& cfg = proxy.cfg_;
+    std::size_t n_total = 1;
+    for (std::uint32_t a = 0; a < h.n_axes; ++a) {
+        FileAxis fa{};
+        in.read(reinterpret_cast<char*>(&fa), sizeof(fa));
+        if (!in || fa.dim >= N_PROXY_DIMS || fa.nodes < 1 || fa.nodes > MAX_NODES) {
+            throw std::runtime_error("ChebyshevProxy: truncated or inconsistent file " + path);
+        }
+        cfg.axes.push_back({static_cast<ProxyDim>(fa.dim), fa.lo, fa.hi, fa.nodes});
+        n_total *= static_cast<std::size_t>(fa.nodes);
+    }
+    if (n_total != h.n_coeffs) {
+        throw std::runtime_error("ChebyshevProxy: truncated or inconsistent file " + path);
+    }
+    proxy.coeffs_.resize(n_total);
+    in.read(reinterpret_cast<char*>(proxy.coeffs_.data()), static_cast<std::streamsize>(n_total * sizeof(double)));
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) {
+        throw std::runtime_error("ChebyshevProxy: truncated or inconsistent file " + path);
+    }
+    if (checksum(proxy.coeffs_) != h.checksum) {
+        throw std::runtime_error("ChebyshevProxy: checksum mismatch in " + path);
+    }
+    cfg.moneyness = h.moneyness;
+    cfg.T = h.T;
+    cfg.params = {h.params[0], h.params[1], h.params[2], h.params[3], h.params[4]};
+    cfg.r = h.r;
+    cfg.q = h.q;
+    cfg.is_call = h.is_call != 0;
+    cfg.n_gl = h.n_gl;
+    cfg.check_points = h.check_points;
+    cfg.seed = h.seed;
+    proxy.check_ = {h.max_abs_error, h.rms_error, h.checked};
+    proxy.tail_ = h.tail;
+    proxy.build_seconds_ = h.build_seconds;
+    return proxy;
+}
+
+double calibration_objective(const ChebyshevProxy& proxy,
+                             const std::vector<OptionSpec>& opts,
+                             const std::vector<double>& mids,
+                             const std::vector<double>& weights,
+                             const Params& p,
+                             Params* grad) {
+    if (mids.size() != opts.size() || (!weights.empty() && weights.size() != opts.size())) {
+        throw std::invalid_argument("heston::calibration_objective: mids/weights length must match opts");
+    }
+    const ProxyConfig& cfg = proxy.config();
+    // project p onto the parameter box: axis parameters clamped, pinned ones taken as pinned
+    Params pp = cfg.params;
+    bool moved[5] = {};
+    for (const ProxyAxis& ax : cfg.axes) {
+        if (!is_param(ax.dim)) continue;
+        const double v = value_of(ax.dim, 0.0, 0.0, p);
+        double m = 0.0, T = 0.0;
+        slot(ax.dim, m, T, pp) = std::clamp(v, ax.lo, ax.hi);
+        moved[param_index(ax.dim)] = v < ax.lo || v > ax.hi;
+    }
+    for (std::size_t i = 0; i < opts.size(); ++i) {
+        const OptionSpec& o = opts[i];
+        if (o.r != cfg.r || o.q != cfg.q || o.is_call != cfg.is_call || !proxy.contains(o.K / o.S, o.T, pp)) {
+            throw std::invalid_argument("heston::calibration_objective: quote outside the proxy's K/S, T, r, q or type");
+        }
+    }
+
+    ChebyshevProxy dp[5];
+    const ChebyshevProxy bound = grad ? proxy.bind(pp, dp) : proxy.bind(pp);
+    double f = 0.0;
+    double g[5] = {};
+    for (std::size_t i = 0; i < opts.size(); ++i) {
+        const OptionSpec& o = opts[i];
+        const double w = weights.empty() ? 1.0 : weights[i];
+        const double e = bound.price(o.S, o.K, o.T, pp) - mids[i];
+        f += 0.5 * w * e * e;
+        if (grad) {
+            for (int k = 0; k < 5; ++k) {
+                if (!moved[k]) g[k] += w * e * dp[k].price(o.S, o.K, o.T, pp);
+            }
+        }
+    }
+    if (grad) *grad = {g[0], g[1], g[2], g[3], g[4]};
+    return f;
+}
+
+} // namespace vol::heston
@@ -1,22 +1,23 @@
 #include "libvol/models/black_scholes.hpp"
 #include "libvol/math/root_finders.hpp"
 #include "libvol/core/constants.hpp"
+#include "libvol/util/telemetry.hpp"
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 
 namespace vol::bs {
 
-    [[nodiscard]] IVResult implied_vol(double S, double K, double r, double q,double T, double target, bool is_call,double init, double tol){
-        using namespace vol::root;
+    namespace {
 
-        // basic input validation
-        if (!(std::isfinite(S) && std::isfinite(K) && std::isfinite(r) && std::isfinite(q) && std::isfinite(T) && std::isfinite(target))) {
-            return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
-        }
-        if (S <= 0.0 || K <= 0.0 || T <= 0.0 || target < 0.0) {
-            return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
-        }
+    // Bracketed Newton + Brent fallback shared by the scalar and ExpiryContext entry points.
+    // S_dq = S e^{-qT}, K_dr = K e^{-rT}; price_at / greeks_at evaluate the model at a vol.
+    template <class PriceAt, class GreeksAt>
+    IVResult solve_iv(double S_dq, double K_dr, double F, double K, double T, double target, bool is_call,
+                      double init, double tol, const PriceAt& price_at, const GreeksAt& greeks_at){
+        using namespace vol::root;
+        VOL_TELEMETRY_COUNT(IvSolves);
 
         // useful constants
         constexpr double MIN_SIGMA = 1e-9;     
@@ -24,29 +25,28 @@ namespace vol::bs {
         constexpr int MAX_NEWTON_ITERS = 20;
         constexpr int MAX_BRENT_ITERS = 100;
 
-        const double df_r = std::exp(-r * T);
-        const double df_q = std::exp(-q * T);
-        const double F = S * std::exp((r - q) * T);
-
         const double intrinsic = (is_call
-            ? std::max(0.0, S * df_q - K * df_r)
-            : std::max(0.0, K * df_r - S * df_q));
+            ? std::max(0.0, S_dq - K_dr)
+            : std::max(0.0, K_dr - S_dq));
 
-        const double max_price = is_call ? S * df_q : K * df_r;
+        const double max_price = is_call ? S_dq : K_dr;
 
         const double rel_eps = 1e-10;
 
         //bounds for impossible values
         if (target < intrinsic * (1.0 - rel_eps)) {
+            VOL_TELEMETRY_COUNT(IvNoSolution);
             return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
         }
         if (target <= intrinsic * (1.0 + 1e-4)) {
             return {0.0, 0, 0, true};
         }
         if (target > max_price * (1.0 + rel_eps)) {
+            VOL_TELEMETRY_COUNT(IvNoSolution);
             return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
         }
         if (target >= max_price * (1.0 - 1e-12)) {
+            VOL_TELEMETRY_COUNT(IvNoSolution);
             return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
         }
 
@@ -57,11 +57,11 @@ namespace vol::bs {
         const double price_tol = std::max(1e-12, 1e-8 * std::max(1.0, target));
 
         auto f_price = [&](double sigma) -> double {
-            return price(S, K, r, q, T, sigma, is_call) - target;
+            return price_at(sigma) - target;
         };
 
         auto f_price_vega = [&](double sigma, double& f, double& vega) {
-            auto g = price_greeks(S, K, r, q, T, sigma, is_call);
+            auto g = greeks_at(sigma);
             f = g.price - target;
             vega = g.vega;// per 1.0 vol (not %)
         };
@@ -73,7 +73,7 @@ namespace vol::bs {
         if (init_ok) {
             sigma = init;
         } else {
-            const double c_norm = target / (S * df_q);
+            const double c_norm = target / (S_dq);
             const double guess = std::sqrt(std::max(1e-12, (2.0 * vol::PI / T))) * std::max(1e-12, c_norm);
             const double xm = std::abs(std::log((F + 1e-300) / (K + 1e-300)));
             const double lm_scale = std::sqrt(std::max(1e-12, 2.0 * xm / T));
@@ -95,14 +95,17 @@ namespace vol::bs {
             fhi = f_price(hi);
             ++expand_tries;
         }
+        if (expand_tries > 0) VOL_TELEMETRY_ADD(IvBracketExpansions, static_cast<std::uint64_t>(expand_tries));
 
         //last resort :/
         if (!(flo <= 0.0 && fhi >= 0.0)) {
+            VOL_TELEMETRY_COUNT(IvBracketLastResort);
             lo = MIN_SIGMA;
             flo = f_price(lo);
             hi  = MAX_SIGMA;
             fhi = f_price(hi);
             if (!(flo <= 0.0 && fhi >= 0.0)) {
+                VOL_TELEMETRY_COUNT(IvNoSolution);
                 return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
             }
         }
@@ -149,10 +152,54 @@ namespace vol::bs {
         if (newton_ok) {
             return {std::clamp(sigma, MIN_SIGMA, MAX_SIGMA), newton_iters, 0, true};
         }
+        VOL_TELEMETRY_COUNT(IvBrentFallbacks);
         auto f_only = [&](double x) { return f_price(x); };
         auto br = brent(f_only, lo, hi, vol_tol, MAX_BRENT_ITERS);
+        if (!br.converged) VOL_TELEMETRY_COUNT(IvBrentUnconverged);
 
         return {std::clamp(br.x, MIN_SIGMA, MAX_SIGMA), newton_iters, br.iters, br.converged};
     }
 
+    } // namespace
+
+    [[nodiscard]] IVResult implied_vol(double S, double K, double r, double q,double T, double target, bool is_call,double init, double tol){
+        // basic input validation
+        if (!(std::isfinite(S) && std::isfinite(K) && std::isfinite(r) && std::isfinite(q) && std::isfinite(T) && std::isfinite(target))) {
+            return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
+        }
+        if (S <= 0.0 || K <= 0.0 || T <= 0.0 || target < 0.0) {
+            return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
+        }
+
+        const double df_r = std::exp(-r * T);
+        const double df_q = std::exp(-q * T);
+        const double F = S * std::exp((r - q) * T);
+
+        return solve_iv(S * df_q, K * df_r, F, K, T, target, is_call, init, tol,
+            [&](double sigma) { return price(S, K, r, q, T, sigma, is_call); },
+            [&](double sigma) { return price_greeks(S, K, r, q, T, sigma, is_call); });
+    }
+
+    [[nodiscard]] IVResult implied_vol(const ExpiryContext& ex, double K, double k, double target, bool is_call, double init, double tol){
+        if (!(std::isfinite(K) && std::isfinite(k) && std::isfinite(target) && std::isfinite(ex.forward))) {
+            return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
+        }
+        if (ex.S <= 0.0 || K <= 0.0 || ex.T <= 0.0 || target < 0.0) {
+            return {std::numeric_limits<double>::quiet_NaN(), 0, 0, false};
+        }
+        return solve_iv(ex.S * ex.df_q, K * ex.df_r, ex.forward, K, ex.T, target, is_call, init, tol,
+            [&](double sigma) { return price(ex, K, k, sigma, is_call); },
+            [&](double sigma) { return price_greeks(ex, K, k, sigma, is_call); });
+    }
+
+    void implied_vol(const Chain& chain, std::span<const double> prices, std::span<IVResult> out, double init, double tol){
+        const std::size_t n = chain.size();
+        if (prices.size() != n || out.size() != n) {
+            throw std::invalid_argument("bs::implied_vol(Chain): prices/out length must match the chain");
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = implied_vol(chain.expiry, chain.K[i], chain.k[i], prices[i], chain.is_call[i] != 0, init, tol);
+        }
+    }
+
 } // namespace vol::bs
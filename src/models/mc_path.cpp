@@ -0,0 +1,199 @@
+#include "libvol/mc/path.hpp"
+#include "libvol/math/special.hpp"
+#include "libvol/models/black_scholes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+namespace vol::mc {
+
+namespace {
+
+inline double vanilla(double S, double K, bool is_call) {
+    return is_call ? std::max(0.0, S - K) : std::max(0.0, K - S);
+}
+
+} // namespace
+
+PathPayoff asian_arithmetic(double K, bool is_call, Monitoring m) {
+    if (m == Monitoring::Discrete) {
+        return [K, is_call](const PathView& p) {
+            const std::size_t n = p.S.size() - 1;
+            double sum = 0.0;
+            for (std::size_t i = 1; i <= n; ++i) sum += p.S[i];
+            return vanilla(sum / static_cast<double>(n), K, is_call);
+        };
+    }
+    return [K, is_call](const PathView& p) {
+        const std::size_t n = p.S.size() - 1;
+        double sum = 0.5 * (p.S[0] + p.S[n]);
+        for (std::size_t i = 1; i < n; ++i) sum += p.S[i];
+        return vanilla(sum / static_cast<double>(n), K, is_call);
+    };
+}
+
+PathPayoff asian_geometric(double K, bool is_call, Monitoring m) {
+    if (m == Monitoring::Discrete) {
+        return [K, is_call](const PathView& p) {
+            const std::size_t n = p.S.size() - 1;
+            double sum = 0.0;
+            for (std::size_t i = 1; i <= n; ++i) sum += std::log(p.S[i]);
+            return vanilla(std::exp(sum / static_cast<double>(n)), K, is_call);
+        };
+    }
+    return [K, is_call](const PathView& p) {
+        const std::size_t n = p.S.size() - 1;
+        double sum = 0.5 * (std::log(p.S[0]) + std::log(p.S[n]));
+        for (std::size_t i = 1; i < n; ++i) sum += std::log(p.S[i]);
+        return vanilla(std::exp(sum / static_cast<double>(n)), K, is_call);
+    };
+}
+
+double asian_geometric_gbm(double S, double K, double r, double q, double T, double vol, int steps,
+                           bool is_call, Monitoring m) {
+    if (steps < 1) throw std::invalid_argument("asian_geometric_gbm: steps must be positive");
+    // log G - log S = sum_k w_k dX_k over the independent log increments, w_k the weight of
+    // the fixings at or after step k
+    const double n = static_cast<double>(steps);
+    const double dt = T / n;
+    double sw = 0.0, sww = 0.0;
+    for (int k = 1; k <= steps; ++k) {
+        const double w = (m == Monitoring::Discrete ? n - k + 1.0 : n - k + 0.5) / n;
+        sw += w;
+        sww += w * w;
+    }
+    const double mean = (r - q - 0.5 * vol * vol) * dt * sw;
+    const double var = vol * vol * dt * sww;
+    if (!(var > 0.0)) return std::exp(-r * T) * vanilla(S * std::exp(mean), K, is_call);
+    // Black-Scholes on G: matching vol and the carry that reproduces E[G]
+    return vol::bs::price(S, K, r, r - (mean + 0.5 * var) / T, T, std::sqrt(var / T), is_call);
+}
+
+PathPayoff barrier(double K, bool is_call, double B, Barrier type, Monitoring m) {
+    const bool up = type == Barrier::UpOut || type == Barrier::UpIn;
+    const bool out = type == Barrier::UpOut || type == Barrier::DownOut;
+    if (m == Monitoring::Discrete) {
+        return [=](const PathView& p) {
+            bool hit = false;
+            for (std::size_t i = 1; i < p.S.size(); ++i) {
+                if (up ? p.S[i] >= B : p.S[i] <= B) {
+                    hit = true;
+                    break;
+                }
+            }
+            return hit == out ? 0.0 : vanilla(p.S.back(), K, is_call);
+        };
+    }
+    return [=](const PathView& p) {
+        const double pay = vanilla(p.S.back(), K, is_call);
+        if (pay == 0.0) return 0.0;
+        // survival = prod_i (1 - P(bridge from S_i to S_{i+1} touches B)); ln(B / S) keeps
+        // one sign on the live side of the barrier, so the product of neighbours is positive
+        double survive = 1.0;
+        double a = std::log(B / p.S[0]);
+        for (std::size_t i = 0; i + 1 < p.S.size() && survive > 0.0; ++i) {
+            const double b = std::log(B / p.S[i + 1]);
+            if (up ? (a <= 0.0 || b <= 0.0) : (a >= 0.0 || b >= 0.0)) {
+                survive = 0.0;
+            } else if (p.var[i] > 0.0) {
+                survive *= 1.0 - std::exp(-2.0 * a * b / p.var[i]);
+            }
+            a = b;
+        }
+        return out ? pay * survive : pay * (1.0 - survive);
+    };
+}
+
+PathPayoff lookback_floating(bool is_call) {
+    return [is_call](const PathView& p) {
+        const auto [lo, hi] = std::minmax_element(p.S.begin(), p.S.end());
+        return is_call ? p.S.back() - *lo : *hi - p.S.back();
+    };
+}
+
+PathPayoff lookback_fixed(double K, bool is_call) {
+    return [K, is_call](const PathView& p) {
+        const auto [lo, hi] = std::minmax_element(p.S.begin(), p.S.end());
+        return is_call ? std::max(0.0, *hi - K) : std::max(0.0, K - *lo);
+    };
+}
+
+Discretisation gbm_exact(double S, double r, double q, double vol) {
+    Discretisation d;
+    d.S0 = S;
+    d.r = r;
+    d.normals = 1;
+    const double mu = r - q - 0.5 * vol * vol;
+    const double var = vol * vol;
+    d.step = [mu, vol, var](double& s, double&, double dt, const double* z) {
+        s *= std::exp(mu * dt + vol * std::sqrt(dt) * z[0]);
+        return var * dt;
+    };
+    return d;
+}
+
+Discretisation heston_euler(double S, double r, double q, const heston::Params& p) {
+    Discretisation d;
+    d.S0 = S;
+    d.v0 = p.v0;
+    d.r = r;
+    d.normals = 2;
+    const double rho_c = std::sqrt(std::max(0.0, 1.0 - p.rho * p.rho));
+    d.step = [p, rho_c, mu = r - q](double& s, double& v, double dt, const double* z) {
+        const double vp = std::max(v, 0.0);
+        const double sq = std::sqrt(vp * dt);
+        const double zs = p.rho * z[0] + rho_c * z[1];
+        s *= std::exp((mu - 0.5 * vp) * dt + sq * zs);
+        v += p.kappa * (p.theta - vp) * dt + p.sigma * sq * z[0];
+        return vp * dt;
+    };
+    return d;
+}
+
+Discretisation heston_qe(double S, double r, double q, const heston::Params& p) {
+    if (!(p.kappa > 0.0) || !(p.sigma > 0.0)) {
+        throw std::invalid_argument("heston_qe: kappa and sigma must be positive");
+    }
+    Discretisation d;
+    d.S0 = S;
+    d.v0 = p.v0;
+    d.r = r;
+    d.normals = 2;
+    d.step = [p, mu = r - q](double& s, double& v, double dt, const double* z) {
+        constexpr double PSI_C = 1.5;
+        const double e = std::exp(-p.kappa * dt);
+        const double m = p.theta + (v - p.theta) * e;
+        const double s2 = v * p.sigma * p.sigma * e * (1.0 - e) / p.kappa
+                        + p.theta * p.sigma * p.sigma * (1.0 - e) * (1.0 - e) / (2.0 * p.kappa);
+        const double psi = s2 / (m * m);
+        double vn;
+        if (psi <= PSI_C) {
+            const double ip = 2.0 / psi;
+            const double b2 = ip - 1.0 + std::sqrt(ip) * std::sqrt(ip - 1.0);
+            const double b = std::sqrt(b2);
+            const double a = m / (1.0 + b2);
+            vn = a * (b + z[0]) * (b + z[0]);
+        } else {
+            const double pz = (psi - 1.0) / (psi + 1.0);
+            const double beta = (1.0 - pz) / m;
+            const double u = vol::math::norm_cdf(z[0]);
+            vn = u <= pz ? 0.0 : std::log((1.0 - pz) / (1.0 - u)) / beta;
+        }
+        // central (gamma_1 = gamma_2 = 1/2) discretisation of the integrated variance
+        const double k0 = -p.rho * p.kappa * p.theta * dt / p.sigma;
+        const double c = p.kappa * p.rho / p.sigma - 0.5;
+        const double k1 = 0.5 * dt * c - p.rho / p.sigma;
+        const double k2 = 0.5 * dt * c + p.rho / p.sigma;
+        const double k3 = 0.5 * dt * (1.0 - p.rho * p.rho);
+        const double iv = std::max(0.0, k3 * (v + vn));
+        s *= std::exp(mu * dt + k0 + k1 * v + k2 * vn + std::sqrt(iv) * z[1]);
+        const double var = 0.5 * (v + vn) * dt;
+        v = vn;
+        return var;
+    };
+    return d;
+}
+
+} // namespace vol::mc
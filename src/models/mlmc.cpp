@@ -0,0 +1,199 @@
+#include "libvol/mc/mlmc.hpp"
+#include "libvol/math/special.hpp"
+#include "libvol/mc/rng.hpp"
+#include "libvol/util/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace vol::mc {
+
+namespace {
+
+// samples per random stream; sample counts are rounded up to whole chunks
+constexpr std::uint64_t CHUNK = 256;
+
+struct Sums {
+    double y = 0.0, yy = 0.0;   // P_l - P_{l-1}
+    double f = 0.0, ff = 0.0;   // P_l
+
+    void add(const Sums& o) {
+        y += o.y; yy += o.yy;
+        f += o.f; ff += o.ff;
+    }
+};
+
+struct Level {
+    int steps;
+    bool coupled;               // has a coarse path (every level but 0)
+    std::uint64_t chunks = 0;   // run so far
+    std::uint64_t pending = 0;  // to run this round
+    Sums sums;
+
+    double n() const { return static_cast<double>(chunks * CHUNK); }
+    double mean() const { return sums.y / n(); }
+    double var() const { return std::max(0.0, (sums.yy - sums.y * sums.y / n()) / (n() - 1.0)); }
+    double var_fine() const { return std::max(0.0, (sums.ff - sums.f * sums.f / n()) / (n() - 1.0)); }
+    double cost() const { return coupled ? 1.5 * steps : static_cast<double>(steps); }
+};
+
+// Per-thread path buffers
+struct Workspace {
+    std::vector<double> z, zc, Sf, vf, Sc, vc;
+};
+
+// One chunk of level samples from the stream keyed by (seed, level, chunk)
+Sums run_chunk(const Discretisation& m, const PathPayoff& payoff, double T, const Level& lv,
+               const MLMCConfig& cfg, std::size_t level, std::uint64_t chunk, Workspace& ws) {
+    SplitMix rng = SplitMix::stream(cfg.seed, 0x6C8E9CF570932BD5ull * (level + 1) + chunk);
+    const std::size_t nf = static_cast<std::size_t>(lv.steps);
+    const std::size_t nc = nf / 2;
+    const std::size_t k = static_cast<std::size_t>(m.normals);
+    const double dt = T / static_cast<double>(nf);
+    const double disc = std::exp(-m.r * T);
+    ws.z.resize(nf * k);
+    ws.zc.resize(k);
+    ws.Sf.resize(nf + 1);
+    ws.vf.resize(nf);
+    ws.Sc.resize(nc + 1);
+    ws.vc.resize(nc);
+
+    Sums out;
+    for (std::uint64_t i = 0; i < CHUNK; ++i) {
+        rng.normals(ws.z, cfg.accuracy);
+
+        double S = m.S0, v = m.v0;
+        ws.Sf[0] = S;
+        for (std::size_t j = 0; j < nf; ++j) {
+            ws.vf[j] = m.step(S, v, dt, ws.z.data() + j * k);
+            ws.Sf[j + 1] = S;
+        }
+        const double pf = disc * payoff(PathView{ws.Sf, ws.vf, T});
+
+        double pc = 0.0;
+        if (lv.coupled) {
+            // the coarse step sees the same Brownian increment as its two fine steps
+            S = m.S0;
+            v = m.v0;
+            ws.Sc[0] = S;
+            for (std::size_t j = 0; j < nc; ++j) {
+                for (std::size_t c = 0; c < k; ++c) {
+                    ws.zc[c] = (ws.z[2 * j * k + c] + ws.z[(2 * j + 1) * k + c]) * 0.70710678118654752440;
+                }
+                ws.vc[j] = m.step(S, v, 2.0 * dt, ws.zc.data());
+                ws.Sc[j + 1] = S;
+            }
+            pc = disc * payoff(PathView{ws.Sc, ws.vc, T});
+        }
+        const double y = pf - pc;
+        out.y += y; out.yy += y * y;
+        out.f += pf; out.ff += pf * pf;
+    }
+    return out;
+}
+
+// Runs every pending chunk of every level on the pool and folds the chunk sums into the
+// levels in chunk order
+void run_pending(const Discretisation& m, const PathPayoff& payoff, double T, std::vector<Level>& levels,
+                 const MLMCConfig& cfg, vol::util::ThreadPool& pool, std::vector<Workspace>& ws) {
+    struct Task { std::size_t level; std::uint64_t chunk; };
+    std::vector<Task> tasks;
+    for (std::size_t l = 0; l < levels.size(); ++l) {
+        for (std::uint64_t c = 0; c < levels[l].pending; ++c) tasks.push_back({l, levels[l].chunks + c});
+    }
+    if (tasks.empty()) return;
+    std::vector<Sums> result(tasks.size());
+    pool.run_workers(tasks.size(), [&](std::size_t t, int w) {
+        result[t] = run_chunk(m, payoff, T, levels[tasks[t].level], cfg, tasks[t].level, tasks[t].chunk,
+                              ws[static_cast<std::size_t>(w)]);
+    });
+
+    for (std::size_t t = 0; t < tasks.size(); ++t) levels[tasks[t].level].sums.add(result[t]);
+    for (Level& lv : levels) {
+        lv.chunks += lv.pending;
+        lv.pending = 0;
+    }
+}
+
+// Weak order from a least-squares fit of log2 |Y_l| on l over the coupled levels
+double fit_alpha(const std::vector<Level>& levels) {
+    double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0, n = 0.0;
+    for (std::size_t l = 1; l < levels.size(); ++l) {
+        const double y = std::log2(std::max(std::abs(levels[l].mean()), 1e-300));
+        const double x = static_cast<double>(l);
+        sx += x; sy += y; sxx += x * x; sxy += x * y; n += 1.0;
+    }
+    if (n < 2.0) return 1.0;
+    const double slope = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    return std::max(0.5, -slope);
+}
+
+void add_level(std::vector<Level>& levels, const MLMCConfig& cfg) {
+    Level lv{cfg.base_steps << levels.size(), !levels.empty(), 0, (cfg.pilot + CHUNK - 1) / CHUNK, {}};
+    levels.push_back(lv);
+}
+
+} // namespace
+
+MLMCResult mlmc(const Discretisation& model, const PathPayoff& payoff, double T, const MLMCConfig& cfg) {
+    if (!(cfg.eps > 0.0) || cfg.base_steps < 1 || cfg.min_levels < 2 || cfg.max_levels < cfg.min_levels ||
+        cfg.max_levels > 30 || cfg.pilot < 2 || !(T > 0.0)) {
+        throw std::invalid_argument("mlmc: invalid configuration");
+    }
+    if (!payoff || !model.step || model.normals < 1) {
+        throw std::invalid_argument("mlmc: payoff and discretisation step are required");
+    }
+
+    std::vector<Level> levels;
+    for (int l = 0; l < cfg.min_levels; ++l) add_level(levels, cfg);
+    vol::util::ThreadPool pool(cfg.n_threads);   // kept across the allocation rounds
+    std::vector<Workspace> ws(static_cast<std::size_t>(pool.size()));
+
+    const double eps2 = cfg.eps * cfg.eps;
+    MLMCResult res{};
+    double alpha = cfg.alpha;
+    for (;;) {
+        run_pending(model, payoff, T, levels, cfg, pool, ws);
+
+        // N_l = 2 / eps^2 sqrt(V_l / C_l) sum_k sqrt(V_k C_k): sampling variance eps^2 / 2
+        double root_sum = 0.0;
+        for (const Level& lv : levels) root_sum += std::sqrt(lv.var() * lv.cost());
+        bool more = false;
+        for (Level& lv : levels) {
+            const double target = std::ceil(2.0 / eps2 * std::sqrt(lv.var() / lv.cost()) * root_sum);
+            const double extra = target - lv.n();
+            if (extra > 0.01 * lv.n()) {
+                lv.pending = static_cast<std::uint64_t>(std::ceil(extra / static_cast<double>(CHUNK)));
+                more = true;
+            }
+        }
+        if (more) continue;
+
+        if (cfg.alpha <= 0.0) alpha = fit_alpha(levels);
+        const std::size_t L = levels.size() - 1;
+        const double scale = std::pow(2.0, alpha);
+        // level 0's mean is the whole coarse price, not a correction: with L = 1 only Y_1 counts
+        const double prev = L >= 2 ? std::abs(levels[L - 1].mean()) / scale : 0.0;
+        res.bias = std::max(std::abs(levels[L].mean()), prev) / (scale - 1.0);
+        res.converged = res.bias <= cfg.eps / std::sqrt(2.0);
+        if (res.converged || static_cast<int>(levels.size()) >= cfg.max_levels) break;
+        add_level(levels, cfg);
+    }
+
+    double var = 0.0;
+    for (const Level& lv : levels) {
+        res.price += lv.mean();
+        var += lv.var() / lv.n();
+        res.cost += lv.n() * lv.cost();
+        res.levels.push_back({lv.steps, lv.chunks * CHUNK, lv.mean(), lv.var(), lv.var_fine(), lv.cost()});
+    }
+    res.std_err = std::sqrt(var);
+    const Level& finest = levels.back();
+    res.mc_cost = 2.0 / eps2 * finest.var_fine() * finest.steps;
+    return res;
+}
+
+} // namespace vol::mc
@@ -0,0 +1,147 @@
+#include "libvol/mc/path_mc.hpp"
+#include "libvol/math/special.hpp"
+#include "libvol/mc/rng.hpp"
+#include "libvol/util/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace vol::mc {
+
+namespace {
+
+// Means and centred co-moments of (y, c) over antithetic pair averages, merged across blocks
+// with the pairwise (Chan) update so large sums never cancel
+struct Moments {
+    double n = 0.0, my = 0.0, mc = 0.0, cyy = 0.0, ccc = 0.0, cyc = 0.0;
+
+    void add(double y, double c) {
+        n += 1.0;
+        const double dy = y - my, dc = c - mc;
+        my += dy / n;
+        mc += dc / n;
+        cyy += dy * (y - my);
+        ccc += dc * (c - mc);
+        cyc += dy * (c - mc);
+    }
+
+    void merge(const Moments& o) {
+        if (o.n == 0.0) return;
+        const double total = n + o.n;
+        const double dy = o.my - my, dc = o.mc - mc;
+        const double f = n * o.n / total;
+        cyy += o.cyy + dy * dy * f;
+        ccc += o.ccc + dc * dc * f;
+        cyc += o.cyc + dy * dc * f;
+        my += dy * o.n / total;
+        mc += dc * o.n / total;
+        n = total;
+    }
+};
+
+// Per-thread block buffers: normals, then paths stored path-major (S: n + 1, var: n each)
+struct Workspace {
+    std::vector<double> z, zneg, S, var, vals, cvals;
+};
+
+// Simulates one block of antithetic pairs and folds every payoff into out[0 .. payoffs)
+void run_block(const Discretisation& m, std::span<const PathPayoff> payoffs, double T, const PathMCConfig& cfg,
+               std::uint64_t block, std::uint64_t pairs, Workspace& ws, Moments* out) {
+    SplitMix rng = SplitMix::stream(cfg.seed, 0x2545F4914F6CDD1Dull * (block + 1));
+    const std::size_t n = static_cast<std::size_t>(cfg.steps);
+    const std::size_t k = static_cast<std::size_t>(m.normals);
+    const std::size_t np = static_cast<std::size_t>(pairs);
+    const std::size_t paths = 2 * np;
+    const double dt = T / static_cast<double>(n);
+    const double disc = std::exp(-m.r * T);
+
+    ws.z.resize(np * n * k);
+    ws.zneg.resize(k);
+    ws.S.resize(paths * (n + 1));
+    ws.var.resize(paths * n);
+    ws.vals.resize(paths);
+    ws.cvals.assign(paths, 0.0);
+    rng.normals(ws.z, cfg.accuracy);
+
+    for (std::size_t p = 0; p < paths; ++p) {
+        const double* z = ws.z.data() + (p / 2) * n * k;
+        double* S = ws.S.data() + p * (n + 1);
+        double* var = ws.var.data() + p * n;
+        double s = m.S0, v = m.v0;
+        S[0] = s;
+        for (std::size_t j = 0; j < n; ++j) {
+            const double* zj = z + j * k;
+            if (p % 2) {
+                for (std::size_t c = 0; c < k; ++c) ws.zneg[c] = -zj[c];
+                zj = ws.zneg.data();
+            }
+            var[j] = m.step(s, v, dt, zj);
+            S[j + 1] = s;
+        }
+    }
+
+    auto view = [&](std::size_t p) {
+        return PathView{std::span<const double>(ws.S.data() + p * (n + 1), n + 1),
+                        std::span<const double>(ws.var.data() + p * n, n), T};
+    };
+    if (cfg.control) {
+        for (std::size_t p = 0; p < paths; ++p) ws.cvals[p] = cfg.control(view(p));
+    }
+    for (std::size_t i = 0; i < payoffs.size(); ++i) {
+        for (std::size_t p = 0; p < paths; ++p) ws.vals[p] = payoffs[i](view(p));
+        for (std::size_t j = 0; j < np; ++j) {
+            out[i].add(0.5 * disc * (ws.vals[2 * j] + ws.vals[2 * j + 1]),
+                       0.5 * disc * (ws.cvals[2 * j] + ws.cvals[2 * j + 1]));
+        }
+    }
+}
+
+} // namespace
+
+std::vector<MCResult> path_mc(const Discretisation& model, std::span<const PathPayoff> payoffs, double T,
+                              const PathMCConfig& cfg) {
+    if (cfg.steps < 1 || cfg.paths == 0 || !(T > 0.0)) {
+        throw std::invalid_argument("path_mc: invalid configuration");
+    }
+    if (!model.step || model.normals < 1 ||
+        std::any_of(payoffs.begin(), payoffs.end(), [](const PathPayoff& f) { return !f; })) {
+        throw std::invalid_argument("path_mc: payoffs and discretisation step are required");
+    }
+    if (payoffs.empty()) return {};
+
+    // a pair holds n k normals, two paths of n + 1 spots and n variances, and two payoff
+    // values for the payoff and the control
+    const std::uint64_t pairs = (cfg.paths + 1) / 2;
+    const std::size_t n = static_cast<std::size_t>(cfg.steps);
+    const std::size_t pair_bytes =
+        (n * static_cast<std::size_t>(model.normals) + 2 * (2 * n + 1) + 4) * sizeof(double);
+    const std::uint64_t per_block = std::max<std::uint64_t>(1, cfg.block_bytes / pair_bytes);
+    const std::uint64_t blocks = (pairs + per_block - 1) / per_block;
+    const std::size_t np = payoffs.size();
+    std::vector<Moments> partial(static_cast<std::size_t>(blocks) * np);
+
+    vol::util::ThreadPool pool(static_cast<int>(
+        std::min<std::uint64_t>(static_cast<std::uint64_t>(vol::util::resolve_threads(cfg.n_threads)), blocks)));
+    std::vector<Workspace> ws(static_cast<std::size_t>(pool.size()));
+    pool.run_workers(blocks, [&](std::size_t b, int w) {
+        const std::uint64_t count = std::min(per_block, pairs - b * per_block);
+        run_block(model, payoffs, T, cfg, b, count, ws[static_cast<std::size_t>(w)], partial.data() + b * np);
+    });
+
+    std::vector<MCResult> res;
+    res.reserve(np);
+    for (std::size_t i = 0; i < np; ++i) {
+        Moments mo;
+        for (std::uint64_t b = 0; b < blocks; ++b) mo.merge(partial[b * np + i]);
+        // y - beta (c - E[c]) with beta the regression of y on the control
+        const double beta = mo.ccc > 0.0 ? mo.cyc / mo.ccc : 0.0;
+        const double price = mo.my - beta * (mo.mc - cfg.control_price);
+        const double v = mo.n > 1.0 ? std::max(0.0, mo.cyy - 2.0 * beta * mo.cyc + beta * beta * mo.ccc) / (mo.n - 1.0)
+                                    : 0.0;
+        res.push_back(MCResult{price, std::sqrt(v / mo.n), 2 * pairs});
+    }
+    return res;
+}
+
+} // namespace vol::mc
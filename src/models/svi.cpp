@@ -1,7 +1,9 @@
 #include "libvol/models/svi.hpp"
 #include "libvol/calib/least_squares.hpp"
+#include "libvol/util/telemetry.hpp"
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <numeric>
 
@@ -9,12 +11,25 @@ namespace vol::svi {
 
     // p = {a, b, rho, m, sigma}
     double total_variance(double k, const Params& p) {
-        const double a = p[0], b = p[1], rho = p[2], m = p[3], sigma = p[4];
-        const double x = k - m;
-        const double R = std::sqrt(x * x + sigma * sigma);
-        return a + b * (rho * x + R);
+        return total_variance<double>(k, p[0], p[1], p[2], p[3], p[4]);
     }
 
+    template <std::floating_point Real>
+    void total_variance_batch(const Real* __restrict k, std::size_t n, const Params& p, Real* __restrict out) {
+        const Real a = static_cast<Real>(p[0]), b = static_cast<Real>(p[1]), rho = static_cast<Real>(p[2]);
+        const Real m = static_cast<Real>(p[3]), sigma = static_cast<Real>(p[4]);
+        const std::ptrdiff_t len = static_cast<std::ptrdiff_t>(n);
+#if defined(VOL_ENABLE_SIMD)
+#pragma omp simd
+#endif
+        for (std::ptrdiff_t i = 0; i < len; ++i) {
+            out[i] = total_variance<Real>(k[i], a, b, rho, m, sigma);
+        }
+    }
+
+    template void total_variance_batch<float>(const float*, std::size_t, const Params&, float*);
+    template void total_variance_batch<double>(const double*, std::size_t, const Params&, double*);
+
     bool basic_no_arb(const Params& p) {
         const double b = p[1], rho = p[2], sigma = p[4];
         if (!(std::isfinite(b) && std::isfinite(rho) && std::isfinite(sigma))) return false;
@@ -100,66 +115,66 @@ namespace vol::svi {
     }
 
 // Per-slice
-    Params fit_raw_svi(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts_in)
-    {
-        const std::size_t n = std::min(k.size(), w_mkt.size());
-        std::vector<double> kx(k.begin(), k.begin() + n);
-        std::vector<double> wy(w_mkt.begin(), w_mkt.begin() + n);
-        if (n < 5) {
-            const double kmin = *std::min_element(kx.begin(), kx.end());
-            const double kmax = *std::max_element(kx.begin(), kx.end());
-            const double wmin = *std::min_element(wy.begin(), wy.end());
-            const double b0 = 0.1;
-            const double sigma0 = std::max(1e-3, 0.2 * (kmax - kmin));
-            const double a0 = std::max(1e-10, wmin - b0 * sigma0);
-            return Params{ a0, b0, 0.0, 0.5 * (kmin + kmax), sigma0 };
-        }
-
-        std::vector<std::size_t> idx(n);
-        std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(), [&](std::size_t i, std::size_t j){ return kx[i] < kx[j]; });
+    namespace {
+
+    // Weighted least squares in total variance over the slice sorted by k, with the
+    // heuristic start and data-dependent bounds fit_raw_svi uses (needs n >= 5)
+    struct RawSviProblem {
+        std::size_t n = 0;
+        std::vector<double> k_sorted, w_sorted, wt;
+        double kmin = 0.0, kmax = 0.0, range_k = 0.0;
+        std::vector<double> x0, lb, ub;
+
+        RawSviProblem(const std::vector<double>& kx, const std::vector<double>& wy, const std::vector<double>& wts_in) {
+            n = kx.size();
+            std::vector<std::size_t> idx(n);
+            std::iota(idx.begin(), idx.end(), 0);
+            std::sort(idx.begin(), idx.end(), [&](std::size_t i, std::size_t j){ return kx[i] < kx[j]; });
+
+            k_sorted.resize(n);
+            w_sorted.resize(n);
+            wt.assign(n, 1.0);
+            for (std::size_t t = 0; t < n; ++t) {
+                k_sorted[t] = kx[idx[t]];
+                w_sorted[t] = wy[idx[t]];
+                if (!wts_in.empty()) wt[t] = wts_in[idx[t]];
+            }
 
-        std::vector<double> k_sorted(n), w_sorted(n), wt(n, 1.0);
-        for (std::size_t t = 0; t < n; ++t) {
-            k_sorted[t] = kx[idx[t]];
-            w_sorted[t] = wy[idx[t]];
-            if (!wts_in.empty()) wt[t] = wts_in[idx[t]];
+            kmin = k_sorted.front();
+            kmax = k_sorted.back();
+            auto [min_it, max_it] = std::minmax_element(w_sorted.begin(), w_sorted.end()); 
+            const double wrange = *max_it - *min_it;//faster than scanning twice
+            range_k = std::max(1e-6, kmax - kmin);
+
+            std::size_t i_min = 0;
+            for (std::size_t i = 1; i < n; ++i) if (w_sorted[i] < w_sorted[i_min]) i_min = i;
+            const double m0 = k_sorted[i_min];
+            const double w_at_min = w_sorted[i_min];
+
+            const std::size_t wing = std::max<std::size_t>(2, n / 5);
+            double sL = 0.05, sR = 0.05;
+            linreg_slope(k_sorted, w_sorted, 0, std::min(wing, n-1), sL);
+            linreg_slope(k_sorted, w_sorted, (n > wing ? n - wing : 0), n - 1, sR);
+            sL = std::max(1e-4, std::abs(sL));
+            sR = std::max(1e-4, std::abs(sR));
+
+            double b0   = 0.5 * (sL + sR);
+            double rho0 = (sR - sL) / std::max(1e-12, (sR + sL));
+            b0   = clamp(b0,   1e-6, 10.0);
+            rho0 = clamp(rho0, -0.95, 0.95);
+
+            double c2 = local_quadratic_curvature(k_sorted, w_sorted, i_min);
+            double sigma0 = (c2 > 1e-6) ? clamp(b0 / c2, 1e-4, 2.0) : clamp(0.2 * range_k, 1e-4, 2.0);
+
+            double a0 = std::max(1e-10, w_at_min - b0 * sigma0);
+
+            const double a_max = std::max(1.0, 5.0 * (wrange > 0.0 ? wrange : (w_at_min + b0 * sigma0 + 1.0)));
+            x0 = { a0, b0, rho0, m0, sigma0 };
+            lb = { 1e-12, 1e-8, -0.999, kmin - 1.0 * range_k, 1e-6 };
+            ub = { a_max,  10.0,  0.999, kmax + 1.0 * range_k,  5.0  };
         }
 
-        const double kmin = k_sorted.front();
-        const double kmax = k_sorted.back();
-        auto [min_it, max_it] = std::minmax_element(w_sorted.begin(), w_sorted.end()); 
-        const double wrange = *max_it - *min_it;//faster than scanning twice
-        const double range_k = std::max(1e-6, kmax - kmin);
-
-        std::size_t i_min = 0;
-        for (std::size_t i = 1; i < n; ++i) if (w_sorted[i] < w_sorted[i_min]) i_min = i;
-        const double m0 = k_sorted[i_min];
-        const double w_at_min = w_sorted[i_min];
-
-        const std::size_t wing = std::max<std::size_t>(2, n / 5);
-        double sL = 0.05, sR = 0.05;
-        linreg_slope(k_sorted, w_sorted, 0, std::min(wing, n-1), sL);
-        linreg_slope(k_sorted, w_sorted, (n > wing ? n - wing : 0), n - 1, sR);
-        sL = std::max(1e-4, std::abs(sL));
-        sR = std::max(1e-4, std::abs(sR));
-
-        double b0   = 0.5 * (sL + sR);
-        double rho0 = (sR - sL) / std::max(1e-12, (sR + sL));
-        b0   = clamp(b0,   1e-6, 10.0);
-        rho0 = clamp(rho0, -0.95, 0.95);
-
-        double c2 = local_quadratic_curvature(k_sorted, w_sorted, i_min);
-        double sigma0 = (c2 > 1e-6) ? clamp(b0 / c2, 1e-4, 2.0) : clamp(0.2 * range_k, 1e-4, 2.0);
-
-        double a0 = std::max(1e-10, w_at_min - b0 * sigma0);
-
-        const double a_max = std::max(1.0, 5.0 * (wrange > 0.0 ? wrange : (w_at_min + b0 * sigma0 + 1.0)));
-        const std::vector<double> x0 = { a0, b0, rho0, m0, sigma0 };
-        const std::vector<double> lb = { 1e-12, 1e-8, -0.999, kmin - 1.0 * range_k, 1e-6 };
-        const std::vector<double> ub = { a_max,  10.0,  0.999, kmax + 1.0 * range_k,  5.0  };
-
-        auto f_grad = [&](const std::vector<double>& x, double& f, std::vector<double>& g) {
+        void f_grad(const std::vector<double>& x, double& f, std::vector<double>& g) const {
             const double a = x[0], b = x[1], rho = x[2], m = x[3], sigma = x[4];
             const double eps = 1e-12;
             const double rho_c = clamp(rho, -0.999, 0.999);
@@ -211,38 +226,125 @@ namespace vol::svi {
             if (std::abs(rho) >= 1.0){ pen += std::tanh(100.0 * (std::abs(rho) - 0.999)); g[2] +=  100.0 * inv * ((rho > 0) ? 1.0 : -1.0);}
             if (sigma <= 0.0)  { pen += (1.0 - std::tanh( 100.0 * sigma));   g[4] += -100.0 * inv; }
             f += 1e-8 * pen;
-        };
+        }
+
+        double rmse(const Params& p) const {
+            double f = 0.0;
+            std::vector<double> g;
+            f_grad(std::vector<double>(p.begin(), p.end()), f, g);
+            return std::sqrt(std::max(0.0, 2.0 * f));
+        }
+
+        // Best converged local solve over the given starts; the clamped heuristic start if
+        // none converges to an admissible point
+        FitResult solve(const std::vector<std::vector<double>>& starts) const {
+            auto fg = [this](const std::vector<double>& x, double& f, std::vector<double>& g) { f_grad(x, f, g); };
+            FitResult out{Params{}, std::numeric_limits<double>::infinity(), 0, static_cast<int>(n), false};
+            const double base_tol = 1e-8;
+            for (const auto& s : starts) {
+                auto res = calib::lbfgsb(s, lb, ub, fg, 500, base_tol);
+                out.iterations += res.iters;
+                if (!res.converged) VOL_TELEMETRY_COUNT(SviStartUnconverged);
+                if (res.converged && res.x.size() == 5) {
+                    const double rmse = std::sqrt(std::max(0.0, 2.0 * res.obj));
+                    if (rmse < out.rmse) {
+                        out.rmse = rmse;
+                        out.params = Params{ res.x[0], res.x[1], res.x[2], res.x[3], res.x[4] };
+                        out.converged = true;
+                    }
+                }
+            }
 
-        Params best_p{};
-        double best_rmse = std::numeric_limits<double>::infinity();
-        const double base_tol = 1e-8;
+            if (!basic_no_arb(out.params)) {
+                VOL_TELEMETRY_COUNT(SviHeuristicFallback);
+                out.params = Params{ clamp(x0[0], lb[0], ub[0]),
+                                     clamp(x0[1], lb[1], ub[1]),
+                                     clamp(x0[2], lb[2], ub[2]),
+                                     clamp(x0[3], lb[3], ub[3]),
+                                     clamp(x0[4], lb[4], ub[4]) };
+                out.rmse = rmse(out.params);
+                out.converged = false;
+            }
+            return out;
+        }
+    };
+
+    FitResult heuristic_fit(const std::vector<double>& kx, const std::vector<double>& wy) {
+        const double kmin = *std::min_element(kx.begin(), kx.end());
+        const double kmax = *std::max_element(kx.begin(), kx.end());
+        const double wmin = *std::min_element(wy.begin(), wy.end());
+        const double b0 = 0.1;
+        const double sigma0 = std::max(1e-3, 0.2 * (kmax - kmin));
+        const double a0 = std::max(1e-10, wmin - b0 * sigma0);
+        return {Params{ a0, b0, 0.0, 0.5 * (kmin + kmax), sigma0 },
+                std::numeric_limits<double>::quiet_NaN(), 0, static_cast<int>(kx.size()), false};
+    }
+
+    } // namespace
+
+    Params fit_raw_svi(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts_in)
+    {
+        return fit_raw_svi_report(k, w_mkt, wts_in).params;
+    }
+
+    FitResult fit_raw_svi_report(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts_in)
+    {
+        VOL_TELEMETRY_COUNT(SviFits);
+        const std::size_t n = std::min(k.size(), w_mkt.size());
+        std::vector<double> kx(k.begin(), k.begin() + n);
+        std::vector<double> wy(w_mkt.begin(), w_mkt.begin() + n);
+        if (n < 5) {
+            VOL_TELEMETRY_COUNT(SviFewPoints);
+            return heuristic_fit(kx, wy);
+        }
 
-        const std::vector<std::vector<double>> starts = {
+        const RawSviProblem prob(kx, wy, wts_in);
+        const auto& x0 = prob.x0;
+        const double kmin = prob.kmin, kmax = prob.kmax, range_k = prob.range_k;
+        return prob.solve({
             x0,
             { x0[0], x0[1], clamp(x0[2] + 0.2, -0.95, 0.95), clamp(x0[3] + 0.25 * range_k, kmin - range_k, kmax + range_k), x0[4] },
             { x0[0], x0[1], clamp(x0[2] - 0.2, -0.95, 0.95), clamp(x0[3] - 0.25 * range_k, kmin - range_k, kmax + range_k), x0[4] }
-        };
+        });
+    }
 
-        for (const auto& s : starts) {
-            auto res = calib::lbfgsb(s, lb, ub, f_grad, 500, base_tol);
-            if (res.converged && res.x.size() == 5) {
-                const double rmse = std::sqrt(std::max(0.0, 2.0 * res.obj));
-                if (rmse < best_rmse) {
-                    best_rmse = rmse;
-                    best_p = Params{ res.x[0], res.x[1], res.x[2], res.x[3], res.x[4] };
-                }
+    FitResult fit_raw_svi_warm(const std::vector<double>& k, const std::vector<double>& w_mkt, const std::vector<double>& wts_in,
+                               const Params& start)
+    {
+        const std::size_t n = std::min(k.size(), w_mkt.size());
+        if (n < 5 || !basic_no_arb(start)) {
+            VOL_TELEMETRY_COUNT(SviWarmColdFallback);
+            return fit_raw_svi_report(k, w_mkt, wts_in);
+        }
+        VOL_TELEMETRY_COUNT(SviFits);
+        std::vector<double> kx(k.begin(), k.begin() + n);
+        std::vector<double> wy(w_mkt.begin(), w_mkt.begin() + n);
+        const RawSviProblem prob(kx, wy, wts_in);
+        std::vector<double> x(5);
+        for (std::size_t i = 0; i < 5; ++i) x[i] = clamp(start[i], prob.lb[i], prob.ub[i]);
+        const double start_rmse = prob.rmse(Params{ x[0], x[1], x[2], x[3], x[4] });
+
+        // Unlike the cold path, keep the best iterate even if the gradient test was not met:
+        // starting at yesterday's optimum it can only improve on the start.
+        auto fg = [&prob](const std::vector<double>& v, double& f, std::vector<double>& g) { prob.f_grad(v, f, g); };
+        const auto res = calib::lbfgsb(x, prob.lb, prob.ub, fg, 500, 1e-8);
+        FitResult out{Params{ x[0], x[1], x[2], x[3], x[4] }, start_rmse, res.iters, static_cast<int>(n), res.converged};
+        if (res.x.size() == 5) {
+            const Params p{ res.x[0], res.x[1], res.x[2], res.x[3], res.x[4] };
+            const double rmse = std::sqrt(std::max(0.0, 2.0 * res.obj));
+            if (basic_no_arb(p) && rmse <= start_rmse) {
+                out.params = p;
+                out.rmse = rmse;
             }
         }
-
-        if (!basic_no_arb(best_p)) {
-            best_p = Params{ clamp(x0[0], lb[0], ub[0]),
-                            clamp(x0[1], lb[1], ub[1]),
-                            clamp(x0[2], lb[2], ub[2]),
-                            clamp(x0[3], lb[3], ub[3]),
-                            clamp(x0[4], lb[4], ub[4]) };
+        if (!std::isfinite(out.rmse)) {
+            // nothing usable came out of the local solve; pay for the cold multi-start
+            VOL_TELEMETRY_COUNT(SviWarmColdFallback);
+            const int spent = out.iterations;
+            out = fit_raw_svi_report(k, w_mkt, wts_in);
+            out.iterations += spent;
         }
-
-        return best_p;
+        return out;
     }
 
 } // namespace vol::svi
@@ -0,0 +1,370 @@
+#include "libvol/stream/pipeline.hpp"
+
+#include "libvol/models/american.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/stream/ring.hpp"
+#include "libvol/util/telemetry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace vol::stream {
+
+std::uint64_t now_ns() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+namespace {
+
+struct BookEntry {
+    double K;
+    bool is_call;
+    double mid;
+    double spot;
+    svi::SlicePoint point;   // from the implied vol of mid at spot
+};
+
+// Owned by the IV thread
+struct ExpiryState {
+    std::vector<BookEntry> book;   // sorted by (K, is_call)
+    bool dirty = false;
+    bool scheduled = false;        // a job has been created, last_job_ns is set
+    bool live = false;             // the last job was a fit, not an invalidation
+    std::size_t ticks = 0;
+    std::uint64_t first_tick_ns = 0;
+    std::uint64_t last_tick_ns = 0;
+    std::uint64_t last_job_ns = 0;
+};
+
+// A fit of k / w / weight, or an invalidation when the columns are empty
+struct FitJob {
+    std::uint32_t expiry = 0;
+    std::vector<double> k, w, weight;
+    std::size_t quotes = 0;   // book size
+    std::size_t ticks = 0;
+    std::uint64_t first_tick_ns = 0;
+    std::uint64_t last_tick_ns = 0;
+};
+
+// Spin-then-sleep wait for the stage loops: yields while work is likely to show up
+// within a scheduler quantum, then backs off so an idle pipeline does not burn a core
+class Idle {
+public:
+    void reset() { polls_ = 0; }
+    void wait() {
+        if (++polls_ < 256) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        }
+    }
+
+private:
+    unsigned polls_ = 0;
+};
+
+} // namespace
+
+struct Pipeline::Impl {
+    Config cfg;
+    MpscRing<Quote> ingest;
+    SpscRing<FitJob> fit_jobs;
+    SpscRing<SliceUpdate> updates;
+
+    std::vector<ExpiryState> expiries;   // IV thread only
+    std::vector<std::uint64_t> versions;   // fit thread only
+    std::unique_ptr<std::atomic<bool>[]> in_flight;
+
+    std::atomic<bool> running{true};
+    std::atomic<std::uint64_t> submitted{0}, dropped{0}, rejected{0}, fits{0}, fit_failures{0}, invalidations{0},
+        published{0}, blocked{0};
+    // flush() bookkeeping: quotes through the IV stage, expiries dirty but not yet
+    // snapshotted, fit jobs created and fully retired (published or failed)
+    std::atomic<std::uint64_t> ingested{0}, dirty{0}, jobs_created{0}, jobs_finished{0};
+
+    std::thread iv_thread, fit_thread, publish_thread;
+
+    explicit Impl(Config c)
+        : cfg(std::move(c)), ingest(cfg.ingest_capacity), fit_jobs(cfg.fit_capacity), updates(cfg.publish_capacity),
+          expiries(cfg.expiries.size()), versions(cfg.expiries.size(), 0),
+          in_flight(new std::atomic<bool>[cfg.expiries.size()]) {
+        if (!cfg.clock) cfg.clock = now_ns;
+        for (std::size_t e = 0; e < cfg.expiries.size(); ++e) in_flight[e].store(false, std::memory_order_relaxed);
+    }
+
+    // IV stage -----------------------------------------------------------------------
+
+    void ingest_quote(const Quote& q) {
+        const Expiry& ex = cfg.expiries[q.expiry];
+        ExpiryState& st = expiries[q.expiry];
+        auto it = std::lower_bound(st.book.begin(), st.book.end(), q, [](const BookEntry& b, const Quote& x) {
+            return b.K < x.K || (b.K == x.K && b.is_call < x.is_call);
+        });
+        const bool found = it != st.book.end() && it->K == q.K && it->is_call == q.is_call;
+
+        if (q.mid <= 0.0) {
+            if (!found) return;
+            st.book.erase(it);
+        } else {
+            if (found && it->mid == q.mid && it->spot == q.spot) return;   // no change, nothing to refit
+            // the one inversion of this mid; fits reuse the stored point
+            const svi::SliceConfig& sc = cfg.slice;
+            const auto iv = sc.american
+                ? american::implied_vol(q.spot, q.K, ex.r, ex.q, ex.T, q.mid, q.is_call, sc.american_scheme, 1e-10)
+                : bs::implied_vol(q.spot, q.K, ex.r, ex.q, ex.T, q.mid, q.is_call, 0.2, 1e-10);
+            if (!iv.converged || !std::isfinite(iv.iv) || iv.iv <= 0.0) {
+                rejected.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            const svi::SlicePoint pt = svi::slice_point(q.spot, q.K, ex.r, ex.q, ex.T, iv.iv, q.is_call, sc);
+            if (found) {
+                it->mid = q.mid;
+                it->spot = q.spot;
+                it->point = pt;
+            } else {
+                st.book.insert(it, {q.K, q.is_call, q.mid, q.spot, pt});
+            }
+        }
+
+        if (!st.dirty) {
+            st.dirty = true;
+            st.first_tick_ns = q.t_ns;
+            dirty.fetch_add(1, std::memory_order_relaxed);
+        }
+        ++st.ticks;
+        st.last_tick_ns = q.t_ns;
+    }
+
+    // Snapshot every expiry that is due. A book too thin to fit becomes an invalidation if
+    // the expiry has a fit out, otherwise it is left clean until more quotes arrive.
+    bool schedule(std::uint64_t now) {
+        bool any = false;
+        const auto interval = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(cfg.min_refit_interval).count());
+        const auto min_points = static_cast<std::size_t>(std::max(1, cfg.slice.min_points));
+        for (std::uint32_t e = 0; e < expiries.size(); ++e) {
+            ExpiryState& st = expiries[e];
+            if (!st.dirty || in_flight[e].load(std::memory_order_acquire)) continue;
+            if (st.scheduled && now - st.last_job_ns < interval) continue;
+
+            const bool fit = st.book.size() >= min_points;
+            if (fit || st.live) {
+                FitJob job;
+                job.expiry = e;
+                if (fit) {
+                    job.k.reserve(st.book.size());
+                    job.w.reserve(st.book.size());
+                    job.weight.reserve(st.book.size());
+                    for (const BookEntry& b : st.book) {
+                        job.k.push_back(b.point.k);
+                        job.w.push_back(b.point.w);
+                        job.weight.push_back(b.point.weight);
+                    }
+                }
+                job.quotes = st.book.size();
+                job.ticks = st.ticks;
+                job.first_tick_ns = st.first_tick_ns;
+                job.last_tick_ns = st.last_tick_ns;
+                in_flight[e].store(true, std::memory_order_relaxed);
+                if (!fit_jobs.try_push(std::move(job))) {
+                    in_flight[e].store(false, std::memory_order_relaxed);
+                    continue;   // fit stage is backed up; stay dirty and retry
+                }
+                jobs_created.fetch_add(1, std::memory_order_release);
+                st.scheduled = true;
+                st.live = fit;
+                st.last_job_ns = now;
+            }
+            st.dirty = false;
+            st.ticks = 0;
+            dirty.fetch_sub(1, std::memory_order_release);
+            any = true;
+        }
+        return any;
+    }
+
+    void run_iv() {
+        Idle idle;
+        Quote q;
+        while (running.load(std::memory_order_relaxed)) {
+            std::size_t n = 0;
+            // bounded drain so a flood of ticks cannot starve scheduling
+            if (ingest.try_pop(q)) {
+                VOL_TELEMETRY_SCOPE(PipelineIvBatch);
+                do {
+                    ingest_quote(q);
+                    ingested.fetch_add(1, std::memory_order_release);
+                    ++n;
+                } while (n < 1024 && ingest.try_pop(q));
+            }
+            const bool scheduled = dirty.load(std::memory_order_relaxed) != 0 && schedule(cfg.clock());
+            if (n == 0 && !scheduled) {
+                idle.wait();
+            } else {
+                idle.reset();
+            }
+        }
+    }
+
+    // Fit stage ----------------------------------------------------------------------
+
+    void run_fit() {
+        Idle idle;
+        FitJob job;
+        while (running.load(std::memory_order_relaxed)) {
+            if (!fit_jobs.try_pop(job)) {
+                idle.wait();
+                continue;
+            }
+            idle.reset();
+            SliceUpdate up{};
+            up.valid = !job.k.empty();
+            if (up.valid) {
+                try {
+                    VOL_TELEMETRY_SCOPE(PipelineFit);
+                    up.params = svi::calibrate_slice_variance(job.k, job.w, job.weight, cfg.slice).params;
+                } catch (...) {
+                    fit_failures.fetch_add(1, std::memory_order_relaxed);
+                    in_flight[job.expiry].store(false, std::memory_order_release);
+                    jobs_finished.fetch_add(1, std::memory_order_release);
+                    continue;
+                }
+                fits.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                up.params.fill(std::numeric_limits<double>::quiet_NaN());
+                invalidations.fetch_add(1, std::memory_order_relaxed);
+            }
+            up.expiry = job.expiry;
+            up.T = cfg.expiries[job.expiry].T;
+            up.version = ++versions[job.expiry];
+            up.quotes = job.quotes;
+            up.ticks = job.ticks;
+            up.first_tick_ns = job.first_tick_ns;
+            up.last_tick_ns = job.last_tick_ns;
+            while (!updates.try_push(up)) {
+                if (!running.load(std::memory_order_relaxed)) return;
+                std::this_thread::yield();
+            }
+            in_flight[job.expiry].store(false, std::memory_order_release);
+        }
+    }
+
+    // Publish stage ------------------------------------------------------------------
+
+    void run_publish() {
+        Idle idle;
+        SliceUpdate up;
+        while (running.load(std::memory_order_relaxed)) {
+            if (!updates.try_pop(up)) {
+                idle.wait();
+                continue;
+            }
+            idle.reset();
+            up.published_ns = now_ns();
+            if (up.first_tick_ns != 0 && up.first_tick_ns <= up.published_ns) {
+                VOL_TELEMETRY_RECORD(PipelineTickToPublish, up.published_ns - up.first_tick_ns);
+            }
+            {
+                VOL_TELEMETRY_SCOPE(PipelinePublish);
+                cfg.publish(up);
+            }
+            published.fetch_add(1, std::memory_order_relaxed);
+            jobs_finished.fetch_add(1, std::memory_order_release);
+        }
+    }
+};
+
+Pipeline::Pipeline(Config cfg) {
+    if (cfg.expiries.empty()) {
+        throw std::invalid_argument("stream::Pipeline: no expiries");
+    }
+    if (!cfg.publish) {
+        throw std::invalid_argument("stream::Pipeline: publish callback is required");
+    }
+    for (const Expiry& e : cfg.expiries) {
+        if (!(e.T > 0.0)) {
+            throw std::invalid_argument("stream::Pipeline: expiry T must be positive");
+        }
+    }
+    impl_ = std::make_unique<Impl>(std::move(cfg));
+    Impl* p = impl_.get();
+    p->iv_thread = std::thread([p] { p->run_iv(); });
+    p->fit_thread = std::thread([p] { p->run_fit(); });
+    p->publish_thread = std::thread([p] { p->run_publish(); });
+}
+
+Pipeline::~Pipeline() { stop(); }
+
+bool Pipeline::submit(const Quote& q) {
+    Impl& p = *impl_;
+    if (q.expiry >= p.cfg.expiries.size()) {
+        throw std::invalid_argument("stream::Pipeline::submit: unknown expiry index");
+    }
+    if (!p.running.load(std::memory_order_relaxed)) return false;
+    // counted before the push, so the IV thread can never ingest a quote flush() does not
+    // yet wait for; taken back if the quote never makes it into the ring
+    p.submitted.fetch_add(1, std::memory_order_acq_rel);
+    if (!p.ingest.try_push(q)) {
+        if (p.cfg.backpressure == Backpressure::Reject) {
+            p.submitted.fetch_sub(1, std::memory_order_acq_rel);
+            p.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        p.blocked.fetch_add(1, std::memory_order_relaxed);
+        do {
+            if (!p.running.load(std::memory_order_relaxed)) {
+                p.submitted.fetch_sub(1, std::memory_order_acq_rel);
+                return false;
+            }
+            std::this_thread::yield();
+        } while (!p.ingest.try_push(q));
+    }
+    return true;
+}
+
+void Pipeline::flush() {
+    Impl& p = *impl_;
+    Idle idle;
+    // read order matters: a quote counted in ingested has already marked its expiry dirty,
+    // and a snapshot bumps jobs_created before it clears the dirty count
+    while (p.running.load(std::memory_order_relaxed)) {
+        const std::uint64_t target = p.submitted.load(std::memory_order_acquire);
+        if (p.ingested.load(std::memory_order_acquire) >= target && p.dirty.load(std::memory_order_acquire) == 0) {
+            const std::uint64_t finished = p.jobs_finished.load(std::memory_order_acquire);
+            if (finished == p.jobs_created.load(std::memory_order_acquire)) return;
+        }
+        idle.wait();
+    }
+}
+
+void Pipeline::stop() {
+    if (!impl_) return;
+    impl_->running.store(false);
+    for (std::thread* t : {&impl_->iv_thread, &impl_->fit_thread, &impl_->publish_thread}) {
+        if (t->joinable()) t->join();
+    }
+}
+
+Stats Pipeline::stats() const {
+    const Impl& p = *impl_;
+    Stats s;
+    s.submitted = p.submitted.load(std::memory_order_relaxed);
+    s.dropped = p.dropped.load(std::memory_order_relaxed);
+    s.ingested = p.ingested.load(std::memory_order_acquire);
+    s.rejected = p.rejected.load(std::memory_order_relaxed);
+    s.fits = p.fits.load(std::memory_order_relaxed);
+    s.fit_failures = p.fit_failures.load(std::memory_order_relaxed);
+    s.invalidations = p.invalidations.load(std::memory_order_relaxed);
+    s.published = p.published.load(std::memory_order_relaxed);
+    s.blocked_submits = p.blocked.load(std::memory_order_relaxed);
+    return s;
+}
+
+} // namespace vol::stream
@@ -0,0 +1,145 @@
+#include "libvol/stream/surface_store.hpp"
+
+#include "libvol/stream/pipeline.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace vol::stream {
+
+double Surface::total_variance(double k, double T) const {
+    if (slices.empty()) return std::numeric_limits<double>::quiet_NaN();
+    const SurfaceSlice& first = slices.front();
+    const SurfaceSlice& last = slices.back();
+    if (T <= first.T) return svi::total_variance(k, first.params) * T / first.T;
+    if (T >= last.T) return svi::total_variance(k, last.params) * T / last.T;
+    const auto hi = std::lower_bound(slices.begin(), slices.end(), T,
+                                     [](const SurfaceSlice& s, double t) { return s.T < t; });
+    const auto lo = hi - 1;
+    const double a = (T - lo->T) / (hi->T - lo->T);
+    return (1.0 - a) * svi::total_variance(k, lo->params) + a * svi::total_variance(k, hi->params);
+}
+
+SurfaceStore::SurfaceStore(std::size_t n_underlyings, std::size_t max_readers)
+    : n_(n_underlyings), max_readers_(max_readers) {
+    if (n_underlyings == 0 || max_readers == 0) {
+        throw std::invalid_argument("SurfaceStore: underlying and reader counts must be positive");
+    }
+    slots_ = std::make_unique<Slot[]>(n_);
+    readers_ = std::make_unique<ReaderRecord[]>(max_readers_);
+}
+
+SurfaceStore::~SurfaceStore() {
+    for (std::size_t u = 0; u < n_; ++u) delete slots_[u].current.load(std::memory_order_relaxed);
+    for (const auto& r : retired_) delete r.second;
+}
+
+std::size_t SurfaceStore::check(std::uint32_t underlying) const {
+    if (underlying >= n_) {
+        throw std::invalid_argument("SurfaceStore: underlying index out of range");
+    }
+    return underlying;
+}
+
+// Readers -----------------------------------------------------------------------------
+
+SurfaceStore::Reader SurfaceStore::reader() const {
+    for (std::size_t i = 0; i < max_readers_; ++i) {
+        bool free = false;
+        if (readers_[i].in_use.compare_exchange_strong(free, true, std::memory_order_acquire)) {
+            return Reader(this, &readers_[i]);
+        }
+    }
+    throw std::runtime_error("SurfaceStore: all reader slots are in use");
+}
+
+SurfaceStore::Reader::~Reader() {
+    if (store_ == nullptr) return;
+    record_->epoch.store(0, std::memory_order_release);
+    record_->in_use.store(false, std::memory_order_release);
+}
+
+SurfaceStore::Snapshot SurfaceStore::Reader::read(std::uint32_t underlying) {
+    const Slot& slot = store_->slots_[store_->check(underlying)];
+    // Announce the epoch before loading the pointer (both seq_cst): a writer that scans
+    // after our store sees us, and one that scanned before it had already swapped the
+    // pointer, so we load the new surface
+    if (depth_++ == 0) record_->epoch.store(store_->epoch_.load());
+    return Snapshot(this, slot.current.load());
+}
+
+void SurfaceStore::Reader::unpin() {
+    if (--depth_ == 0) record_->epoch.store(0, std::memory_order_release);
+}
+
+SurfaceStore::Snapshot::~Snapshot() {
+    if (reader_ != nullptr) reader_->unpin();
+}
+
+// Writers -----------------------------------------------------------------------------
+
+std::uint64_t SurfaceStore::publish(std::uint32_t underlying, std::vector<SurfaceSlice> slices) {
+    check(underlying);
+    std::sort(slices.begin(), slices.end(), [](const SurfaceSlice& a, const SurfaceSlice& b) { return a.T < b.T; });
+    auto next = std::make_unique<Surface>();
+    next->slices = std::move(slices);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    return install(underlying, std::move(next));
+}
+
+std::uint64_t SurfaceStore::publish_slice(std::uint32_t underlying, double T, const svi::Params& params) {
+    check(underlying);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    // writers are serialised, so the current surface cannot be retired under us
+    const Surface* cur = slots_[underlying].current.load(std::memory_order_acquire);
+    auto next = std::make_unique<Surface>();
+    if (cur != nullptr) next->slices = cur->slices;
+    auto it = std::lower_bound(next->slices.begin(), next->slices.end(), T,
+                               [](const SurfaceSlice& s, double t) { return s.T < t; });
+    if (it != next->slices.end() && it->T == T) {
+        it->params = params;
+    } else {
+        next->slices.insert(it, {T, params});
+    }
+    return install(underlying, std::move(next));
+}
+
+std::uint64_t SurfaceStore::install(std::uint32_t underlying, std::unique_ptr<Surface> next) {
+    Slot& slot = slots_[underlying];
+    const std::uint64_t version = slot.version.load(std::memory_order_relaxed) + 1;
+    next->underlying = underlying;
+    next->version = version;
+    next->published_ns = now_ns();
+    const Surface* old = slot.current.exchange(next.release());
+    slot.version.store(version, std::memory_order_release);
+    if (old != nullptr) {
+        // readers pinned at or before this epoch may still hold old
+        retired_.emplace_back(epoch_.fetch_add(1), old);
+        reclaim_locked();
+    }
+    return version;
+}
+
+void SurfaceStore::reclaim() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    reclaim_locked();
+}
+
+void SurfaceStore::reclaim_locked() {
+    std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t i = 0; i < max_readers_; ++i) {
+        const std::uint64_t e = readers_[i].epoch.load();
+        if (e != 0) oldest = std::min(oldest, e);
+    }
+    auto keep = std::partition(retired_.begin(), retired_.end(), [oldest](const auto& r) { return r.first >= oldest; });
+    for (auto it = keep; it != retired_.end(); ++it) delete it->second;
+    retired_.erase(keep, retired_.end());
+}
+
+std::size_t SurfaceStore::pending_reclaim() const {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    return retired_.size();
+}
+
+} // namespace vol::stream
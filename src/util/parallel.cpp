@@ -0,0 +1,97 @@
+#include "libvol/util/parallel.hpp"
+
+#include <algorithm>
+
+namespace vol::util {
+
+int resolve_threads(int n_threads) {
+    return n_threads > 0 ? n_threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+ThreadPool::ThreadPool(int n_threads) {
+    const int workers = resolve_threads(n_threads) - 1;
+    for (int w = 0; w < workers; ++w) threads_.emplace_back([this, w] { work(w + 1); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& t : threads_) t.join();
+}
+
+void ThreadPool::run(std::size_t n, const std::function<void(std::size_t)>& fn) {
+    run_workers(n, [&fn](std::size_t i, int) { fn(i); });
+}
+
+void ThreadPool::run_workers(std::size_t n, const std::function<void(std::size_t, int)>& fn) {
+    if (threads_.empty() || n <= 1) {
+        for (std::size_t i = 0; i < n; ++i) fn(i, 0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        fn_ = &fn;
+        n_ = n;
+        next_.store(0, std::memory_order_relaxed);
+        busy_ = threads_.size();
+        error_ = nullptr;
+        ++epoch_;
+    }
+    start_.notify_all();
+    drain(0);
+    std::unique_lock<std::mutex> lock(m_);
+    done_.wait(lock, [this] { return busy_ == 0; });
+    if (error_) std::rethrow_exception(error_);
+}
+
+void ThreadPool::work(int worker) {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_);
+            start_.wait(lock, [&] { return stop_ || epoch_ != seen; });
+            if (stop_) return;
+            seen = epoch_;
+        }
+        drain(worker);
+        std::lock_guard<std::mutex> lock(m_);
+        if (--busy_ == 0) done_.notify_one();
+    }
+}
+
+void ThreadPool::drain(int worker) {
+    for (std::size_t i; (i = next_.fetch_add(1, std::memory_order_relaxed)) < n_;) {
+        try {
+            (*fn_)(i, worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_);
+            if (!error_) error_ = std::current_exception();
+            next_.store(n_, std::memory_order_relaxed);
+        }
+    }
+}
+
+void for_chunks(ThreadPool& pool, std::size_t n, std::size_t grain,
+                const std::function<void(std::size_t, std::size_t)>& fn) {
+    grain = std::max<std::size_t>(1, grain);
+    pool.run((n + grain - 1) / grain, [&](std::size_t c) { fn(c * grain, std::min(n, (c + 1) * grain)); });
+}
+
+void parallel_for(std::size_t n, int n_threads, std::size_t grain,
+                  const std::function<void(std::size_t, std::size_t)>& fn) {
+    grain = std::max<std::size_t>(1, grain);
+    const std::size_t chunks = (n + grain - 1) / grain;
+    const int threads = static_cast<int>(std::min<std::size_t>(static_cast<std::size_t>(resolve_threads(n_threads)),
+                                                               std::max<std::size_t>(1, chunks)));
+    if (threads <= 1) {
+        if (n > 0) fn(0, n);
+        return;
+    }
+    ThreadPool pool(threads);
+    for_chunks(pool, n, grain, fn);
+}
+
+} // namespace vol::util
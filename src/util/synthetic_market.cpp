@@ -0,0 +1,108 @@
+#include "libvol/util/synthetic_market.hpp"
+
+#include "libvol/math/special.hpp"
+#include "libvol/models/black_scholes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace vol::synth {
+
+namespace {
+
+class Rng {
+public:
+    explicit Rng(std::uint64_t seed) : s_(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (s_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+    // (0, 1), never an endpoint
+    double uniform() { return (static_cast<double>(next() >> 11) + 0.5) * 0x1.0p-53; }
+    double uniform(double lo, double hi) { return lo + (hi - lo) * uniform(); }
+    double normal() { return math::norm_inv_cdf(uniform()); }
+
+private:
+    std::uint64_t s_;
+};
+
+// SSVI slice with theta = ATM total variance, phi = eta / sqrt(theta), written as raw SVI.
+// eta (1 + |rho|) <= 2 keeps each slice free of butterfly arbitrage.
+svi::Params ssvi_raw(double theta, double rho, double eta) {
+    const double phi = eta / std::sqrt(theta);
+    const double s = std::sqrt(1.0 - rho * rho);
+    return {0.5 * theta * (1.0 - rho * rho), 0.5 * theta * phi, rho, -rho / phi, s / phi};
+}
+
+} // namespace
+
+std::size_t Market::quotes() const {
+    std::size_t n = 0;
+    for (const auto& s : slices) n += s.size();
+    return n;
+}
+
+Market generate_market(const MarketConfig& cfg) {
+    if (cfg.underlyings == 0 || cfg.expiries == 0 || cfg.strikes < 2) {
+        throw std::invalid_argument("synth::generate_market: need underlyings, expiries > 0 and strikes >= 2");
+    }
+    if (!(cfg.min_T > 0.0) || !(cfg.max_T >= cfg.min_T)) {
+        throw std::invalid_argument("synth::generate_market: expiry range must satisfy 0 < min_T <= max_T");
+    }
+
+    Market m;
+    m.cfg = cfg;
+    m.slices.reserve(static_cast<std::size_t>(cfg.underlyings) * cfg.expiries);
+    for (std::uint32_t u = 0; u < cfg.underlyings; ++u) {
+        // one stream per underlying, so a market prefix does not depend on its size
+        Rng rng(cfg.seed * 0x2545F4914F6CDD1Dull + u);
+        const double S = std::exp(rng.uniform(std::log(5.0), std::log(2000.0)));
+        const double r = rng.uniform(0.0, 0.05);
+        const double q = rng.uniform(0.0, 0.04);
+        const double atm_vol = rng.uniform(0.12, 0.8);
+        const double term_slope = rng.uniform(-0.3, 0.3);   // vol term structure, per unit log T
+        const double rho = rng.uniform(-0.8, -0.05);
+        const double eta = rng.uniform(0.3, 1.0) * 2.0 / (1.0 + std::abs(rho));
+
+        for (std::uint32_t e = 0; e < cfg.expiries; ++e) {
+            const double frac = cfg.expiries > 1 ? static_cast<double>(e) / (cfg.expiries - 1) : 0.0;
+            const double T = cfg.min_T * std::pow(cfg.max_T / cfg.min_T, frac);
+            const double vol_T = std::max(0.05, atm_vol * (1.0 + term_slope * std::log(T)));
+            const double theta = vol_T * vol_T * T;
+
+            MarketSlice s{u, S, r, q, T, ssvi_raw(theta, rho, eta), {}, {}, {}, {}, {}};
+            const ExpiryContext ex = s.expiry();
+            const double sd = std::sqrt(theta);
+            for (std::uint32_t i = 0; i < cfg.strikes; ++i) {
+                const double z = -cfg.wing_sd + 2.0 * cfg.wing_sd * i / (cfg.strikes - 1);
+                const double k = z * sd;
+                const double K = ex.forward * std::exp(k);
+                const bool call = k >= 0.0;
+                const double iv = std::sqrt(svi::total_variance(k, s.truth) / T);
+                const double fair = bs::price(S, K, r, q, T, iv, call);
+
+                const double az = std::abs(z);
+                const double mid = fair * (1.0 + cfg.noise * (1.0 + az) * rng.normal());
+                const double hs = std::max(0.5 * cfg.tick, cfg.half_spread * fair * (1.0 + 0.5 * az));
+                double bid = std::floor(std::max(0.0, mid - hs) / cfg.tick) * cfg.tick;
+                double ask = std::max(std::ceil((mid + hs) / cfg.tick), 1.0) * cfg.tick;
+                if (rng.uniform() < cfg.crossed_fraction) {
+                    bid = ask + cfg.tick * std::ceil(rng.uniform(0.0, 5.0));
+                }
+                s.strike.push_back(K);
+                s.bid.push_back(bid);
+                s.ask.push_back(ask);
+                s.mid.push_back(0.5 * (bid + ask));
+                s.is_call.push_back(call ? 1 : 0);
+            }
+            m.slices.push_back(std::move(s));
+        }
+    }
+    return m;
+}
+
+} // namespace vol::synth
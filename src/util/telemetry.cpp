@@ -0,0 +1,191 @@
+#include "libvol/util/telemetry.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <sstream>
+
+namespace vol::telemetry {
+
+namespace {
+
+constexpr const char* COUNTER_NAMES[N_COUNTERS] = {
+    "iv_solves",
+    "iv_no_solution",
+    "iv_bracket_expansions",
+    "iv_bracket_last_resort",
+    "iv_brent_fallbacks",
+    "iv_brent_unconverged",
+    "lbfgsb_runs",
+    "lbfgsb_max_iter",
+    "lbfgsb_step_collapse",
+    "svi_fits",
+    "svi_few_points",
+    "svi_start_unconverged",
+    "svi_heuristic_fallback",
+    "svi_warm_cold_fallback",
+    "slice_quotes_rejected",
+    "slice_few_quotes",
+};
+
+constexpr const char* STAGE_NAMES[N_STAGES] = {
+    "slice_fit",
+    "pipeline_iv_batch",
+    "pipeline_fit",
+    "pipeline_publish",
+    "pipeline_tick_to_publish",
+};
+
+// Every slab ever handed out; never freed, so snapshot() and exited threads' counts stay
+// valid. std::deque keeps element addresses stable as it grows.
+struct Registry {
+    std::mutex m;
+    std::deque<detail::Slab> slabs;
+};
+
+Registry& registry() {
+    static Registry* r = new Registry;   // leaked: threads may report during static destruction
+    return *r;
+}
+
+// Returns the thread's slab to the pool when the thread exits
+struct Release {
+    detail::Slab* slab = nullptr;
+    ~Release() {
+        if (slab) slab->in_use.store(false, std::memory_order_release);
+        detail::tls_slab = nullptr;
+    }
+};
+
+std::uint64_t bucket_lower(std::size_t i) {
+    constexpr std::size_t SUB = detail::SUB_BITS;
+    if (i < (1u << SUB)) return i;
+    const std::size_t e = (i >> SUB) + SUB - 1;
+    const std::uint64_t sub = i & ((1u << SUB) - 1);
+    return ((std::uint64_t{1} << SUB) + sub) << (e - SUB);
+}
+
+std::uint64_t bucket_width(std::size_t i) {
+    constexpr std::size_t SUB = detail::SUB_BITS;
+    if (i < (1u << SUB)) return 1;
+    return std::uint64_t{1} << ((i >> SUB) - 1);
+}
+
+} // namespace
+
+namespace detail {
+
+Slab* claim_slab() {
+    thread_local Release release;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    Slab* s = nullptr;
+    for (Slab& candidate : r.slabs) {
+        if (!candidate.in_use.load(std::memory_order_acquire)) {
+            s = &candidate;
+            break;
+        }
+    }
+    if (!s) s = &r.slabs.emplace_back();
+    s->in_use.store(true, std::memory_order_relaxed);
+    release.slab = s;
+    tls_slab = s;
+    return s;
+}
+
+} // namespace detail
+
+const char* name(Counter c) {
+    return COUNTER_NAMES[static_cast<std::size_t>(c)];
+}
+
+const char* name(Stage s) {
+    return STAGE_NAMES[static_cast<std::size_t>(s)];
+}
+
+bool compiled_in() {
+#if defined(VOL_TELEMETRY)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t Histogram::percentile(double q) const {
+    if (count == 0 || buckets.empty()) return 0;
+    q = std::clamp(q, 0.0, 1.0);
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(q * static_cast<double>(count) + 0.5));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            const std::uint64_t mid = bucket_lower(i) + bucket_width(i) / 2;
+            return std::clamp(mid, min_ns, max_ns);
+        }
+    }
+    return max_ns;
+}
+
+Snapshot snapshot() {
+    Snapshot out;
+    for (Histogram& h : out.stages) {
+        h.buckets.assign(detail::N_BUCKETS, 0);
+        h.min_ns = ~0ull;
+    }
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    for (const detail::Slab& s : r.slabs) {
+        for (std::size_t c = 0; c < N_COUNTERS; ++c) out.counters[c] += s.counters[c].load(std::memory_order_relaxed);
+        for (std::size_t st = 0; st < N_STAGES; ++st) {
+            const detail::HistogramSlab& src = s.stages[st];
+            Histogram& h = out.stages[st];
+            const std::uint64_t n = src.count.load(std::memory_order_relaxed);
+            if (n == 0) continue;
+            h.count += n;
+            h.sum_ns += src.sum.load(std::memory_order_relaxed);
+            h.min_ns = std::min(h.min_ns, src.min.load(std::memory_order_relaxed));
+            h.max_ns = std::max(h.max_ns, src.max.load(std::memory_order_relaxed));
+            for (std::size_t b = 0; b < detail::N_BUCKETS; ++b) h.buckets[b] += src.buckets[b].load(std::memory_order_relaxed);
+        }
+    }
+    for (Histogram& h : out.stages) {
+        if (h.count == 0) h.min_ns = 0;
+    }
+    return out;
+}
+
+void reset() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    for (detail::Slab& s : r.slabs) {
+        for (auto& c : s.counters) c.store(0, std::memory_order_relaxed);
+        for (detail::HistogramSlab& h : s.stages) {
+            h.count.store(0, std::memory_order_relaxed);
+            h.sum.store(0, std::memory_order_relaxed);
+            h.min.store(~0ull, std::memory_order_relaxed);
+            h.max.store(0, std::memory_order_relaxed);
+            for (auto& b : h.buckets) b.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::string to_json(const Snapshot& s) {
+    std::ostringstream out;
+    out << "{\"compiled_in\": " << (compiled_in() ? "true" : "false") << ", \"counters\": {";
+    for (std::size_t c = 0; c < N_COUNTERS; ++c) {
+        out << (c ? ", " : "") << '"' << COUNTER_NAMES[c] << "\": " << s.counters[c];
+    }
+    out << "}, \"stages\": {";
+    for (std::size_t st = 0; st < N_STAGES; ++st) {
+        const Histogram& h = s.stages[st];
+        out << (st ? ", " : "") << '"' << STAGE_NAMES[st] << "\": {\"count\": " << h.count
+            << ", \"mean_ns\": " << h.mean_ns() << ", \"min_ns\": " << h.min_ns
+            << ", \"p50_ns\": " << h.percentile(0.50) << ", \"p90_ns\": " << h.percentile(0.90)
+            << ", \"p99_ns\": " << h.percentile(0.99) << ", \"p999_ns\": " << h.percentile(0.999)
+            << ", \"max_ns\": " << h.max_ns << '}';
+    }
+    out << "}}";
+    return out.str();
+}
+
+} // namespace vol::telemetry
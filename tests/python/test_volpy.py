@@ -0,0 +1,94 @@
+"""volpy batch entry points: arrays are used in place and match the scalar C++ calls.
+
+Run with the build directory on PYTHONPATH:
+    PYTHONPATH=build python -m pytest tests/python
+"""
+import math
+
+import numpy as np
+import pytest
+
+import volpy as vp
+
+
+def quotes(n, seed=7):
+    rng = np.random.default_rng(seed)
+    S = np.full(n, 100.0)
+    K = rng.uniform(70.0, 130.0, n)
+    r = np.full(n, 0.03)
+    q = np.full(n, 0.01)
+    T = rng.uniform(0.1, 2.0, n)
+    vol = rng.uniform(0.1, 0.5, n)
+    is_call = rng.random(n) < 0.5
+    return S, K, r, q, T, vol, is_call
+
+
+def test_out_buffer_is_written_in_place():
+    S, K, r, q, T, vol, is_call = quotes(1000)
+    out = np.empty_like(K)
+    res = vp.bs_price_batch(S, K, r, q, T, vol, is_call, out=out, n_threads=2)
+    assert res is out
+    assert np.shares_memory(res, out)
+
+    ivs = np.empty_like(K)
+    assert vp.implied_vol_batch(S, K, r, q, T, out, is_call, out=ivs) is ivs
+
+
+def test_inputs_that_would_need_a_copy_are_rejected():
+    S, K, r, q, T, vol, is_call = quotes(64)
+    with pytest.raises(TypeError):
+        vp.bs_price_batch(S, K.astype(np.float32), r, q, T, vol, is_call)
+    with pytest.raises(TypeError):
+        vp.bs_price_batch(S, K, r, q, T, vol, is_call, out=np.empty(128)[::2])
+    with pytest.raises(ValueError):
+        vp.bs_price_batch(S, K[:10], r, q, T, vol, is_call)
+    frozen = np.empty_like(K)
+    frozen.setflags(write=False)
+    with pytest.raises(ValueError):
+        vp.bs_price_batch(S, K, r, q, T, vol, is_call, out=frozen)
+
+
+def test_batches_match_scalar_calls():
+    S, K, r, q, T, vol, is_call = quotes(600)
+    px = vp.bs_price_batch(S, K, r, q, T, vol, is_call, n_threads=3)
+    for i in range(len(K)):
+        assert px[i] == vp.bs_price(S[i], K[i], r[i], q[i], T[i], vol[i], bool(is_call[i]))
+
+    ivs = vp.implied_vol_batch(S, K, r, q, T, px, is_call, n_threads=3)
+    for i in range(len(K)):
+        ref = vp.implied_vol(S[i], K[i], r[i], q[i], T[i], px[i], bool(is_call[i]), 0.2, 1e-10)
+        assert ivs[i] == ref.iv if ref.converged else math.isnan(ivs[i])
+
+    params = vp.HestonParams(1.5, 0.04, 0.5, -0.7, 0.04)
+    hp = vp.heston_price_cf_batch(100.0, K, 0.03, 0.01, T, params, is_call, n_threads=2)
+    for i in range(0, len(K), 37):
+        assert hp[i] == vp.heston_price_cf(100.0, K[i], 0.03, 0.01, T[i], params, bool(is_call[i]))
+
+    # American puts with r > 0 exercise early
+    n = 24
+    aK = np.linspace(80.0, 120.0, n)
+    aS, ar, aq, aT = np.full(n, 100.0), np.full(n, 0.05), np.zeros(n), np.full(n, 0.75)
+    puts = np.zeros(n, dtype=bool)
+    apx = np.array([vp.american_price(100.0, k, 0.05, 0.0, 0.75, 0.25, False, vp.AMERICAN_FAST) for k in aK])
+    aiv = vp.implied_vol_american_batch(aS, aK, ar, aq, aT, apx, puts, scheme=vp.AMERICAN_FAST, n_threads=2)
+    for i in range(n):
+        ref = vp.implied_vol_american(100.0, aK[i], 0.05, 0.0, 0.75, apx[i], False, vp.AMERICAN_FAST)
+        assert ref.converged
+        assert aiv[i] == ref.iv
+        assert abs(aiv[i] - 0.25) < 1e-6
+
+
+def test_slice_fit_from_arrays_matches_option_specs():
+    S, r, q, T = 100.0, 0.03, 0.01, 0.5
+    K = np.linspace(70.0, 130.0, 25)
+    is_call = K >= S
+    fwd = S * math.exp((r - q) * T)
+    vols = [0.2 + 0.4 * math.log(k / fwd) ** 2 - 0.05 * math.log(k / fwd) for k in K]
+    mids = np.array([vp.bs_price(S, k, r, q, T, v, bool(c)) for k, v, c in zip(K, vols, is_call)])
+
+    cfg = vp.SliceConfig()
+    from_arrays = vp.svi_calibrate_slice_from_arrays(S, K, r, q, T, is_call, mids, cfg)
+    opts = [vp.OptionSpec(S, float(k), r, q, T, bool(c)) for k, c in zip(K, is_call)]
+    from_specs = vp.svi_calibrate_slice_from_prices(opts, mids.tolist(), cfg)
+    for k in np.linspace(-0.3, 0.3, 13):
+        assert vp.svi_total_variance(k, from_arrays) == pytest.approx(vp.svi_total_variance(k, from_specs), abs=1e-9)
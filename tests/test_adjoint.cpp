@@ -0,0 +1,197 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/math/adjoint.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/heston.hpp"
+#include "libvol/models/svi.hpp"
+
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+using Catch::Approx;
+using vol::ad::Var;
+
+TEST_CASE("AD: elementary derivatives match closed forms", "[adjoint]") {
+    vol::ad::Tape tape;
+    vol::ad::Tape::Scope scope(tape);
+    const Var x = tape.variable(0.7);
+    const Var y = tape.variable(1.9);
+    const Var f = vol::ad::exp(x) * vol::ad::log(y) + vol::ad::sin(x * y) / vol::ad::sqrt(y) +
+                  vol::ad::pow(y, 2.5) - 3.0 * vol::ad::norm_cdf(x - y);
+    tape.backward(f);
+    const double xv = 0.7, yv = 1.9;
+    const double pdf = std::exp(-0.5 * (xv - yv) * (xv - yv)) / std::sqrt(2.0 * std::acos(-1.0));
+    const double dfdx = std::exp(xv) * std::log(yv) + std::cos(xv * yv) * yv / std::sqrt(yv) - 3.0 * pdf;
+    const double dfdy = std::exp(xv) / yv + std::cos(xv * yv) * xv / std::sqrt(yv) -
+                        0.5 * std::sin(xv * yv) / (yv * std::sqrt(yv)) + 2.5 * std::pow(yv, 1.5) + 3.0 * pdf;
+    REQUIRE(tape.adjoint(x) == Approx(dfdx).epsilon(1e-13));
+    REQUIRE(tape.adjoint(y) == Approx(dfdy).epsilon(1e-13));
+    // constants never reach the tape
+    REQUIRE(Var(2.0).is_constant());
+    REQUIRE(tape.adjoint(Var(2.0)) == 0.0);
+}
+
+TEST_CASE("AD: complex functions follow Cauchy-Riemann", "[adjoint]") {
+    vol::ad::Tape tape;
+    vol::ad::Tape::Scope scope(tape);
+    const Var a = tape.variable(0.4);
+    const Var b = tape.variable(-1.3);
+    const vol::ad::Complex z(a, b);
+    // w = log(sqrt(z) * exp(z) / (1 + z)); dw/dz = 1 / (2z) + 1 - 1 / (1 + z)
+    const vol::ad::Complex w = vol::ad::log(vol::ad::sqrt(z) * vol::ad::exp(z) / (vol::ad::Complex(1.0, 0.0) + z));
+    const std::complex<double> zv(0.4, -1.3);
+    const std::complex<double> dw = 1.0 / (2.0 * zv) + 1.0 - 1.0 / (1.0 + zv);
+    REQUIRE(w.value().real() == Approx(std::log(std::sqrt(zv) * std::exp(zv) / (1.0 + zv)).real()).epsilon(1e-14));
+
+    tape.backward(vol::ad::real(w));
+    REQUIRE(tape.adjoint(a) == Approx(dw.real()).epsilon(1e-13));
+    REQUIRE(tape.adjoint(b) == Approx(-dw.imag()).epsilon(1e-13));
+    tape.backward(vol::ad::imag(w));
+    REQUIRE(tape.adjoint(a) == Approx(dw.imag()).epsilon(1e-13));
+    REQUIRE(tape.adjoint(b) == Approx(dw.real()).epsilon(1e-13));
+}
+
+TEST_CASE("AD: tape is reusable without reallocating", "[adjoint]") {
+    vol::ad::Tape tape;
+    vol::ad::Tape::Scope scope(tape);
+    std::size_t bytes = 0;
+    for (int pass = 0; pass < 3; ++pass) {
+        tape.reset();
+        Var acc = tape.variable(1.0);
+        for (int i = 0; i < 40000; ++i) acc = acc * 1.0000001 + 1e-9;
+        tape.backward(acc);
+        REQUIRE(tape.statements() == 80001);
+        if (pass == 0) bytes = tape.memory_bytes();
+        REQUIRE(tape.memory_bytes() == bytes);
+    }
+    tape.reset();
+    REQUIRE(tape.statements() == 0);
+    REQUIRE(tape.memory_bytes() == bytes);
+}
+
+TEST_CASE("AD: recording without an active tape throws", "[adjoint]") {
+    vol::ad::Tape tape;
+    Var x;
+    {
+        vol::ad::Tape::Scope scope(tape);
+        x = tape.variable(2.0);
+    }
+    REQUIRE(vol::ad::Tape::active() == nullptr);
+    REQUIRE_THROWS_AS(x * 3.0, std::logic_error);
+    REQUIRE((Var(2.0) * 3.0).value() == 6.0);
+}
+
+TEST_CASE("AD: Black-Scholes adjoint matches analytic greeks", "[adjoint]") {
+    vol::ad::Tape tape;
+    vol::ad::Tape::Scope scope(tape);
+    for (bool call : {false, true}) {
+        for (double K : {80.0, 100.0, 125.0}) {
+            INFO("call=" << call << " K=" << K);
+            tape.reset();
+            const Var S = tape.variable(100.0), k = tape.variable(K), r = tape.variable(0.03);
+            const Var q = tape.variable(0.01), T = tape.variable(0.75), v = tape.variable(0.22);
+            const Var p = vol::bs::price(S, k, r, q, T, v, call);
+            tape.backward(p);
+            const auto g = vol::bs::price_greeks(100.0, K, 0.03, 0.01, 0.75, 0.22, call);
+            REQUIRE(p.value() == Approx(g.price).epsilon(1e-13));
+            REQUIRE(tape.adjoint(S) == Approx(g.delta).margin(1e-12));
+            REQUIRE(tape.adjoint(v) == Approx(g.vega).epsilon(1e-12));
+            REQUIRE(tape.adjoint(r) == Approx(g.rho).epsilon(1e-12));
+            REQUIRE(-tape.adjoint(T) == Approx(g.theta).epsilon(1e-12));
+        }
+    }
+}
+
+TEST_CASE("AD: SVI total variance gradient in the raw parameters", "[adjoint]") {
+    vol::ad::Tape tape;
+    vol::ad::Tape::Scope scope(tape);
+    const vol::svi::Params p{0.02, 0.4, -0.3, 0.05, 0.2};
+    const double k = -0.15;
+    const Var a = tape.variable(p[0]), b = tape.variable(p[1]), rho = tape.variable(p[2]);
+    const Var m = tape.variable(p[3]), sigma = tape.variable(p[4]);
+    const Var w = vol::svi::total_variance(Var(k), a, b, rho, m, sigma);
+    REQUIRE(w.value() == Approx(vol::svi::total_variance(k, p)).epsilon(1e-15));
+    tape.backward(w);
+    const double x = k - p[3];
+    const double root = std::sqrt(x * x + p[4] * p[4]);
+    REQUIRE(tape.adjoint(a) == Approx(1.0));
+    REQUIRE(tape.adjoint(b) == Approx(p[2] * x + root).epsilon(1e-14));
+    REQUIRE(tape.adjoint(rho) == Approx(p[1] * x).epsilon(1e-14));
+    REQUIRE(tape.adjoint(m) == Approx(-p[1] * (p[2] + x / root)).epsilon(1e-14));
+    REQUIRE(tape.adjoint(sigma) == Approx(p[1] * p[4] / root).epsilon(1e-14));
+}
+
+TEST_CASE("AD: Heston sensitivities match bumped prices", "[adjoint][heston]") {
+    const vol::heston::Params p{1.5, 0.04, 0.5, -0.7, 0.04};
+    const double h = 1e-5;
+    for (bool call : {false, true}) {
+        for (double K : {85.0, 105.0}) {
+            INFO("call=" << call << " K=" << K);
+            const auto s = vol::heston::price_cf_sensitivities(100.0, K, 0.03, 0.01, 0.75, p, call);
+            REQUIRE(s.price == Approx(vol::heston::price_cf(100.0, K, 0.03, 0.01, 0.75, p, call)).epsilon(1e-13));
+            auto bump = [&](int i) {
+                auto f = [&](double e) {
+                    double x[10] = {100.0, K, 0.03, 0.01, 0.75, p.kappa, p.theta, p.sigma, p.rho, p.v0};
+                    x[i] += e;
+                    return vol::heston::price_cf(x[0], x[1], x[2], x[3], x[4], {x[5], x[6], x[7], x[8], x[9]}, call);
+                };
+                return (f(h) - f(-h)) / (2.0 * h);
+            };
+            REQUIRE(s.delta == Approx(bump(0)).margin(1e-6));
+            REQUIRE(s.dK == Approx(bump(1)).margin(1e-6));
+            REQUIRE(s.rho == Approx(bump(2)).margin(1e-5));
+            REQUIRE(s.dq == Approx(bump(3)).margin(1e-5));
+            REQUIRE(s.theta == Approx(-bump(4)).margin(1e-5));
+            REQUIRE(s.d_params.kappa == Approx(bump(5)).margin(1e-5));
+            REQUIRE(s.d_params.theta == Approx(bump(6)).margin(1e-5));
+            REQUIRE(s.d_params.sigma == Approx(bump(7)).margin(1e-5));
+            REQUIRE(s.d_params.rho == Approx(bump(8)).margin(1e-5));
+            REQUIRE(s.d_params.v0 == Approx(bump(9)).margin(1e-5));
+        }
+    }
+    const auto expired = vol::heston::price_cf_sensitivities(100.0, 90.0, 0.03, 0.0, 0.0, p, true);
+    REQUIRE(expired.price == Approx(10.0));
+    REQUIRE(expired.delta == 1.0);
+    REQUIRE_THROWS_AS(vol::heston::price_cf_sensitivities(-1.0, 90.0, 0.03, 0.0, 1.0, p, true),
+                      std::invalid_argument);
+}
+
+TEST_CASE("AD: Heston calibration objective gradient is exact", "[adjoint][heston]") {
+    const vol::heston::Params truth{2.0, 0.05, 0.6, -0.6, 0.05};
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids, weights;
+    for (double T : {0.25, 1.0}) {
+        for (double K : {85.0, 100.0, 115.0}) {
+            opts.push_back({100.0, K, 0.02, 0.0, T, K >= 100.0});
+            mids.push_back(vol::heston::price_cf(100.0, K, 0.02, 0.0, T, truth, K >= 100.0));
+            weights.push_back(1.0 / T);
+        }
+    }
+    const vol::heston::Params guess{1.5, 0.04, 0.5, -0.7, 0.04};
+    vol::heston::Params grad{};
+    const double f = vol::heston::calibration_objective(opts, mids, weights, guess, &grad);
+    REQUIRE(f == Approx(vol::heston::calibration_objective(opts, mids, weights, guess)).epsilon(1e-10));
+    REQUIRE(f > 0.0);
+
+    const double h = 1e-6;
+    auto bump = [&](double vol::heston::Params::*field) {
+        vol::heston::Params up = guess, down = guess;
+        up.*field += h;
+        down.*field -= h;
+        return (vol::heston::calibration_objective(opts, mids, weights, up) -
+                vol::heston::calibration_objective(opts, mids, weights, down)) / (2.0 * h);
+    };
+    REQUIRE(grad.kappa == Approx(bump(&vol::heston::Params::kappa)).epsilon(1e-5));
+    REQUIRE(grad.theta == Approx(bump(&vol::heston::Params::theta)).epsilon(1e-5));
+    REQUIRE(grad.sigma == Approx(bump(&vol::heston::Params::sigma)).epsilon(1e-5));
+    REQUIRE(grad.rho == Approx(bump(&vol::heston::Params::rho)).epsilon(1e-5));
+    REQUIRE(grad.v0 == Approx(bump(&vol::heston::Params::v0)).epsilon(1e-5));
+
+    // at the generating parameters the gradient vanishes
+    vol::heston::calibration_objective(opts, mids, weights, truth, &grad);
+    REQUIRE(std::abs(grad.kappa) + std::abs(grad.theta) + std::abs(grad.sigma) + std::abs(grad.rho) +
+                std::abs(grad.v0) < 1e-9);
+    REQUIRE_THROWS_AS(vol::heston::calibration_objective(opts, {1.0}, weights, guess), std::invalid_argument);
+}
@@ -0,0 +1,172 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/models/american.hpp"
+#include "libvol/models/binom.hpp"
+#include "libvol/models/black_scholes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using Catch::Approx;
+
+namespace am = vol::american;
+
+TEST_CASE("American ALO: schemes converge to the high-accuracy solve", "[american]") {
+    double worst_fast = 0.0, worst_accurate = 0.0;
+    for (double T : {1.0 / 52.0, 0.25, 1.0, 3.0}) {
+        for (double vol : {0.1, 0.25, 0.6}) {
+            for (double S : {70.0, 95.0, 100.0, 120.0}) {
+                for (bool call : {false, true}) {
+                    const double r = 0.05, q = call ? 0.04 : 0.01;
+                    const double ref = am::price(S, 100.0, r, q, T, vol, call, am::HIGH);
+                    INFO("T=" << T << " vol=" << vol << " S=" << S << " call=" << call);
+                    REQUIRE(ref >= vol::bs::price(S, 100.0, r, q, T, vol, call) - 1e-10);
+                    REQUIRE(ref >= (call ? std::max(0.0, S - 100.0) : std::max(0.0, 100.0 - S)) - 1e-10);
+                    worst_fast = std::max(worst_fast, std::abs(am::price(S, 100.0, r, q, T, vol, call, am::FAST) - ref));
+                    worst_accurate = std::max(worst_accurate, std::abs(am::price(S, 100.0, r, q, T, vol, call) - ref));
+                }
+            }
+        }
+    }
+    REQUIRE(worst_fast < 3e-3);
+    REQUIRE(worst_accurate < 5e-5);
+}
+
+TEST_CASE("American ALO: agrees with the CRR tree", "[american]") {
+    struct Case { double S, K, r, q, T, vol; bool call; };
+    for (const Case& c : {Case{100, 100, 0.05, 0.0, 1.0, 0.2, false}, Case{90, 100, 0.08, 0.02, 0.5, 0.35, false},
+                          Case{110, 100, 0.02, 0.06, 2.0, 0.25, true}, Case{100, 120, 0.1, 0.0, 3.0, 0.15, false}}) {
+        const double alo = am::price(c.S, c.K, c.r, c.q, c.T, c.vol, c.call);
+        const double tree = vol::binom::price(c.S, c.K, c.r, c.q, c.T, c.vol, 4000, c.call, true);
+        REQUIRE(alo == Approx(tree).margin(2e-3));
+    }
+}
+
+TEST_CASE("American ALO: put-call symmetry and European limits", "[american]") {
+    // C(S, K, r, q) = P(K, S, q, r)
+    const double call = am::price(105.0, 100.0, 0.03, 0.07, 1.5, 0.3, true);
+    const double put = am::price(100.0, 105.0, 0.07, 0.03, 1.5, 0.3, false);
+    REQUIRE(call == Approx(put).epsilon(1e-12));
+
+    // no early exercise for calls without dividends, or puts at non-positive rates
+    REQUIRE(am::price(100.0, 95.0, 0.05, 0.0, 1.0, 0.2, true) ==
+            Approx(vol::bs::price(100.0, 95.0, 0.05, 0.0, 1.0, 0.2, true)).epsilon(1e-14));
+    REQUIRE(am::price(100.0, 95.0, -0.01, 0.0, 1.0, 0.2, false) ==
+            Approx(vol::bs::price(100.0, 95.0, -0.01, 0.0, 1.0, 0.2, false)).epsilon(1e-14));
+    REQUIRE(std::isnan(am::exercise_boundary(100.0, 0.05, 0.0, 1.0, 0.2, true, 0.5)));
+
+    // deep in the exercise region the put is worth intrinsic
+    REQUIRE(am::price(40.0, 100.0, 0.05, 0.0, 1.0, 0.2, false) == Approx(60.0).epsilon(1e-14));
+    REQUIRE(am::price(100.0, 90.0, 0.05, 0.0, 0.0, 0.2, true) == Approx(10.0));
+}
+
+TEST_CASE("American ALO: exercise boundary", "[american]") {
+    const double K = 100.0, r = 0.05, q = 0.02, T = 2.0, vol = 0.25;
+    // put boundary starts at K min(1, r / q) and falls with time to expiry
+    REQUIRE(am::exercise_boundary(K, r, q, T, vol, false, 0.0) == Approx(K));
+    double last = K;
+    for (double tau : {0.05, 0.25, 0.5, 1.0, 2.0}) {
+        const double B = am::exercise_boundary(K, r, q, T, vol, false, tau);
+        REQUIRE(B < last);
+        // exercise is optimal just below the boundary and not above it
+        REQUIRE(am::price(0.99 * B, K, r, q, tau, vol, false) == Approx(K - 0.99 * B).epsilon(1e-10));
+        REQUIRE(am::price(1.01 * B, K, r, q, tau, vol, false) > K - 1.01 * B + 1e-6);
+        last = B;
+    }
+    // calls with dividends: boundary from K max(1, r / q) upwards
+    REQUIRE(am::exercise_boundary(K, 0.05, 0.02, T, vol, true, 0.0) == Approx(K * 2.5));
+    REQUIRE(am::exercise_boundary(K, 0.05, 0.02, T, vol, true, 1.0) > K * 2.5);
+    REQUIRE(am::exercise_boundary(K, 0.02, 0.05, T, vol, true, 1.0) > K);
+}
+
+TEST_CASE("American ALO: Greeks match finite differences", "[american]") {
+    for (bool call : {false, true}) {
+        const double S = 95.0, K = 100.0, r = 0.06, q = call ? 0.08 : 0.02, T = 0.75, vol = 0.3;
+        const auto g = am::price_greeks(S, K, r, q, T, vol, call, am::HIGH);
+        auto p = [&](double s, double t) { return am::price(s, K, r, q, t, vol, call, am::HIGH); };
+        const double h = 0.01;
+        REQUIRE(g.price == Approx(p(S, T)).epsilon(1e-14));
+        REQUIRE(g.delta == Approx((p(S + h, T) - p(S - h, T)) / (2 * h)).margin(1e-6));
+        REQUIRE(g.gamma == Approx((p(S + h, T) - 2 * p(S, T) + p(S - h, T)) / (h * h)).margin(1e-4));
+        // calendar theta, as in bs::price_greeks
+        const double dt = 1e-4;
+        REQUIRE(g.theta == Approx(-(p(S, T + dt) - p(S, T - dt)) / (2 * dt)).margin(1e-4));
+        REQUIRE(g.vega > 0.0);
+        REQUIRE((call ? g.rho > 0.0 : g.rho < 0.0));
+    }
+}
+
+TEST_CASE("American ALO: invalid schemes throw", "[american]") {
+    REQUIRE_THROWS_AS(am::price(100, 100, 0.05, 0.0, 1.0, 0.2, false, am::Scheme{1, 4, 16, 32}),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(am::price(100, 100, 0.05, 0.0, 1.0, 0.2, false, am::Scheme{65, 4, 16, 32}),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(am::price_greeks(100, 100, 0.05, 0.0, 1.0, 0.2, false, am::Scheme{8, 0, 16, 32}),
+                      std::invalid_argument);
+}
+
+TEST_CASE("American IV: round trip through the ALO price", "[american][iv]") {
+    for (double T : {1.0 / 12.0, 0.5, 2.0}) {
+        for (double vol : {0.12, 0.3, 0.8}) {
+            for (double K : {80.0, 100.0, 125.0}) {
+                for (bool call : {false, true}) {
+                    const double r = 0.05, q = call ? 0.06 : 0.01;
+                    const double p = am::price(100.0, K, r, q, T, vol, call);
+                    const auto iv = am::implied_vol(100.0, K, r, q, T, p, call);
+                    INFO("T=" << T << " vol=" << vol << " K=" << K << " call=" << call);
+                    // deep ITM short-dated puts are pinned at intrinsic and carry no vol
+                    if (p <= (call ? std::max(0.0, 100.0 - K) : std::max(0.0, K - 100.0)) * (1.0 + 1e-4)) continue;
+                    // nor are far OTM ones with no time value to speak of
+                    if (vol::bs::price_greeks(100.0, K, r, q, T, vol, call).vega < 1e-2) continue;
+                    REQUIRE(iv.converged);
+                    REQUIRE(iv.iv == Approx(vol).margin(1e-7));
+                    REQUIRE(iv.newton_iters <= 8);
+                    REQUIRE(iv.brent_iters == 0);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("American IV: European regime and bounds", "[american][iv]") {
+    // no early exercise: identical to the European solver
+    const double call = vol::bs::price(100.0, 110.0, 0.03, 0.0, 1.0, 0.25, true);
+    REQUIRE(am::implied_vol(100.0, 110.0, 0.03, 0.0, 1.0, call, true).iv == Approx(0.25).margin(1e-9));
+
+    // below intrinsic or at the upper bound there is no vol
+    REQUIRE_FALSE(am::implied_vol(80.0, 100.0, 0.05, 0.0, 1.0, 19.0, false).converged);
+    REQUIRE(std::isnan(am::implied_vol(80.0, 100.0, 0.05, 0.0, 1.0, 100.0, false).iv));
+    // at intrinsic the price is flat in vol
+    const auto flat = am::implied_vol(60.0, 100.0, 0.05, 0.0, 0.5, 40.0, false);
+    REQUIRE(flat.converged);
+    REQUIRE(flat.iv == 0.0);
+}
+
+TEST_CASE("American IV: chain batch matches the scalar solver", "[american][iv]") {
+    const auto ex = vol::make_expiry(100.0, 0.04, 0.01, 0.75);
+    std::vector<double> strikes;
+    std::vector<std::uint8_t> is_call;
+    for (double K = 70.0; K <= 130.0; K += 5.0) {
+        strikes.push_back(K);
+        is_call.push_back(K >= 100.0);
+    }
+    const auto chain = vol::make_chain(ex, strikes, is_call);
+    std::vector<double> prices;
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        const double vol = 0.2 + 0.3 * std::abs(chain.k[i]);
+        prices.push_back(am::price(ex.S, chain.K[i], ex.r, ex.q, ex.T, vol, chain.is_call[i] != 0, am::FAST));
+    }
+    std::vector<vol::bs::IVResult> out(chain.size());
+    am::implied_vol(chain, prices, out, am::FAST, 4);
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        const auto ref = am::implied_vol(ex.S, chain.K[i], ex.r, ex.q, ex.T, prices[i], chain.is_call[i] != 0, am::FAST);
+        REQUIRE(out[i].converged);
+        REQUIRE(out[i].iv == ref.iv);
+        REQUIRE(out[i].iv == Approx(0.2 + 0.3 * std::abs(chain.k[i])).margin(1e-7));
+    }
+    std::vector<vol::bs::IVResult> short_out(2);
+    REQUIRE_THROWS_AS(am::implied_vol(chain, prices, short_out), std::invalid_argument);
+}
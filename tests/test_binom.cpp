@@ -3,6 +3,7 @@
 #include "libvol/models/binom.hpp"
 #include "libvol/models/black_scholes.hpp"
 #include <cmath>
+#include <stdexcept>
 
 TEST_CASE("Binomial pricing: no-dividend American call equal to euro", "[binomial]"){
     double S = 100.0, K = 100.0, r = 0.05, q = 0.0, T = 1.0, vol = 0.25;
@@ -65,3 +66,33 @@ TEST_CASE("Binomial pricing: Euro put-call parity", "[binomial]"){
 
     REQUIRE_THAT(lhs, Catch::Matchers::WithinRel(rhs, 0.01)); // 1% relative tolerance
 }
+
+TEST_CASE("Binomial pricing: tiled parallel lattice matches the serial tree", "[binomial][parallel]"){
+    const int steps = 3001;
+    // small tiles so a modest tree runs many bands, ragged last tiles and a serial tail
+    const vol::binom::LatticeConfig shapes[] = {{1, 64, 16}, {3, 100, 37}, {4, 256, 256}, {2, 500, 1000}};
+    for (bool is_call : {false, true}) {
+        for (bool is_american : {false, true}) {
+            const double q = is_call ? 0.04 : 0.0;
+            const auto serial = vol::binom::price_w_info(100.0, 105.0, 0.05, q, 1.0, 0.3, steps, is_call, is_american);
+            for (const auto& cfg : shapes) {
+                const auto tiled = vol::binom::price_w_info_parallel(100.0, 105.0, 0.05, q, 1.0, 0.3, steps, is_call, is_american, cfg);
+                REQUIRE(tiled.price == serial.price);
+                REQUIRE(tiled.early_exercise_step == serial.early_exercise_step);
+            }
+        }
+    }
+    // the American put exercises close to expiry; the European never does
+    REQUIRE(vol::binom::price_w_info_parallel(100.0, 105.0, 0.05, 0.0, 1.0, 0.3, steps, false, true, {2, 64, 16}).early_exercise_step > steps / 2);
+    REQUIRE(vol::binom::price_w_info_parallel(100.0, 105.0, 0.05, 0.0, 1.0, 0.3, steps, false, false, {2, 64, 16}).early_exercise_step == -1);
+}
+
+TEST_CASE("Binomial pricing: parallel lattice small trees and invalid tiles", "[binomial][parallel]"){
+    // too small to tile: the serial loop does everything
+    REQUIRE(vol::binom::price_parallel(100, 100, 0.02, 0.01, 1.0, 0.2, 50, false, true) ==
+            vol::binom::price(100, 100, 0.02, 0.01, 1.0, 0.2, 50, false, true));
+    REQUIRE(vol::binom::price_parallel(100, 100, 0.02, 0.01, 1.0, 0.2, 0, true, false) ==
+            vol::binom::price(100, 100, 0.02, 0.01, 1.0, 0.2, 0, true, false));
+    REQUIRE_THROWS_AS(vol::binom::price_parallel(100, 100, 0.02, 0.01, 1.0, 0.2, 500, true, false, {1, 0, 16}), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::binom::price_parallel(100, 100, 0.02, 0.01, 1.0, 0.2, 500, true, false, {1, 64, -1}), std::invalid_argument);
+}
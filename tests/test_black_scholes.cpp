@@ -1,6 +1,9 @@
 #include <catch2/catch_all.hpp>
 #include "libvol/models/black_scholes.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 
 TEST_CASE("BS price symmetry put-call parity", "[bs]"){
@@ -51,3 +54,37 @@ TEST_CASE("BS put theta vs finite diff", "[bs]") {
     REQUIRE(std::abs(g.theta - num_theta) < 1e-4);
 }
 
+
+TEST_CASE("BS ExpiryContext overloads match scalar pricing", "[bs][chain]") {
+    const double S=100, r=0.03, q=0.015, T=0.8;
+    const auto ex = vol::make_expiry(S, r, q, T);
+    const double strikes[] = {60.0, 90.0, 100.0, 115.0, 160.0};
+    const std::uint8_t calls[] = {0, 0, 1, 1, 1};
+    const auto chain = vol::make_chain(ex, strikes, calls);
+
+    std::vector<double> vols = {0.45, 0.3, 0.25, 0.22, 0.3};
+    std::vector<double> px(chain.size());
+    vol::bs::price(chain, vols, px);
+
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        const bool call = calls[i] != 0;
+        const double ref = vol::bs::price(S, strikes[i], r, q, T, vols[i], call);
+        REQUIRE(std::abs(px[i] - ref) < 1e-12 * std::max(1.0, ref));
+
+        const auto g = vol::bs::price_greeks(ex, strikes[i], chain.k[i], vols[i], call);
+        const auto g_ref = vol::bs::price_greeks(S, strikes[i], r, q, T, vols[i], call);
+        REQUIRE(std::abs(g.price - g_ref.price) < 1e-12 * std::max(1.0, ref));
+        REQUIRE(std::abs(g.delta - g_ref.delta) < 1e-12);
+        REQUIRE(std::abs(g.gamma - g_ref.gamma) < 1e-12);
+        REQUIRE(std::abs(g.vega - g_ref.vega) < 1e-10);
+        REQUIRE(std::abs(g.theta - g_ref.theta) < 1e-10);
+        REQUIRE(std::abs(g.rho - g_ref.rho) < 1e-10);
+    }
+
+    std::vector<vol::bs::IVResult> iv(chain.size());
+    vol::bs::implied_vol(chain, px, iv, 0.2, 1e-12);
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        REQUIRE(iv[i].converged);
+        REQUIRE(std::abs(iv[i].iv - vols[i]) < 1e-8);
+    }
+}
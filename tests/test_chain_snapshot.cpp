@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/io/chain_snapshot.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+struct Slice {
+    double T, forward, discount;
+    std::vector<double> strike, bid, ask, mid;
+    std::vector<std::uint8_t> is_call;
+};
+
+Slice make_slice(const vol::svi::Params& params, double S, double r, double q, double T) {
+    Slice s;
+    s.T = T;
+    s.forward = S * std::exp((r - q) * T);
+    s.discount = std::exp(-r * T);
+    const std::vector<double> k_grid = {-0.80, -0.60, -0.40, -0.20, -0.10, 0.0, 0.10, 0.20, 0.40, 0.60, 0.80};
+    for (double k : k_grid) {
+        const double K = s.forward * std::exp(k);
+        const double iv = std::sqrt(vol::svi::total_variance(k, params) / T);
+        const bool call = k >= 0.0;
+        const double px = vol::bs::price(S, K, r, q, T, iv, call);
+        s.strike.push_back(K);
+        s.mid.push_back(px);
+        s.bid.push_back(px * 0.99);
+        s.ask.push_back(px * 1.01);
+        s.is_call.push_back(call ? 1 : 0);
+    }
+    return s;
+}
+
+std::string temp_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+}
+
+TEST_CASE("Chain snapshot round-trips columns and slice metadata", "[snapshot]") {
+    const vol::svi::Params p1{0.035, 0.18, -0.35, -0.05, 0.22};
+    const vol::svi::Params p2{0.050, 0.22, -0.20, -0.02, 0.28};
+    const Slice a = make_slice(p1, 100.0, 0.01, 0.0, 0.25);
+    const Slice b = make_slice(p2, 100.0, 0.01, 0.0, 1.0);
+
+    vol::io::SnapshotWriter writer;
+    writer.add_slice(7, a.T, a.forward, a.discount, a.strike, a.bid, a.ask, a.mid, a.is_call);
+    writer.add_slice(9, b.T, b.forward, b.discount, b.strike, b.bid, b.ask, b.mid, b.is_call);
+    const std::string path = temp_path("libvol_test_snapshot.bin");
+    writer.write(path);
+
+    const auto snap = vol::io::ChainSnapshot::open(path);
+    REQUIRE(snap.version() == vol::io::SNAPSHOT_VERSION);
+    REQUIRE(snap.slices() == 2);
+    REQUIRE(snap.rows() == a.strike.size() + b.strike.size());
+
+    const auto s1 = snap.slice(1);
+    REQUIRE(s1.underlying == 9);
+    REQUIRE(s1.T == b.T);
+    REQUIRE(s1.forward == b.forward);
+    REQUIRE(s1.discount == b.discount);
+    REQUIRE(s1.strike.size() == b.strike.size());
+    for (std::size_t i = 0; i < b.strike.size(); ++i) {
+        REQUIRE(s1.strike[i] == b.strike[i]);
+        REQUIRE(s1.bid[i] == b.bid[i]);
+        REQUIRE(s1.ask[i] == b.ask[i]);
+        REQUIRE(s1.mid[i] == b.mid[i]);
+        REQUIRE(s1.is_call[i] == b.is_call[i]);
+    }
+    // spans point into the mapping, rows of slice 1 follow slice 0
+    REQUIRE(s1.strike.data() == snap.strike().data() + a.strike.size());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(snap.strike().data()) % 64 == 0);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Chain snapshot slices calibrate like OptionSpec input", "[snapshot][svi]") {
+    const vol::svi::Params truth{0.035, 0.18, -0.35, -0.05, 0.22};
+    const double S = 100.0, r = 0.02, q = 0.01, T = 0.75;
+    const Slice s = make_slice(truth, S, r, q, T);
+
+    vol::io::SnapshotWriter writer;
+    writer.add_slice(0, s.T, s.forward, s.discount, s.strike, s.bid, s.ask, s.mid, s.is_call);
+    const std::string path = temp_path("libvol_test_snapshot_calib.bin");
+    writer.write(path);
+    const auto snap = vol::io::ChainSnapshot::open(path);
+    const auto v = snap.slice(0);
+
+    const auto from_snapshot =
+        vol::svi::calibrate_slice(vol::svi::SliceQuotes{v.T, v.forward, v.discount, v.strike, v.mid, v.is_call});
+
+    std::vector<vol::OptionSpec> opts;
+    for (std::size_t i = 0; i < s.strike.size(); ++i) {
+        opts.push_back(vol::OptionSpec{S, s.strike[i], r, q, T, s.is_call[i] != 0});
+    }
+    const auto from_rows = vol::svi::calibrate_slice_from_prices(opts, s.mid);
+
+    for (double k : {-0.6, -0.2, 0.0, 0.2, 0.6}) {
+        REQUIRE_THAT(vol::svi::total_variance(k, from_snapshot),
+                     Catch::Matchers::WithinRel(vol::svi::total_variance(k, from_rows), 1e-6));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Chain snapshot rejects foreign or newer files", "[snapshot]") {
+    const std::string path = temp_path("libvol_test_snapshot_bad.bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        const std::string junk(256, 'x');
+        out.write(junk.data(), static_cast<std::streamsize>(junk.size()));
+    }
+    REQUIRE_THROWS_AS(vol::io::ChainSnapshot::open(path), std::runtime_error);
+
+    vol::io::SnapshotWriter writer;
+    const double one[] = {100.0};
+    const std::uint8_t call[] = {1};
+    writer.add_slice(0, 0.5, 100.0, 0.99, one, one, one, one, call);
+    writer.write(path);
+    {
+        // bump the version field (right after the 8-byte magic)
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint32_t future = vol::io::SNAPSHOT_VERSION + 1;
+        f.seekp(8);
+        f.write(reinterpret_cast<const char*>(&future), sizeof(future));
+    }
+    REQUIRE_THROWS_AS(vol::io::ChainSnapshot::open(path), std::runtime_error);
+    REQUIRE_THROWS_AS(vol::io::ChainSnapshot::open(temp_path("libvol_missing_snapshot.bin")), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Chain snapshot rejects counts that overflow and misaligned offsets", "[snapshot]") {
+    const std::string path = temp_path("libvol_test_snapshot_hostile.bin");
+    auto patched = [&](std::streamoff at, std::uint64_t value) {
+        vol::io::SnapshotWriter writer;
+        const double one[] = {100.0};
+        const std::uint8_t call[] = {1};
+        writer.add_slice(0, 0.5, 100.0, 0.99, one, one, one, one, call);
+        writer.write(path);
+        REQUIRE_NOTHROW(vol::io::ChainSnapshot::open(path));
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(at);
+        f.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    // header: magic, version, header_bytes, n_rows @16, n_slices @24, file_bytes, slice_offset @40
+    // 2^60 slice records of 48 bytes wrap to zero bytes in 64-bit arithmetic
+    patched(24, std::uint64_t{1} << 60);
+    REQUIRE_THROWS_AS(vol::io::ChainSnapshot::open(path), std::runtime_error);
+    patched(16, ~std::uint64_t{0});
+    REQUIRE_THROWS_AS(vol::io::ChainSnapshot::open(path), std::runtime_error);
+    patched(40, 129);
+    REQUIRE_THROWS_AS(vol::io::ChainSnapshot::open(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
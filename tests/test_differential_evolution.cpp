@@ -0,0 +1,87 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/calib/differential_evolution.hpp"
+
+#include <cmath>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Global minimum 0 at the origin, ~10^d local minima on the integer lattice
+double rastrigin(const std::vector<double>& x) {
+    double f = 10.0 * static_cast<double>(x.size());
+    for (double v : x) f += v * v - 10.0 * std::cos(2.0 * std::numbers::pi * v);
+    return f;
+}
+
+// Narrow curved valley, minimum 0 at (1, 1)
+void rosenbrock(const std::vector<double>& x, double& f, std::vector<double>& g) {
+    const double a = 1.0 - x[0], b = x[1] - x[0] * x[0];
+    f = a * a + 100.0 * b * b;
+    g = {-2.0 * a - 400.0 * x[0] * b, 200.0 * b};
+}
+
+} // namespace
+
+TEST_CASE("Differential evolution: finds the global minimum of a multimodal function", "[calib][de]") {
+    const std::vector<double> lb(4, -5.12), ub(4, 5.12);
+    vol::calib::DEConfig cfg;
+    cfg.population = 40;
+    cfg.max_generations = 1000;
+    cfg.seed = 7;
+    cfg.n_threads = 2;
+    const auto res = vol::calib::differential_evolution(lb, ub, rastrigin, cfg);
+    REQUIRE(res.converged);
+    REQUIRE(res.obj < 1e-6);
+    for (double v : res.x) REQUIRE(std::abs(v) < 1e-3);
+    REQUIRE(res.evaluations == 40LL * (res.generations + 1));
+
+    // target stops early
+    cfg.target = 1.0;
+    const auto early = vol::calib::differential_evolution(lb, ub, rastrigin, cfg);
+    REQUIRE(early.converged);
+    REQUIRE(early.obj <= 1.0);
+    REQUIRE(early.generations < res.generations);
+}
+
+TEST_CASE("Differential evolution: deterministic across thread counts, inside the bounds", "[calib][de]") {
+    const std::vector<double> lb{-2.0, 0.5}, ub{2.0, 3.0};
+    std::mutex m;
+    bool in_box = true;
+    auto f = [&](const std::vector<double>& x) {
+        double v;
+        std::vector<double> g;
+        rosenbrock(x, v, g);
+        std::lock_guard<std::mutex> lock(m);
+        in_box = in_box && x[0] >= lb[0] && x[0] <= ub[0] && x[1] >= lb[1] && x[1] <= ub[1];
+        return v;
+    };
+    vol::calib::DEConfig cfg;
+    cfg.max_generations = 60;
+    cfg.n_threads = 1;
+    const auto serial = vol::calib::differential_evolution(lb, ub, f, rosenbrock, cfg);
+    cfg.n_threads = 4;
+    const auto threaded = vol::calib::differential_evolution(lb, ub, f, rosenbrock, cfg);
+    REQUIRE(in_box);
+    REQUIRE(serial.x == threaded.x);
+    REQUIRE(serial.obj == threaded.obj);
+    REQUIRE(serial.generations == threaded.generations);
+
+    // the short global stage leaves the valley floor to lbfgsb
+    cfg.polish = 0;
+    const auto global_only = vol::calib::differential_evolution(lb, ub, f, rosenbrock, cfg);
+    REQUIRE(threaded.obj <= global_only.obj);
+    REQUIRE(threaded.polished == (threaded.obj < global_only.obj));
+    REQUIRE(threaded.x[0] == Catch::Approx(1.0).margin(0.05));
+}
+
+TEST_CASE("Differential evolution: invalid bounds throw", "[calib][de]") {
+    auto f = [](const std::vector<double>& x) { return x[0] * x[0]; };
+    REQUIRE_THROWS_AS(vol::calib::differential_evolution({}, {}, f), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::calib::differential_evolution({0.0}, {0.0, 1.0}, f), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::calib::differential_evolution({1.0}, {0.0}, f), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::calib::differential_evolution({-INFINITY}, {1.0}, f), std::invalid_argument);
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/models/american.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/fd.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using Catch::Approx;
+
+TEST_CASE("FD: European prices and greeks match Black-Scholes", "[fd]") {
+    for (bool call : {false, true}) {
+        for (double K : {80.0, 100.0, 120.0}) {
+            INFO("call=" << call << " K=" << K);
+            const auto fd = vol::fd::price_greeks(100.0, K, 0.05, 0.02, 1.0, 0.25, call, false);
+            const auto bs = vol::bs::price_greeks(100.0, K, 0.05, 0.02, 1.0, 0.25, call);
+            REQUIRE(fd.price == Approx(bs.price).margin(2e-3));
+            REQUIRE(fd.delta == Approx(bs.delta).margin(1e-4));
+            REQUIRE(fd.gamma == Approx(bs.gamma).margin(3e-4));
+            // the bumped solves share the base grid, so vega carries no grid-change noise
+            REQUIRE(fd.vega == Approx(bs.vega).margin(1e-2));
+            REQUIRE(fd.theta == Approx(bs.theta).margin(2e-3));
+            REQUIRE(fd.rho == Approx(bs.rho).margin(1e-2));
+        }
+    }
+}
+
+TEST_CASE("FD: second-order convergence under grid refinement", "[fd]") {
+    const double ref = vol::bs::price(100.0, 100.0, 0.05, 0.02, 1.0, 0.25, false);
+    double prev = 0.0;
+    for (int n : {100, 200, 400}) {
+        vol::fd::Config cfg;
+        cfg.space_steps = n;
+        cfg.time_steps = n / 2;
+        const double err = std::abs(vol::fd::price(100.0, 100.0, 0.05, 0.02, 1.0, 0.25, false, false, cfg) - ref);
+        if (prev > 0.0) REQUIRE(err < 0.4 * prev);
+        prev = err;
+    }
+    REQUIRE(prev < 5e-4);
+}
+
+TEST_CASE("FD: American prices match ALO, Brennan-Schwartz and PSOR agree", "[fd]") {
+    vol::fd::Config psor;
+    psor.american = vol::fd::AmericanSolver::PSOR;
+    for (bool call : {false, true}) {
+        for (double K : {80.0, 100.0, 120.0}) {
+            INFO("call=" << call << " K=" << K);
+            const double q = call ? 0.06 : 0.02;
+            const double bs = vol::fd::price(100.0, K, 0.05, q, 1.0, 0.25, call, true);
+            const double ref = vol::american::price(100.0, K, 0.05, q, 1.0, 0.25, call, vol::american::HIGH);
+            REQUIRE(bs == Approx(ref).margin(3e-3));
+            REQUIRE(vol::fd::price(100.0, K, 0.05, q, 1.0, 0.25, call, true, psor) == Approx(bs).margin(1e-6));
+        }
+    }
+    // no dividends: the American call is never exercised early
+    REQUIRE(vol::fd::price(100.0, 100.0, 0.05, 0.0, 1.0, 0.25, true, true) ==
+            Approx(vol::fd::price(100.0, 100.0, 0.05, 0.0, 1.0, 0.25, true, false)).margin(1e-10));
+}
+
+TEST_CASE("FD: batch across strikes matches single solves", "[fd]") {
+    std::vector<double> K, vols;
+    std::vector<std::uint8_t> is_call;
+    for (int i = 0; i < 12; ++i) {
+        K.push_back(70.0 + 5.0 * i);
+        vols.push_back(0.3 - 0.01 * i);
+        is_call.push_back(K.back() >= 100.0);
+    }
+    for (bool american : {false, true}) {
+        std::vector<vol::fd::PriceGreeks> out(K.size());
+        vol::fd::price_greeks_batch(100.0, 0.05, 0.02, 0.5, K, vols, is_call, american, out);
+        for (std::size_t i = 0; i < K.size(); ++i) {
+            INFO("american=" << american << " K=" << K[i]);
+            const auto one = vol::fd::price_greeks(100.0, K[i], 0.05, 0.02, 0.5, vols[i], is_call[i] != 0, american);
+            // the batch grid spans every strike, so agreement is to discretisation error
+            REQUIRE(out[i].price == Approx(one.price).margin(3e-3));
+            REQUIRE(out[i].delta == Approx(one.delta).margin(5e-4));
+            REQUIRE(out[i].vega == Approx(one.vega).margin(0.05));
+        }
+    }
+}
+
+TEST_CASE("FD: flat local vol reproduces the constant-vol solve", "[fd]") {
+    const vol::fd::LocalVol flat = [](double, double) { return 0.25; };
+    for (bool american : {false, true}) {
+        const auto lv = vol::fd::price_greeks(100.0, 95.0, 0.05, 0.02, 1.0, flat, false, american);
+        const auto cv = vol::fd::price_greeks(100.0, 95.0, 0.05, 0.02, 1.0, 0.25, false, american);
+        REQUIRE(lv.price == Approx(cv.price).margin(1e-12));
+        REQUIRE(lv.delta == Approx(cv.delta).margin(1e-12));
+        REQUIRE(lv.vega == Approx(cv.vega).margin(1e-6));
+    }
+    // a skewed surface moves the put price in the direction of the extra downside vol
+    const vol::fd::LocalVol skew = [](double S, double) { return 0.25 + 0.2 * std::log(100.0 / S); };
+    REQUIRE(vol::fd::price_greeks(100.0, 80.0, 0.05, 0.02, 1.0, skew, false, false).price >
+            vol::fd::price(100.0, 80.0, 0.05, 0.02, 1.0, 0.25, false, false));
+}
+
+TEST_CASE("FD: invalid inputs throw", "[fd]") {
+    REQUIRE_THROWS_AS(vol::fd::price(0.0, 100.0, 0.05, 0.0, 1.0, 0.2, false, false), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::fd::price(100.0, 100.0, 0.05, 0.0, 0.0, 0.2, false, false), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::fd::price(100.0, 100.0, 0.05, 0.0, 1.0, -0.2, false, false), std::invalid_argument);
+    vol::fd::Config tiny;
+    tiny.space_steps = 2;
+    REQUIRE_THROWS_AS(vol::fd::price(100.0, 100.0, 0.05, 0.0, 1.0, 0.2, false, false, tiny), std::invalid_argument);
+    std::vector<double> K{100.0}, vols{0.2, 0.3};
+    std::vector<std::uint8_t> is_call{0};
+    std::vector<vol::fd::PriceGreeks> out(1);
+    REQUIRE_THROWS_AS(vol::fd::price_greeks_batch(100.0, 0.05, 0.0, 1.0, K, vols, is_call, false, out),
+                      std::invalid_argument);
+}
@@ -1,8 +1,12 @@
 #include <catch2/catch_all.hpp>
 
 #include "libvol/models/heston.hpp"
+#include "libvol/models/heston_cf.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <complex>
+#include <vector>
 
 using Catch::Approx;
 
@@ -31,3 +35,102 @@ TEST_CASE("Heston Gauss-Laguerre order convergence", "[heston]") {
     const double price96 = vol::heston::price_cf(100.0, 80.0, 0.03, 0.0, 0.75, params, true, 96);
     REQUIRE(price32 == Approx(price96).margin(5e-5));
 }
+
+TEST_CASE("Heston adaptive integration matches reference value", "[heston]") {
+    const vol::heston::Params params{1.5, 0.04, 0.5, -0.7, 0.04};
+    vol::heston::AdaptiveConfig cfg;
+    cfg.tol = 1e-9;
+    const auto res = vol::heston::price_cf_adaptive(100.0, 100.0, 0.01, 0.0, 1.0, params, true, cfg);
+    REQUIRE(res.price == Approx(7.601755381347978).margin(1e-7));
+    REQUIRE(res.error_estimate <= cfg.tol);
+    REQUIRE(res.nodes > 0);
+}
+
+TEST_CASE("Heston adaptive integration uses fewer nodes than fixed order", "[heston]") {
+    const vol::heston::Params params{2.0, 0.07, 0.4, -0.5, 0.05};
+    const double strikes[] = {80.0, 90.0, 100.0, 110.0, 120.0};
+    for (double K : strikes) {
+        const auto res = vol::heston::price_cf_adaptive(100.0, K, 0.015, 0.01, 0.5, params, false);
+        const double ref = vol::heston::price_cf(100.0, K, 0.015, 0.01, 0.5, params, false, 128);
+        INFO("K=" << K << " nodes=" << res.nodes << " err_est=" << res.error_estimate);
+        REQUIRE(res.nodes < 64);
+        REQUIRE(std::abs(res.price - ref) < 1e-6);
+    }
+}
+
+TEST_CASE("Heston damped contour pricer matches reference value", "[heston]") {
+    const vol::heston::Params params{1.5, 0.04, 0.5, -0.7, 0.04};
+    const double price = vol::heston::price_cf_damped(100.0, 100.0, 0.01, 0.0, 1.0, params, true);
+    REQUIRE(price == Approx(7.601755381347978).margin(1e-7));
+}
+
+TEST_CASE("Heston damped contour pricer beats GL64 on short-dated deep-OTM calls", "[heston]") {
+    // Calm parameters, 1W..3M, strikes far enough out that prices span 1e-3..1e-16: the
+    // real-axis P1/P2 integrand oscillates too fast there for 64 Laguerre nodes.
+    const vol::heston::Params params{1.5, 0.04, 0.5, -0.7, 0.04};
+    vol::heston::AdaptiveConfig cfg;
+    cfg.tol = 1e-13;
+    cfg.max_nodes = 8193;
+    struct Quote { double K, T; };
+    const Quote quotes[] = {{107.5, 1.0 / 52.0}, {113.9, 1.0 / 52.0}, {121.2, 1.0 / 52.0},
+                            {116.4, 1.0 / 12.0}, {131.2, 1.0 / 12.0}, {149.2, 1.0 / 12.0},
+                            {130.0, 0.25},       {160.0, 0.25},       {200.0, 0.25}};
+    double worst_damped = 0.0;
+    double worst_gl = 0.0;
+    for (const auto& qt : quotes) {
+        const double ref = vol::heston::price_cf_adaptive(100.0, qt.K, 0.01, 0.0, qt.T, params, true, cfg).price;
+        const double damped = vol::heston::price_cf_damped(100.0, qt.K, 0.01, 0.0, qt.T, params, true);
+        const double gl = vol::heston::price_cf(100.0, qt.K, 0.01, 0.0, qt.T, params, true, 64);
+        INFO("K=" << qt.K << " T=" << qt.T << " ref=" << ref);
+        REQUIRE(std::abs(damped - ref) < 1e-9);
+        worst_damped = std::max(worst_damped, std::abs(damped - ref));
+        worst_gl = std::max(worst_gl, std::abs(gl - ref));
+    }
+    REQUIRE(worst_damped * 100.0 < worst_gl);
+}
+
+TEST_CASE("Heston damped contour pricer agrees across strikes and satisfies parity", "[heston]") {
+    const double S = 100.0;
+    const double r = 0.015;
+    const double q = 0.01;
+    const double T = 0.5;
+    const vol::heston::Params params{2.0, 0.07, 0.4, -0.5, 0.05};
+    vol::heston::AdaptiveConfig cfg;
+    cfg.tol = 1e-11;
+    cfg.max_nodes = 4097;
+    const double strikes[] = {50.0, 70.0, 90.0, 100.0, 110.0, 130.0, 180.0};
+    for (double K : strikes) {
+        const double call = vol::heston::price_cf_damped(S, K, r, q, T, params, true);
+        const double put = vol::heston::price_cf_damped(S, K, r, q, T, params, false);
+        const double ref = vol::heston::price_cf_adaptive(S, K, r, q, T, params, true, cfg).price;
+        INFO("K=" << K);
+        REQUIRE(std::abs(call - ref) < 1e-6);
+        const double parity = call - put - (S * std::exp(-q * T) - K * std::exp(-r * T));
+        REQUIRE(std::abs(parity) < 1e-6);
+    }
+}
+
+TEST_CASE("Heston batch CF satisfies normalisation, martingale and conjugate symmetry", "[heston]") {
+    const vol::heston::Params params{2.0, 0.09, 0.5, -0.7, 0.09};
+    const double logS = std::log(100.0);
+    const double drift = 0.02 * 1.5;
+    const double T = 1.5;
+    // u = 0, u = -i, then +/- pairs along the real axis and a damped contour
+    const std::vector<double> u_re = {0.0, 0.0, 0.7, -0.7, 12.0, -12.0, 3.0, -3.0};
+    const std::vector<double> u_im = {0.0, -1.0, 0.0, 0.0, 0.0, 0.0, -2.5, -2.5};
+    std::vector<double> re(u_re.size());
+    std::vector<double> im(u_re.size());
+    vol::heston::characteristic_batch(u_re.data(), u_im.data(), u_re.size(), logS, drift, T, params,
+                                      re.data(), im.data());
+    REQUIRE(re[0] == Approx(1.0).margin(1e-14));
+    REQUIRE(im[0] == Approx(0.0).margin(1e-14));
+    REQUIRE(re[1] == Approx(std::exp(logS + drift)).epsilon(1e-12));
+    REQUIRE(im[1] == Approx(0.0).margin(1e-10));
+    // phi(-conj(u)) = conj(phi(u))
+    for (std::size_t j = 2; j < u_re.size(); j += 2) {
+        INFO("u=" << u_re[j] << "+" << u_im[j] << "i");
+        REQUIRE(re[j] == Approx(re[j + 1]).margin(1e-13));
+        REQUIRE(im[j] == Approx(-im[j + 1]).margin(1e-13));
+        REQUIRE(std::isfinite(re[j]));
+    }
+}
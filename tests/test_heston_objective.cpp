@@ -0,0 +1,100 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/models/heston_objective.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+const vol::heston::Params TRUTH{1.5, 0.04, 0.5, -0.7, 0.04};
+
+// 4 maturities x 9 strikes, calls and puts, two spots, plus an expired quote
+struct Quotes {
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids, weights;
+};
+
+Quotes make_quotes() {
+    Quotes q;
+    for (double S : {100.0, 95.0}) {
+        for (double T : {0.1, 0.5, 1.0, 2.0}) {
+            for (double K = 80.0; K <= 120.0; K += 5.0) {
+                const bool call = K >= S;
+                q.opts.push_back({S, K, 0.02, 0.01, T, call});
+                q.mids.push_back(vol::heston::price_cf(S, K, 0.02, 0.01, T, TRUTH, call) * (1.0 + 0.01 * (K - S) / S));
+                q.weights.push_back(1.0 + 0.1 * T);
+            }
+        }
+    }
+    q.opts.push_back({100.0, 90.0, 0.02, 0.01, 0.0, true});
+    q.mids.push_back(10.5);
+    q.weights.push_back(1.0);
+    return q;
+}
+
+} // namespace
+
+TEST_CASE("Heston parallel objective: prices match price_cf", "[heston][objective]") {
+    const Quotes q = make_quotes();
+    vol::heston::ParallelObjective obj(q.opts, q.mids, q.weights, 3);
+    REQUIRE(obj.quotes() == q.opts.size());
+    REQUIRE(obj.maturities() == 9);
+    REQUIRE(obj.threads() == 3);
+
+    const vol::heston::Params p{2.0, 0.05, 0.6, -0.6, 0.05};
+    std::vector<double> px(q.opts.size());
+    obj.prices(p, px);
+    for (std::size_t i = 0; i < q.opts.size(); ++i) {
+        const auto& o = q.opts[i];
+        const double ref = vol::heston::price_cf(o.S, o.K, o.r, o.q, o.T, p, o.is_call);
+        REQUIRE(px[i] == Catch::Approx(ref).epsilon(1e-10).margin(1e-12));
+    }
+    REQUIRE(px.back() == 10.0);
+}
+
+TEST_CASE("Heston parallel objective: matches calibration_objective for any thread count", "[heston][objective]") {
+    const Quotes q = make_quotes();
+    const vol::heston::Params p{2.0, 0.05, 0.6, -0.6, 0.05};
+    vol::heston::Params g_ref{};
+    const double f_ref = vol::heston::calibration_objective(q.opts, q.mids, q.weights, p, &g_ref);
+
+    double f_first = 0.0;
+    vol::heston::Params g_first{};
+    for (int threads : {1, 2, 5, 8}) {
+        vol::heston::ParallelObjective obj(q.opts, q.mids, q.weights, threads);
+        vol::heston::Params g{};
+        const double f = obj(p, &g);
+        REQUIRE(f == Catch::Approx(f_ref).epsilon(1e-10));
+        REQUIRE(g.kappa == Catch::Approx(g_ref.kappa).epsilon(1e-8));
+        REQUIRE(g.theta == Catch::Approx(g_ref.theta).epsilon(1e-8));
+        REQUIRE(g.sigma == Catch::Approx(g_ref.sigma).epsilon(1e-8));
+        REQUIRE(g.rho == Catch::Approx(g_ref.rho).epsilon(1e-8));
+        REQUIRE(g.v0 == Catch::Approx(g_ref.v0).epsilon(1e-8));
+        // one CF path for the value: asking for the gradient does not move f
+        REQUIRE(obj(p) == f);
+        if (threads == 1) {
+            f_first = f;
+            g_first = g;
+        }
+        // deterministic reduction: bit-identical across thread counts and repeated calls
+        REQUIRE(f == f_first);
+        REQUIRE(g.kappa == g_first.kappa);
+        REQUIRE(g.rho == g_first.rho);
+        REQUIRE(obj(p, &g) == f);
+    }
+}
+
+TEST_CASE("Heston parallel objective: invalid input throws", "[heston][objective]") {
+    const Quotes q = make_quotes();
+    REQUIRE_THROWS_AS(vol::heston::ParallelObjective(q.opts, {1.0}), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::heston::ParallelObjective(q.opts, q.mids, {1.0}), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::heston::ParallelObjective(q.opts, q.mids, {}, 2, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::heston::ParallelObjective({{100.0, -1.0, 0.0, 0.0, 1.0, true}}, {1.0}),
+                      std::invalid_argument);
+    vol::heston::ParallelObjective obj(q.opts, q.mids, {}, 4);
+    REQUIRE_THROWS_AS(obj({1.0, 0.04, 0.0, -0.5, 0.04}), std::invalid_argument);
+    std::vector<double> short_out(3);
+    REQUIRE_THROWS_AS(obj.prices(TRUTH, short_out), std::invalid_argument);
+    REQUIRE(obj(TRUTH) > 0.0);   // still usable after a failed call
+}
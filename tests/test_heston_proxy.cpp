@@ -0,0 +1,158 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/models/heston_proxy.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using vol::heston::ChebyshevProxy;
+using vol::heston::ProxyConfig;
+using vol::heston::ProxyDim;
+
+namespace {
+
+const vol::heston::Params PARAMS{1.5, 0.04, 0.5, -0.7, 0.04};
+
+// (K/S, T) plus sigma and rho: 3456 nodes
+ProxyConfig surface_config() {
+    ProxyConfig cfg;
+    cfg.axes = {{ProxyDim::Moneyness, 0.8, 1.2, 12},
+                {ProxyDim::T, 0.5, 1.5, 8},
+                {ProxyDim::Sigma, 0.3, 0.7, 6},
+                {ProxyDim::Rho, -0.9, -0.5, 6}};
+    cfg.params = PARAMS;
+    cfg.r = 0.01;
+    cfg.check_points = 200;
+    return cfg;
+}
+
+} // namespace
+
+TEST_CASE("Heston proxy: interpolates price_cf inside its box", "[heston][proxy]") {
+    const auto proxy = ChebyshevProxy::build(surface_config());
+    REQUIRE(proxy.nodes() == 12 * 8 * 6 * 6);
+    REQUIRE(proxy.max_abs_error() < 1e-4);
+    REQUIRE(proxy.rms_error() <= proxy.max_abs_error());
+    REQUIRE(proxy.error_bound() >= proxy.max_abs_error());
+    REQUIRE(proxy.check(100, 7).max_abs_error <= 2.0 * proxy.error_bound());
+
+    // spot enters through K/S only
+    auto p = PARAMS;
+    p.sigma = 0.45;
+    p.rho = -0.62;
+    for (double S : {50.0, 100.0, 250.0}) {
+        for (double m : {0.85, 1.0, 1.13}) {
+            const double exact = vol::heston::price_cf(S, m * S, 0.01, 0.0, 0.9, p, true, 128);
+            REQUIRE(proxy.price(S, m * S, 0.9, p) == Catch::Approx(exact).margin(S * proxy.error_bound()));
+        }
+    }
+
+    // off the box or off a pinned input: exact pricer
+    REQUIRE(!proxy.contains(1.3, 0.9, p));
+    REQUIRE(proxy.price(100.0, 130.0, 0.9, p) == vol::heston::price_cf(100.0, 130.0, 0.01, 0.0, 0.9, p, true, 128));
+    auto other = p;
+    other.kappa = 2.0;
+    REQUIRE(!proxy.contains(1.0, 0.9, other));
+    REQUIRE(proxy.price(100.0, 100.0, 0.9, other) ==
+            vol::heston::price_cf(100.0, 100.0, 0.01, 0.0, 0.9, other, true, 128));
+}
+
+TEST_CASE("Heston proxy: bound tensor, gradient and calibration objective", "[heston][proxy]") {
+    const auto proxy = ChebyshevProxy::build(surface_config());
+    auto p = PARAMS;
+    p.sigma = 0.55;
+    p.rho = -0.75;
+
+    ChebyshevProxy grad[5];
+    const auto bound = proxy.bind(p, grad);
+    REQUIRE(bound.nodes() == 12 * 8);
+    REQUIRE(bound.price(100.0, 95.0, 1.2, p) == Catch::Approx(proxy.price(100.0, 95.0, 1.2, p)).epsilon(1e-12));
+
+    // derivative tensors against central differences of the interpolant
+    const double h = 1e-5;
+    auto up = p, dn = p;
+    up.sigma += h;
+    dn.sigma -= h;
+    const double fd_sigma = (proxy.price(100.0, 95.0, 1.2, up) - proxy.price(100.0, 95.0, 1.2, dn)) / (2 * h);
+    REQUIRE(grad[2].price(100.0, 95.0, 1.2, p) == Catch::Approx(fd_sigma).epsilon(1e-6));
+    REQUIRE(grad[0].price(100.0, 95.0, 1.2, p) == 0.0);   // kappa is pinned
+
+    // objective and gradient against the exact pricer on a 3 x 5 strip, at the true parameters
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+    for (double T : {0.6, 1.0, 1.4}) {
+        for (double K : {85.0, 95.0, 100.0, 105.0, 115.0}) {
+            opts.push_back({100.0, K, 0.01, 0.0, T, true});
+            mids.push_back(vol::heston::price_cf(100.0, K, 0.01, 0.0, T, p, true, 128));
+        }
+    }
+    auto start = p;
+    start.sigma = 0.4;
+    start.rho = -0.6;
+    vol::heston::Params g_proxy{}, g_exact{};
+    const double f_proxy = vol::heston::calibration_objective(proxy, opts, mids, {}, start, &g_proxy);
+    const double f_exact = vol::heston::calibration_objective(opts, mids, {}, start, &g_exact, 128);
+    REQUIRE(f_proxy == Catch::Approx(f_exact).epsilon(1e-2));
+    REQUIRE(g_proxy.sigma == Catch::Approx(g_exact.sigma).epsilon(2e-2));
+    REQUIRE(g_proxy.rho == Catch::Approx(g_exact.rho).epsilon(2e-2));
+    REQUIRE(g_proxy.kappa == 0.0);
+    // at the truth only the interpolation error is left: 100 x error_bound per quote at S = 100
+    const double floor = 0.5 * static_cast<double>(opts.size()) * std::pow(100.0 * proxy.error_bound(), 2);
+    REQUIRE(vol::heston::calibration_objective(proxy, opts, mids, {}, p) < floor);
+
+    // past the sigma edge (0.7) the objective is that of the clamped point, with no sigma slope
+    auto outside = start;
+    outside.sigma = 0.9;
+    auto edge = start;
+    edge.sigma = 0.7;
+    vol::heston::Params g_out{}, g_edge{};
+    const double f_out = vol::heston::calibration_objective(proxy, opts, mids, {}, outside, &g_out);
+    REQUIRE(f_out == vol::heston::calibration_objective(proxy, opts, mids, {}, edge, &g_edge));
+    REQUIRE(g_out.sigma == 0.0);
+    REQUIRE(g_edge.sigma != 0.0);
+    REQUIRE(g_out.rho == g_edge.rho);
+    // a quote off the (K/S, T) box cannot be priced consistently: rejected up front
+    opts.push_back({100.0, 130.0, 0.01, 0.0, 1.0, true});
+    mids.push_back(1.0);
+    REQUIRE_THROWS_AS(vol::heston::calibration_objective(proxy, opts, mids, {}, start), std::invalid_argument);
+}
+
+TEST_CASE("Heston proxy: file round-trip and invalid input", "[heston][proxy]") {
+    ProxyConfig cfg;
+    cfg.axes = {{ProxyDim::Moneyness, 0.9, 1.1, 10}, {ProxyDim::V0, 0.02, 0.06, 6}};
+    cfg.T = 0.5;
+    cfg.check_points = 50;
+    const auto proxy = ChebyshevProxy::build(cfg);
+    const std::string path = "test_heston_proxy.bin";
+    proxy.save(path);
+    const auto loaded = ChebyshevProxy::load(path);
+    REQUIRE(loaded.nodes() == proxy.nodes());
+    REQUIRE(loaded.max_abs_error() == proxy.max_abs_error());
+    REQUIRE(loaded.config().T == 0.5);
+    auto p = cfg.params;
+    p.v0 = 0.033;
+    REQUIRE(loaded.price(100.0, 104.0, 0.5, p) == proxy.price(100.0, 104.0, 0.5, p));
+
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(-3, std::ios::end);
+        f.put('\x7f');
+    }
+    REQUIRE_THROWS_AS(ChebyshevProxy::load(path), std::runtime_error);
+    std::remove(path.c_str());
+    REQUIRE_THROWS_AS(ChebyshevProxy::load(path), std::runtime_error);
+
+    auto bad = cfg;
+    bad.axes.push_back({ProxyDim::Moneyness, 0.9, 1.1, 4});
+    REQUIRE_THROWS_AS(ChebyshevProxy::build(bad), std::invalid_argument);
+    bad = cfg;
+    bad.axes[1] = {ProxyDim::Sigma, 0.0, 0.5, 4};
+    REQUIRE_THROWS_AS(ChebyshevProxy::build(bad), std::invalid_argument);
+    bad = cfg;
+    bad.axes[0].nodes = 1;
+    REQUIRE_THROWS_AS(ChebyshevProxy::build(bad), std::invalid_argument);
+}
@@ -0,0 +1,39 @@
+#include <catch2/catch_all.hpp>
+#include "libvol/util/parallel.hpp"
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("ThreadPool runs every task once across repeated runs","[parallel]"){
+    vol::util::ThreadPool pool(3);
+    REQUIRE(pool.size() == 3);
+    std::vector<int> hits(1000, 0);
+    for (int run = 0; run < 50; ++run) {
+        pool.run(hits.size(), [&](std::size_t i) { ++hits[i]; });
+    }
+    for (int h : hits) REQUIRE(h == 50);
+
+    std::vector<std::atomic<int>> used(3);
+    pool.run_workers(300, [&](std::size_t, int w) { used[static_cast<std::size_t>(w)].fetch_add(1); });
+    int total = 0;
+    for (auto& u : used) total += u.load();
+    REQUIRE(total == 300);
+
+    std::vector<double> out(1001, 0.0);
+    vol::util::parallel_for(out.size(), 4, 64, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) out[i] = static_cast<double>(i);
+    });
+    REQUIRE(std::accumulate(out.begin(), out.end(), 0.0) == 1000.0 * 1001.0 / 2.0);
+}
+
+TEST_CASE("ThreadPool rethrows a task's exception and stays usable","[parallel]"){
+    vol::util::ThreadPool pool(4);
+    REQUIRE_THROWS_AS(pool.run(100, [](std::size_t i) { if (i == 37) throw std::runtime_error("task"); }),
+                      std::runtime_error);
+    std::atomic<int> n{0};
+    pool.run(100, [&](std::size_t) { n.fetch_add(1); });
+    REQUIRE(n.load() == 100);
+    vol::util::ThreadPool inline_pool(1);
+    REQUIRE_THROWS_AS(inline_pool.run(2, [](std::size_t) { throw std::invalid_argument("x"); }), std::invalid_argument);
+}
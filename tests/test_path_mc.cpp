@@ -0,0 +1,80 @@
+#include <catch2/catch_all.hpp>
+#include "libvol/mc/path_mc.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include <cmath>
+#include <vector>
+
+using vol::mc::Barrier;
+using vol::mc::Monitoring;
+
+TEST_CASE("Path MC continuous barrier with Brownian-bridge correction on a coarse grid","[path_mc][barrier]"){
+    const double S=100,K=100,r=0.03,q=0.01,T=1,vol=0.25,B=90;
+    // down-and-in call for B <= K: (B / S)^(2 lambda - 2) times the call struck on the reflected spot
+    const double lam = (r - q + 0.5 * vol * vol) / (vol * vol);
+    const double vanilla = vol::bs::price(S,K,r,q,T,vol,true);
+    const double di = std::pow(B / S, 2.0 * lam - 2.0) * vol::bs::price(B * B / S,K,r,q,T,vol,true);
+
+    const std::vector<vol::mc::PathPayoff> book{
+        vol::mc::barrier(K,true,B,Barrier::DownOut),
+        vol::mc::barrier(K,true,B,Barrier::DownIn),
+        vol::mc::barrier(K,true,B,Barrier::DownOut,Monitoring::Discrete)};
+    vol::mc::PathMCConfig cfg;
+    cfg.steps = 4;
+    cfg.paths = 200000;
+    const auto res = vol::mc::path_mc(vol::mc::gbm_exact(S,r,q,vol), book, T, cfg);
+    REQUIRE(res.size() == 3);
+    // the bridge is exact between GBM grid points, so four steps carry no monitoring bias
+    REQUIRE(std::abs(res[0].price - (vanilla - di)) < 4.0 * res[0].std_err);
+    REQUIRE(std::abs(res[1].price - di) < 4.0 * res[1].std_err);
+    // checking only the four grid dates misses most crossings
+    REQUIRE(res[2].price - (vanilla - di) > 20.0 * res[2].std_err);
+}
+
+TEST_CASE("Path MC geometric Asian control variate and thread independence","[path_mc][asian]"){
+    const double S=100,K=100,r=0.03,q=0.01,T=1,vol=0.25;
+    const int steps = 12;
+    const auto model = vol::mc::gbm_exact(S,r,q,vol);
+    const std::vector<vol::mc::PathPayoff> book{
+        vol::mc::asian_arithmetic(K,true,Monitoring::Discrete),
+        vol::mc::asian_geometric(K,true,Monitoring::Discrete),
+        vol::mc::asian_geometric(K,false),
+        vol::mc::lookback_floating(true)};
+    vol::mc::PathMCConfig cfg;
+    cfg.steps = steps;
+    cfg.paths = 100000;
+    const auto plain = vol::mc::path_mc(model, book, T, cfg);
+    REQUIRE(std::abs(plain[1].price - vol::mc::asian_geometric_gbm(S,K,r,q,T,vol,steps,true,Monitoring::Discrete))
+            < 4.0 * plain[1].std_err);
+    REQUIRE(std::abs(plain[2].price - vol::mc::asian_geometric_gbm(S,K,r,q,T,vol,steps,false))
+            < 4.0 * plain[2].std_err);
+
+    cfg.control = vol::mc::asian_geometric(K,true,Monitoring::Discrete);
+    cfg.control_price = vol::mc::asian_geometric_gbm(S,K,r,q,T,vol,steps,true,Monitoring::Discrete);
+    cfg.n_threads = 1;
+    const auto cv = vol::mc::path_mc(model, book, T, cfg);
+    REQUIRE(std::abs(cv[0].price - plain[0].price) < 4.0 * plain[0].std_err);
+    REQUIRE(cv[0].std_err < 0.05 * plain[0].std_err);
+    REQUIRE(cv[1].std_err < 1e-9);   // the control prices itself exactly
+    REQUIRE(cv[3].std_err < plain[3].std_err);
+
+    // blocks have their own streams and merge in order: the thread count does not change a bit
+    cfg.n_threads = 3;
+    const auto threaded = vol::mc::path_mc(model, book, T, cfg);
+    for (std::size_t i = 0; i < book.size(); ++i) {
+        REQUIRE(threaded[i].price == cv[i].price);
+        REQUIRE(threaded[i].std_err == cv[i].std_err);
+    }
+}
+
+TEST_CASE("Path MC rejects bad input","[path_mc]"){
+    const auto model = vol::mc::gbm_exact(100,0.02,0.0,0.2);
+    const std::vector<vol::mc::PathPayoff> book{vol::mc::lookback_fixed(100,true)};
+    vol::mc::PathMCConfig cfg;
+    cfg.steps = 0;
+    REQUIRE_THROWS_AS(vol::mc::path_mc(model, book, 1.0, cfg), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::mc::path_mc(model, book, 0.0), std::invalid_argument);
+    const std::vector<vol::mc::PathPayoff> empty_payoff{vol::mc::PathPayoff{}};
+    REQUIRE_THROWS_AS(vol::mc::path_mc(model, empty_payoff, 1.0), std::invalid_argument);
+    REQUIRE(vol::mc::path_mc(model, std::span<const vol::mc::PathPayoff>{}, 1.0).empty());
+    REQUIRE_THROWS_AS(vol::mc::asian_geometric_gbm(100,100,0.02,0.0,1.0,0.2,0,true), std::invalid_argument);
+}
@@ -0,0 +1,300 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/stream/pipeline.hpp"
+#include "libvol/stream/ring.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+
+constexpr double SPOT = 100.0;
+
+// Mid of a strike on an SVI smile, as a quote would arrive
+double smile_mid(const vol::stream::Expiry& ex, double K, bool is_call, double level = 1.0) {
+    const vol::svi::Params p{0.01 * ex.T * level, 0.08, -0.4, 0.0, 0.15};
+    const double F = SPOT * std::exp((ex.r - ex.q) * ex.T);
+    const double vol = std::sqrt(vol::svi::total_variance(std::log(K / F), p) / ex.T);
+    return vol::bs::price(SPOT, K, ex.r, ex.q, ex.T, vol, is_call);
+}
+
+vol::stream::Quote quote(std::uint32_t e, const vol::stream::Expiry& ex, double K, double level = 1.0) {
+    const bool call = K >= SPOT;
+    return {e, K, smile_mid(ex, K, call, level), SPOT, call, vol::stream::now_ns()};
+}
+
+// Collects the published updates; the callback runs on the publish thread
+struct Sink {
+    std::mutex m;
+    std::vector<vol::stream::SliceUpdate> updates;
+    std::map<std::uint32_t, vol::stream::SliceUpdate> latest;
+
+    auto callback() {
+        return [this](const vol::stream::SliceUpdate& u) {
+            std::lock_guard<std::mutex> lock(m);
+            updates.push_back(u);
+            latest[u.expiry] = u;
+        };
+    }
+};
+
+const std::vector<vol::stream::Expiry> EXPIRIES{{0.25, 0.03, 0.01}, {0.5, 0.03, 0.01}, {1.0, 0.03, 0.01}};
+
+} // namespace
+
+TEST_CASE("Stream: SPSC ring keeps order and bounds", "[stream]") {
+    vol::stream::SpscRing<int> ring(5);
+    REQUIRE(ring.capacity() == 8);
+    int v = 0;
+    REQUIRE_FALSE(ring.try_pop(v));
+    for (int i = 0; i < 8; ++i) REQUIRE(ring.try_push(i));
+    REQUIRE_FALSE(ring.try_push(8));
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(ring.try_pop(v));
+        REQUIRE(v == i);
+    }
+    REQUIRE(ring.empty());
+
+    // producer and consumer on separate threads, wrapping the ring many times
+    constexpr int N = 200000;
+    std::thread producer([&] {
+        for (int i = 0; i < N; ++i) {
+            while (!ring.try_push(i)) std::this_thread::yield();
+        }
+    });
+    long long sum = 0;
+    int expected = 0;
+    bool ordered = true;
+    while (expected < N) {
+        if (ring.try_pop(v)) {
+            ordered = ordered && v == expected;
+            sum += v;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    REQUIRE(ordered);
+    REQUIRE(sum == static_cast<long long>(N) * (N - 1) / 2);
+}
+
+TEST_CASE("Stream: MPSC ring delivers every push in per-producer order", "[stream]") {
+    constexpr int PRODUCERS = 4, PER = 50000;
+    vol::stream::MpscRing<std::uint64_t> ring(64);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (int i = 0; i < PER; ++i) {
+                const std::uint64_t v = (static_cast<std::uint64_t>(p) << 32) | static_cast<std::uint64_t>(i);
+                while (!ring.try_push(v)) std::this_thread::yield();
+            }
+        });
+    }
+    std::vector<int> next(PRODUCERS, 0);
+    bool ordered = true;
+    std::uint64_t v = 0;
+    for (int got = 0; got < PRODUCERS * PER;) {
+        if (!ring.try_pop(v)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const int p = static_cast<int>(v >> 32), i = static_cast<int>(v & 0xffffffffu);
+        ordered = ordered && i == next[p];
+        next[p] = i + 1;
+        ++got;
+    }
+    for (auto& t : producers) t.join();
+    REQUIRE(ordered);
+    for (int p = 0; p < PRODUCERS; ++p) REQUIRE(next[p] == PER);
+    REQUIRE_FALSE(ring.try_pop(v));
+}
+
+TEST_CASE("Stream: pipeline fit equals a batch fit of the final book", "[stream]") {
+    Sink sink;
+    vol::stream::Config cfg;
+    cfg.expiries = EXPIRIES;
+    cfg.publish = sink.callback();
+    cfg.min_refit_interval = std::chrono::microseconds(0);
+    vol::stream::Pipeline pipe(cfg);
+
+    // two passes over every strike, the second on a shifted smile, plus an unpriceable quote
+    for (double level : {1.0, 1.3}) {
+        for (std::uint32_t e = 0; e < EXPIRIES.size(); ++e) {
+            for (double K = 80.0; K <= 120.0; K += 5.0) REQUIRE(pipe.submit(quote(e, EXPIRIES[e], K, level)));
+        }
+    }
+    REQUIRE(pipe.submit({0, 90.0, 1e-9, SPOT, true, vol::stream::now_ns()}));   // below intrinsic
+    pipe.flush();
+
+    const auto stats = pipe.stats();
+    REQUIRE(stats.submitted == 2 * 3 * 9 + 1);
+    REQUIRE(stats.rejected == 1);
+    REQUIRE(stats.fit_failures == 0);
+    REQUIRE(stats.published == stats.fits);
+    REQUIRE(stats.invalidations == 0);
+    std::lock_guard<std::mutex> lock(sink.m);
+    REQUIRE(sink.latest.size() == EXPIRIES.size());
+    for (std::uint32_t e = 0; e < EXPIRIES.size(); ++e) {
+        const auto& ex = EXPIRIES[e];
+        std::vector<vol::OptionSpec> opts;
+        std::vector<double> mids;
+        for (double K = 80.0; K <= 120.0; K += 5.0) {
+            opts.push_back({SPOT, K, ex.r, ex.q, ex.T, K >= SPOT});
+            mids.push_back(smile_mid(ex, K, K >= SPOT, 1.3));
+        }
+        const auto batch = vol::svi::calibrate_slice_from_prices(opts, mids);
+        const auto& got = sink.latest.at(e);
+        REQUIRE(got.quotes == 9);
+        REQUIRE(got.T == ex.T);
+        for (int i = 0; i < 5; ++i) REQUIRE(got.params[i] == Approx(batch[i]).margin(1e-12));
+        REQUIRE(got.published_ns >= got.first_tick_ns);
+    }
+    // versions count up per expiry
+    std::map<std::uint32_t, std::uint64_t> last;
+    for (const auto& u : sink.updates) {
+        REQUIRE(u.version == last[u.expiry] + 1);
+        last[u.expiry] = u.version;
+    }
+}
+
+TEST_CASE("Stream: only dirty expiries are refit, bursts coalesce", "[stream]") {
+    // scheduling runs on a hand-driven clock, so the fit count does not depend on timing
+    std::atomic<std::uint64_t> clock{1'000'000'000};
+    Sink sink;
+    vol::stream::Config cfg;
+    cfg.expiries = EXPIRIES;
+    cfg.publish = sink.callback();
+    cfg.min_refit_interval = std::chrono::milliseconds(20);
+    cfg.clock = [&clock] { return clock.load(); };
+    cfg.slice.min_points = 9;   // the first fit of each expiry sees the whole seed book
+    vol::stream::Pipeline pipe(cfg);
+
+    for (std::uint32_t e = 0; e < EXPIRIES.size(); ++e) {
+        for (double K = 80.0; K <= 120.0; K += 5.0) pipe.submit(quote(e, EXPIRIES[e], K));
+    }
+    pipe.flush();
+    const auto before = pipe.stats();
+    REQUIRE(before.fits == 3);
+
+    // a burst of 400 ticks on the middle expiry only, all inside one refit interval
+    for (int i = 0; i < 400; ++i) {
+        const double K = 80.0 + 5.0 * (i % 9);
+        pipe.submit(quote(1, EXPIRIES[1], K, 1.0 + 1e-4 * (i + 1)));
+    }
+    while (pipe.stats().ingested < before.submitted + 400) std::this_thread::yield();
+    REQUIRE(pipe.stats().fits == before.fits);   // the interval has not passed on the clock
+    clock += 20'000'000;
+    pipe.flush();
+    const auto after = pipe.stats();
+
+    std::lock_guard<std::mutex> lock(sink.m);
+    REQUIRE(after.fits - before.fits == 1);
+    REQUIRE(sink.latest.at(0).version == 1);
+    REQUIRE(sink.latest.at(2).version == 1);
+    REQUIRE(sink.latest.at(1).version == 2);
+    REQUIRE(sink.latest.at(1).ticks == 400);
+}
+
+TEST_CASE("Stream: withdrawn quotes leave the book, a thin book is invalidated", "[stream]") {
+    Sink sink;
+    vol::stream::Config cfg;
+    cfg.expiries = {EXPIRIES[0]};
+    cfg.publish = sink.callback();
+    cfg.min_refit_interval = std::chrono::microseconds(0);
+    vol::stream::Pipeline pipe(cfg);
+    for (double K = 80.0; K <= 120.0; K += 5.0) pipe.submit(quote(0, EXPIRIES[0], K));
+    pipe.flush();
+    pipe.submit({0, 80.0, 0.0, SPOT, false, vol::stream::now_ns()});
+    pipe.submit({0, 85.0, 0.0, SPOT, false, vol::stream::now_ns()});
+    pipe.flush();
+    {
+        std::lock_guard<std::mutex> lock(sink.m);
+        REQUIRE(sink.latest.at(0).quotes == 7);
+        REQUIRE(sink.latest.at(0).valid);
+    }
+
+    // 5 quotes left, below min_points = 6: the previous fit is withdrawn, not left standing
+    pipe.submit({0, 90.0, 0.0, SPOT, false, vol::stream::now_ns()});
+    pipe.submit({0, 95.0, 0.0, SPOT, false, vol::stream::now_ns()});
+    pipe.flush();
+    {
+        std::lock_guard<std::mutex> lock(sink.m);
+        const auto& u = sink.latest.at(0);
+        REQUIRE_FALSE(u.valid);
+        REQUIRE(u.quotes == 5);
+        REQUIRE(std::isnan(u.params[0]));
+    }
+    REQUIRE(pipe.stats().invalidations == 1);
+
+    pipe.submit(quote(0, EXPIRIES[0], 95.0));
+    pipe.flush();
+    std::lock_guard<std::mutex> lock(sink.m);
+    REQUIRE(sink.latest.at(0).valid);
+    REQUIRE(sink.latest.at(0).quotes == 6);
+    std::uint64_t last = 0;
+    for (const auto& u : sink.updates) {
+        REQUIRE(u.version == last + 1);
+        last = u.version;
+    }
+}
+
+TEST_CASE("Stream: flush covers every quote submitted before it, across threads", "[stream]") {
+    // each thread owns one expiry and adds one new strike per round, then flushes: the
+    // published book must already hold that strike however the other threads interleave
+    constexpr int THREADS = 4, ROUNDS = 30;
+    Sink sink;
+    vol::stream::Config cfg;
+    for (int t = 0; t < THREADS; ++t) cfg.expiries.push_back({0.25 * (t + 1), 0.03, 0.01});
+    cfg.publish = sink.callback();
+    cfg.min_refit_interval = std::chrono::microseconds(0);
+    cfg.slice.min_points = 6;
+    vol::stream::Pipeline pipe(cfg);
+
+    std::atomic<int> missed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            const auto e = static_cast<std::uint32_t>(t);
+            const auto& ex = cfg.expiries[e];
+            for (int k = 0; k < 6; ++k) pipe.submit(quote(e, ex, 85.0 + 5.0 * k));
+            for (int i = 0; i < ROUNDS; ++i) {
+                pipe.submit(quote(e, ex, 70.0 + 2.0 * i + 0.5));
+                pipe.flush();
+                std::lock_guard<std::mutex> lock(sink.m);
+                if (sink.latest.at(e).quotes != static_cast<std::size_t>(7 + i)) ++missed;
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    REQUIRE(missed == 0);
+    REQUIRE(pipe.stats().ingested == pipe.stats().submitted);
+}
+
+TEST_CASE("Stream: invalid configuration and quotes throw", "[stream]") {
+    vol::stream::Config cfg;
+    cfg.publish = [](const vol::stream::SliceUpdate&) {};
+    REQUIRE_THROWS_AS(vol::stream::Pipeline(cfg), std::invalid_argument);
+    cfg.expiries = {{0.0, 0.01, 0.0}};
+    REQUIRE_THROWS_AS(vol::stream::Pipeline(cfg), std::invalid_argument);
+    cfg.expiries = {{0.5, 0.01, 0.0}};
+    cfg.publish = nullptr;
+    REQUIRE_THROWS_AS(vol::stream::Pipeline(cfg), std::invalid_argument);
+
+    cfg.publish = [](const vol::stream::SliceUpdate&) {};
+    vol::stream::Pipeline pipe(cfg);
+    REQUIRE_THROWS_AS(pipe.submit({3, 100.0, 5.0, SPOT, true, 0}), std::invalid_argument);
+    pipe.stop();
+    REQUIRE_FALSE(pipe.submit({0, 100.0, 5.0, SPOT, true, 0}));
+    pipe.stop();
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/mc/gbm.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/black_scholes_fp.hpp"
+#include "libvol/models/svi.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+
+// S = 100, K 50..200, T 1W..5Y, vol 5%..100%, calls and puts
+struct Grid {
+    std::vector<double> S, K, r, q, T, vol;
+    std::vector<std::uint8_t> is_call;
+
+    std::size_t size() const { return S.size(); }
+};
+
+Grid make_grid() {
+    Grid g;
+    for (double T : {1.0 / 52.0, 1.0 / 12.0, 0.25, 1.0, 5.0}) {
+        for (double K = 50.0; K <= 200.0; K += 5.0) {
+            for (double vol : {0.05, 0.2, 0.5, 1.0}) {
+                for (std::uint8_t c : {std::uint8_t{0}, std::uint8_t{1}}) {
+                    g.S.push_back(100.0); g.K.push_back(K); g.r.push_back(0.03); g.q.push_back(0.01);
+                    g.T.push_back(T); g.vol.push_back(vol); g.is_call.push_back(c);
+                }
+            }
+        }
+    }
+    return g;
+}
+
+std::vector<float> to_float(const std::vector<double>& x) {
+    return {x.begin(), x.end()};
+}
+
+} // namespace
+
+TEST_CASE("Float BS batch stays within the documented error bounds", "[precision]") {
+    const Grid g = make_grid();
+    const std::size_t n = g.size();
+    const auto S = to_float(g.S), K = to_float(g.K), r = to_float(g.r), q = to_float(g.q);
+    const auto T = to_float(g.T), vol = to_float(g.vol);
+    std::vector<float> price(n), delta(n), gamma(n), vega(n), theta(n), rho(n), price_only(n);
+    vol::bs::fp::price_greeks_batch<float>(S.data(), K.data(), r.data(), q.data(), T.data(), vol.data(),
+                                           g.is_call.data(), n,
+                                           {price.data(), delta.data(), gamma.data(), vega.data(), theta.data(), rho.data()});
+    vol::bs::fp::price_batch<float>(S.data(), K.data(), r.data(), q.data(), T.data(), vol.data(),
+                                    g.is_call.data(), n, price_only.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto ref = vol::bs::price_greeks(g.S[i], g.K[i], g.r[i], g.q[i], g.T[i], g.vol[i], g.is_call[i] != 0);
+        INFO("K=" << g.K[i] << " T=" << g.T[i] << " vol=" << g.vol[i] << " call=" << int(g.is_call[i]));
+        REQUIRE(std::abs(price[i] - ref.price) < 5e-5);
+        REQUIRE(std::abs(price_only[i] - ref.price) < 5e-5);
+        REQUIRE(std::abs(delta[i] - ref.delta) < 1e-6);
+        REQUIRE(std::abs(gamma[i] - ref.gamma) <= 5e-5 * ref.gamma + 1e-9);
+        REQUIRE(std::abs(vega[i] - ref.vega) <= 5e-5 * ref.vega + 1e-6);
+        REQUIRE(std::abs(theta[i] - ref.theta) < 5e-4);
+        REQUIRE(std::abs(rho[i] - ref.rho) < 5e-4);
+    }
+}
+
+TEST_CASE("Double BS batch and scalar template match bs::price_greeks", "[precision]") {
+    const Grid g = make_grid();
+    const std::size_t n = g.size();
+    std::vector<double> price(n), delta(n), gamma(n), vega(n), theta(n), rho(n);
+    vol::bs::fp::price_greeks_batch<double>(g.S.data(), g.K.data(), g.r.data(), g.q.data(), g.T.data(),
+                                            g.vol.data(), g.is_call.data(), n,
+                                            {price.data(), delta.data(), gamma.data(), vega.data(), theta.data(), rho.data()});
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool call = g.is_call[i] != 0;
+        const auto ref = vol::bs::price_greeks(g.S[i], g.K[i], g.r[i], g.q[i], g.T[i], g.vol[i], call);
+        REQUIRE(price[i] == Approx(ref.price).epsilon(1e-12).margin(1e-12));
+        REQUIRE(delta[i] == Approx(ref.delta).margin(1e-13));
+        REQUIRE(vega[i] == Approx(ref.vega).epsilon(1e-12).margin(1e-12));
+        REQUIRE(theta[i] == Approx(ref.theta).epsilon(1e-12).margin(1e-12));
+        const double scalar = vol::bs::fp::price<double>(g.S[i], g.K[i], g.r[i], g.q[i], g.T[i], g.vol[i], call);
+        REQUIRE(scalar == Approx(ref.price).epsilon(1e-12).margin(1e-12));
+    }
+    // expired quotes fall back to intrinsic value, as in bs::price_greeks
+    const auto expired = vol::bs::fp::price_greeks<float>(110.0f, 100.0f, 0.02f, 0.0f, 0.0f, 0.2f, true);
+    REQUIRE(expired.price == Approx(10.0f));
+    REQUIRE(expired.delta == 1.0f);
+    REQUIRE(expired.vega == 0.0f);
+}
+
+TEST_CASE("Mixed-precision IV matches the double solver", "[precision]") {
+    const Grid g = make_grid();
+    const std::size_t n = g.size();
+    std::vector<double> prices(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        prices[i] = vol::bs::price(g.S[i], g.K[i], g.r[i], g.q[i], g.T[i], g.vol[i], g.is_call[i] != 0);
+    }
+    std::vector<vol::bs::IVResult> out(n);
+    vol::bs::fp::implied_vol_mixed(g.S.data(), g.K.data(), g.r.data(), g.q.data(), g.T.data(), prices.data(),
+                                   g.is_call.data(), n, out.data());
+    std::size_t identifiable = 0;
+    std::size_t fast_path = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool call = g.is_call[i] != 0;
+        const auto ref = vol::bs::implied_vol(g.S[i], g.K[i], g.r[i], g.q[i], g.T[i], prices[i], call);
+        INFO("K=" << g.K[i] << " T=" << g.T[i] << " vol=" << g.vol[i] << " call=" << int(call));
+        REQUIRE(out[i].converged == ref.converged);
+        const double vega = vol::bs::price_greeks(g.S[i], g.K[i], g.r[i], g.q[i], g.T[i], g.vol[i], call).vega;
+        if (vega < 0.1) continue;
+        ++identifiable;
+        if (out[i].newton_iters == 2 && out[i].brent_iters == 0) ++fast_path;
+        REQUIRE(out[i].iv == Approx(g.vol[i]).margin(1e-9));
+    }
+    // almost every well-conditioned quote is finished by the two double steps
+    REQUIRE(fast_path >= identifiable * 99 / 100);
+}
+
+TEST_CASE("Float SVI total variance and GBM MC track the double results", "[precision]") {
+    const vol::svi::Params p{0.02, 0.4, -0.4, 0.05, 0.2};
+    std::vector<float> kf;
+    for (int i = 0; i <= 400; ++i) kf.push_back(-2.0f + 0.01f * static_cast<float>(i));
+    std::vector<float> wf(kf.size());
+    vol::svi::total_variance_batch<float>(kf.data(), kf.size(), p, wf.data());
+    std::vector<double> kd(kf.begin(), kf.end());
+    std::vector<double> wd(kd.size());
+    vol::svi::total_variance_batch<double>(kd.data(), kd.size(), p, wd.data());
+    for (std::size_t i = 0; i < kf.size(); ++i) {
+        const double ref = vol::svi::total_variance(kd[i], p);
+        REQUIRE(wd[i] == ref);
+        REQUIRE(std::abs(wf[i] - ref) <= 1e-6 * ref);
+    }
+
+    const auto inv = vol::mc::european_vanilla_gbm(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true, 100000, 7,
+                                                   vol::mc::NormalGen::InverseCDF);
+    const auto d = vol::mc::european_vanilla_gbm_fp<double>(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true, 100000, 7);
+    const auto f = vol::mc::european_vanilla_gbm_fp<float>(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true, 100000, 7);
+    REQUIRE(d.price == Approx(inv.price).epsilon(1e-10));
+    REQUIRE(d.std_err == Approx(inv.std_err).epsilon(1e-6));
+    REQUIRE(std::abs(f.price - d.price) < 1e-4);
+    REQUIRE(f.paths == d.paths);
+    const double bs = vol::bs::price(100.0, 105.0, 0.02, 0.01, 1.0, 0.2, true);
+    REQUIRE(std::abs(f.price - bs) < 4.0 * f.std_err);
+}
@@ -0,0 +1,30 @@
+#include <catch2/catch_all.hpp>
+#include "libvol/math/root_finders.hpp"
+#include <cmath>
+
+TEST_CASE("brent converges when the left end has the smaller residual","[root]"){
+    // f(a) is closer to zero than f(b) on all three brackets, which the first step has to
+    // reorder without collapsing the bracket onto an endpoint
+    int calls = 0;
+    auto cubic = [&](double x) { ++calls; return x * x * x - 2.0 * x - 5.0; };
+    const auto r = vol::root::brent(cubic, 2.0, 3.0, 1e-12, 100);
+    REQUIRE(r.converged);
+    REQUIRE(std::abs(r.x - 2.0945514815423265) < 1e-11);
+    REQUIRE(calls < 20);
+
+    const auto e = vol::root::brent([](double x) { return std::exp(x) - 10.0; }, 0.0, 5.0, 1e-12, 100);
+    REQUIRE(e.converged);
+    REQUIRE(std::abs(e.x - std::log(10.0)) < 1e-11);
+
+    // decreasing f, so the sign change runs the other way
+    const auto d = vol::root::brent([](double x) { return 1.0 - x * x * x; }, 0.9, 4.0, 1e-12, 100);
+    REQUIRE(d.converged);
+    REQUIRE(std::abs(d.x - 1.0) < 1e-11);
+}
+
+TEST_CASE("brent handles roots at the bracket ends and rejects unbracketed input","[root]"){
+    const auto r = vol::root::brent([](double x) { return x - 1.0; }, 1.0, 2.0);
+    REQUIRE(r.converged);
+    REQUIRE(r.x == 1.0);
+    REQUIRE_THROWS_AS(vol::root::brent([](double x) { return x * x + 1.0; }, -1.0, 1.0), std::invalid_argument);
+}
@@ -0,0 +1,233 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/io/shm_surface.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if !defined(_WIN32)
+std::string segment_name(const char* tag) {
+    return "/libvol_test_" + std::string(tag) + "_" + std::to_string(::getpid());
+}
+
+// Leaves the first record mid-publish (odd sequence), as a writer that stalled or died
+// between the two bumps would; the record header starts right after the 128-byte header
+void begin_publish_and_stop(const std::string& name) {
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    REQUIRE(fd >= 0);
+    void* p = ::mmap(nullptr, 256, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    REQUIRE(p != MAP_FAILED);
+    std::atomic_ref<std::uint64_t>(*reinterpret_cast<std::uint64_t*>(static_cast<std::byte*>(p) + 128))
+        .fetch_add(1);
+    ::munmap(p, 256);
+}
+#endif
+
+// Every field equals tag, so a torn read shows up as a mismatch
+std::vector<vol::io::ShmSlice> tagged(double tag, std::size_t n) {
+    std::vector<vol::io::ShmSlice> out(n);
+    for (auto& s : out) s = {tag, tag, tag, {tag, tag, tag, tag, tag}};
+    return out;
+}
+
+bool consistent(const std::vector<vol::io::ShmSlice>& slices) {
+    for (const auto& s : slices) {
+        const double tag = s.T;
+        if (s.forward != tag || s.discount != tag) return false;
+        for (double p : s.params) {
+            if (p != tag) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+#if !defined(_WIN32)
+
+TEST_CASE("Shm surface: publish and read round-trip", "[shm]") {
+    const std::string name = segment_name("roundtrip");
+    auto writer = vol::io::ShmSurfaceWriter::create(name, 4, 8);
+    auto reader = vol::io::ShmSurfaceReader::attach(name);
+    REQUIRE(reader.max_underlyings() == 4);
+    REQUIRE(reader.max_slices() == 8);
+    REQUIRE(reader.writer_pid() == ::getpid());
+    REQUIRE(reader.version(2) == 0);
+    REQUIRE(reader.read(2).empty());
+
+    const std::vector<vol::io::ShmSlice> slices{{0.25, 101.0, 0.99, {0.01, 0.1, -0.3, 0.0, 0.2}},
+                                                {1.0, 103.0, 0.97, {0.04, 0.12, -0.2, 0.01, 0.25}}};
+    REQUIRE(writer.publish(2, slices) == 1);
+    REQUIRE(writer.publish(2, slices) == 2);
+    const auto got = reader.read(2);
+    REQUIRE(got.size() == 2);
+    REQUIRE(got[1].T == 1.0);
+    REQUIRE(got[1].forward == 103.0);
+    REQUIRE(got[1].discount == 0.97);
+    REQUIRE(got[1].params == slices[1].params);
+    REQUIRE(reader.version(2) == 2);
+    REQUIRE(reader.version(1) == 0);
+
+    std::vector<vol::io::ShmSlice> buf(8);
+    const auto r = reader.read(2, buf);
+    REQUIRE(r.version == 2);
+    REQUIRE(r.n_slices == 2);
+    REQUIRE(r.published_ns > 0);
+
+    // shrinking the slice set is visible too
+    writer.publish(2, std::span<const vol::io::ShmSlice>(slices).first(1));
+    REQUIRE(reader.read(2).size() == 1);
+    vol::io::ShmSurfaceWriter::remove(name);
+}
+
+TEST_CASE("Shm surface: invalid use throws", "[shm]") {
+    const std::string name = segment_name("invalid");
+    REQUIRE_THROWS_AS(vol::io::ShmSurfaceReader::attach(name), std::runtime_error);
+    REQUIRE_THROWS_AS(vol::io::ShmSurfaceWriter::create(name, 0, 8), std::invalid_argument);
+    auto writer = vol::io::ShmSurfaceWriter::create(name, 2, 3);
+    REQUIRE_THROWS_AS(writer.publish(2, tagged(1.0, 1)), std::invalid_argument);
+    REQUIRE_THROWS_AS(writer.publish(0, tagged(1.0, 4)), std::invalid_argument);
+    auto reader = vol::io::ShmSurfaceReader::attach(name);
+    std::vector<vol::io::ShmSlice> short_buf(2);
+    REQUIRE_THROWS_AS(reader.read(0, short_buf), std::invalid_argument);
+    REQUIRE_THROWS_AS(reader.version(5), std::invalid_argument);
+    vol::io::ShmSurfaceWriter::remove(name);
+    REQUIRE_THROWS_AS(vol::io::ShmSurfaceReader::attach(name), std::runtime_error);
+}
+
+TEST_CASE("Shm surface: create refuses a live writer's segment and replaces a dead one's", "[shm]") {
+    const std::string name = segment_name("owner");
+    {
+        auto writer = vol::io::ShmSurfaceWriter::create(name, 2, 4);
+        writer.publish(0, tagged(1.0, 2));
+        // this process is still alive, so a second writer must not take the segment over
+        REQUIRE_THROWS_AS(vol::io::ShmSurfaceWriter::create(name, 2, 4), std::runtime_error);
+        REQUIRE(vol::io::ShmSurfaceReader::attach(name).version(0) == 1);
+    }
+    vol::io::ShmSurfaceWriter::remove(name);
+
+    // a writer that exits without removing its segment leaves it to the next create
+    const pid_t pid = ::fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+        int status = 0;
+        try {
+            auto writer = vol::io::ShmSurfaceWriter::create(name, 2, 4);
+            writer.publish(0, tagged(1.0, 2));
+        } catch (...) {
+            status = 1;
+        }
+        ::_exit(status);
+    }
+    int status = -1;
+    REQUIRE(::waitpid(pid, &status, 0) == pid);
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(vol::io::ShmSurfaceReader::attach(name).writer_pid() == pid);
+
+    auto writer = vol::io::ShmSurfaceWriter::create(name, 3, 4);
+    auto reader = vol::io::ShmSurfaceReader::attach(name);
+    REQUIRE(reader.writer_pid() == ::getpid());
+    REQUIRE(reader.max_underlyings() == 3);
+    REQUIRE(reader.version(0) == 0);
+    vol::io::ShmSurfaceWriter::remove(name);
+}
+
+TEST_CASE("Shm surface: read gives up on a stalled or dead writer", "[shm]") {
+    using namespace std::chrono_literals;
+
+    // live writer stuck mid-publish: the read times out after max_wait
+    const std::string stalled = segment_name("stalled");
+    auto writer = vol::io::ShmSurfaceWriter::create(stalled, 2, 4);
+    writer.publish(1, tagged(1.0, 2));
+    begin_publish_and_stop(stalled);
+    auto reader = vol::io::ShmSurfaceReader::attach(stalled, 20ms);
+    const auto t0 = std::chrono::steady_clock::now();
+    REQUIRE_THROWS_AS(reader.read(0), std::runtime_error);
+    REQUIRE(std::chrono::steady_clock::now() - t0 < 2s);
+    REQUIRE(reader.read(1).size() == 2);   // other records are unaffected
+    vol::io::ShmSurfaceWriter::remove(stalled);
+
+    // writer died mid-publish: detected from its pid without waiting out max_wait
+    const std::string dead = segment_name("dead");
+    const pid_t pid = ::fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+        auto w = vol::io::ShmSurfaceWriter::create(dead, 1, 4);
+        ::_exit(0);
+    }
+    int status = -1;
+    REQUIRE(::waitpid(pid, &status, 0) == pid);
+    begin_publish_and_stop(dead);
+    auto orphan = vol::io::ShmSurfaceReader::attach(dead, 1h);
+    REQUIRE_THROWS_AS(orphan.read(0), std::runtime_error);
+    vol::io::ShmSurfaceWriter::remove(dead);
+}
+
+TEST_CASE("Shm surface: reader processes never see a torn record", "[shm]") {
+    const std::string name = segment_name("procs");
+    constexpr std::uint32_t UNDERLYINGS = 3;
+    constexpr int PUBLISHES = 3000;
+    auto writer = vol::io::ShmSurfaceWriter::create(name, UNDERLYINGS, 16);
+
+    // readers are separate processes attaching by name; exit status 0 = all reads consistent
+    std::vector<pid_t> children;
+    for (int c = 0; c < 2; ++c) {
+        const pid_t pid = ::fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0) {
+            int status = 0;
+            try {
+                auto reader = vol::io::ShmSurfaceReader::attach(name);
+                std::uint64_t last[UNDERLYINGS] = {};
+                for (;;) {
+                    bool done = true;
+                    for (std::uint32_t u = 0; u < UNDERLYINGS; ++u) {
+                        const auto s = reader.read(u);
+                        const std::uint64_t v = reader.version(u);
+                        if (!consistent(s) || v < last[u] || (!s.empty() && s[0].T > static_cast<double>(v))) {
+                            status = 1;
+                        }
+                        last[u] = v;
+                        done = done && v >= static_cast<std::uint64_t>(PUBLISHES);
+                    }
+                    if (done || status != 0) break;
+                }
+            } catch (...) {
+                status = 2;
+            }
+            ::_exit(status);
+        }
+        children.push_back(pid);
+    }
+
+    for (int v = 1; v <= PUBLISHES; ++v) {
+        for (std::uint32_t u = 0; u < UNDERLYINGS; ++u) {
+            // payload tag = version, size varies so n_slices changes under the readers too
+            writer.publish(u, tagged(v, 1 + static_cast<std::size_t>(v % 16)));
+        }
+        if (v % 64 == 0) ::usleep(100);
+    }
+    for (pid_t pid : children) {
+        int status = -1;
+        REQUIRE(::waitpid(pid, &status, 0) == pid);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+    }
+    vol::io::ShmSurfaceWriter::remove(name);
+}
+
+#endif
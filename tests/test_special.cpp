@@ -0,0 +1,122 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/math/special.hpp"
+#include "libvol/mc/gbm.hpp"
+#include "libvol/models/black_scholes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using Catch::Approx;
+using vol::math::Accuracy;
+
+TEST_CASE("Normal CDF tiers meet their error bounds", "[special]") {
+    double abs_high = 0.0;
+    double rel_high = 0.0;
+    double abs_fast = 0.0;
+    for (double x = -37.0; x <= 37.0; x += 0.003) {
+        const double ref = vol::math::norm_cdf(x);
+        const double high = vol::math::norm_cdf(x, Accuracy::High);
+        abs_high = std::max(abs_high, std::abs(high - ref));
+        abs_fast = std::max(abs_fast, std::abs(vol::math::norm_cdf(x, Accuracy::Fast) - ref));
+        if (x < 0.0) {
+            rel_high = std::max(rel_high, std::abs(high / ref - 1.0));
+        }
+    }
+    REQUIRE(abs_high < 1e-15);
+    REQUIRE(rel_high < 1e-13);
+    REQUIRE(abs_fast < 7.5e-8);
+    REQUIRE(vol::math::norm_cdf(0.0, Accuracy::High) == 0.5);
+    REQUIRE(vol::math::norm_cdf(0.0, Accuracy::Fast) == Approx(0.5).margin(1e-9));
+}
+
+TEST_CASE("Inverse normal CDF round-trips across tiers", "[special]") {
+    for (double lp = -300.0; lp < -0.31; lp += 0.05) {
+        const double pt = std::pow(10.0, lp);
+        for (double p : {pt, 1.0 - pt}) {
+            if (p >= 1.0) continue;
+            const double x = vol::math::norm_inv_cdf(p);
+            // compare in the lower tail, where the probability is representable to full precision
+            const double back = x < 0.0 ? vol::math::norm_cdf(x) : vol::math::norm_cdf(-x);
+            const double p_lower = p < 0.5 ? p : 1.0 - p;
+            INFO("p=" << p);
+            REQUIRE(std::abs(back / p_lower - 1.0) < 1e-15 * (1.0 + x * x));
+            REQUIRE(std::abs(vol::math::norm_inv_cdf(p, Accuracy::High) - x) <= 1e-14 * std::abs(x) + 1e-15);
+            REQUIRE(std::abs(vol::math::norm_inv_cdf(p, Accuracy::Fast) - x) <= 1.2e-9 * std::abs(x) + 1e-15);
+        }
+    }
+    REQUIRE(vol::math::norm_inv_cdf(0.5) == 0.0);
+    REQUIRE(vol::math::norm_inv_cdf(0.0) == -std::numeric_limits<double>::infinity());
+    REQUIRE(vol::math::norm_inv_cdf(1.0) == std::numeric_limits<double>::infinity());
+    REQUIRE(std::isnan(vol::math::norm_inv_cdf(1.5)));
+}
+
+TEST_CASE("Normal batch forms match the scalar functions", "[special]") {
+    std::vector<double> x;
+    std::vector<double> p;
+    for (int i = 0; i <= 2000; ++i) {
+        x.push_back(-30.0 + 0.03 * i);
+        p.push_back(i / 2000.0);
+    }
+    std::vector<double> out(x.size());
+    for (Accuracy acc : {Accuracy::Full, Accuracy::High, Accuracy::Fast}) {
+        vol::math::norm_cdf(x, out, acc);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            REQUIRE(out[i] == Approx(vol::math::norm_cdf(x[i], acc)).epsilon(1e-13).margin(1e-300));
+        }
+        vol::math::norm_inv_cdf(p, out, acc);
+        REQUIRE(out.front() == -std::numeric_limits<double>::infinity());
+        REQUIRE(out.back() == std::numeric_limits<double>::infinity());
+        for (std::size_t i = 1; i + 1 < p.size(); ++i) {
+            REQUIRE(out[i] == Approx(vol::math::norm_inv_cdf(p[i], acc)).epsilon(1e-13).margin(1e-15));
+        }
+    }
+    vol::math::norm_pdf(x, out);
+    REQUIRE(out[1000] == Approx(vol::math::norm_pdf(x[1000])).epsilon(1e-15));
+    std::vector<double> short_out(3);
+    REQUIRE_THROWS_AS(vol::math::norm_cdf(x, short_out), std::invalid_argument);
+}
+
+TEST_CASE("Normal log-CDF stays finite in the far left tail", "[special]") {
+    REQUIRE(vol::math::norm_log_cdf(-10.0) == Approx(std::log(vol::math::norm_cdf(-10.0))).epsilon(1e-14));
+    REQUIRE(vol::math::norm_log_cdf(3.0) == Approx(-1.3508099647481923e-3).epsilon(1e-14));
+    // continuous across the switch to the asymptotic series
+    REQUIRE(vol::math::norm_log_cdf(-20.0 - 1e-9) == Approx(vol::math::norm_log_cdf(-20.0)).epsilon(1e-9));
+    // Phi(-40) underflows; log Phi(-40) = -804.60844201375...
+    REQUIRE(vol::math::norm_log_cdf(-40.0) == Approx(-804.6084420137538).epsilon(1e-14));
+    REQUIRE(std::isfinite(vol::math::norm_log_cdf(-1e5)));
+}
+
+TEST_CASE("Inverse-CDF Monte Carlo takes its tier per call", "[special]") {
+    auto run = [](Accuracy acc) {
+        return vol::mc::european_vanilla_gbm(100.0, 110.0, 0.02, 0.01, 0.5, 0.25, true, 200000, 42,
+                                             vol::mc::NormalGen::InverseCDF, acc);
+    };
+    const auto full = run(Accuracy::Full);
+    const auto fast = run(Accuracy::Fast);
+    // BS pricing stays on the erfc CDF
+    const double bs = vol::bs::price(100.0, 110.0, 0.02, 0.01, 0.5, 0.25, true);
+    const double d1 = (std::log(100.0 / 110.0) + (0.02 - 0.01 + 0.5 * 0.25 * 0.25) * 0.5) / (0.25 * std::sqrt(0.5));
+    const double d2 = d1 - 0.25 * std::sqrt(0.5);
+    auto N = [](double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+    REQUIRE(bs == Approx(100.0 * std::exp(-0.01 * 0.5) * N(d1) - 110.0 * std::exp(-0.02 * 0.5) * N(d2)).epsilon(1e-13));
+    REQUIRE(fast.price != full.price);
+    REQUIRE(fast.price == Approx(full.price).margin(1e-6));
+    REQUIRE(std::abs(fast.price - bs) < 4.0 * fast.std_err);
+
+    // no shared state: the two tiers side by side reproduce the serial results
+    vol::mc::MCResult a{}, b{};
+    std::thread ta([&] { a = run(Accuracy::Fast); });
+    std::thread tb([&] { b = run(Accuracy::Full); });
+    ta.join();
+    tb.join();
+    REQUIRE(a.price == fast.price);
+    REQUIRE(b.price == full.price);
+    const auto fp = vol::mc::european_vanilla_gbm_fp<double>(100.0, 110.0, 0.02, 0.01, 0.5, 0.25, true, 200000, 42,
+                                                             Accuracy::Fast);
+    REQUIRE(fp.price == Approx(fast.price).epsilon(1e-10));
+}
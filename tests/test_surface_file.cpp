@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/io/surface_file.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+struct Quotes {
+    double T, forward, discount;
+    std::vector<double> strike, mid;
+    std::vector<std::uint8_t> is_call;
+
+    vol::svi::SliceQuotes view() const { return {T, forward, discount, strike, mid, is_call}; }
+};
+
+Quotes make_quotes(const vol::svi::Params& params, double S, double r, double T) {
+    Quotes s;
+    s.T = T;
+    s.forward = S * std::exp(r * T);
+    s.discount = std::exp(-r * T);
+    for (double k = -0.6; k <= 0.61; k += 0.1) {
+        const double K = s.forward * std::exp(k);
+        const double iv = std::sqrt(vol::svi::total_variance(k, params) / T);
+        const bool call = k >= 0.0;
+        s.strike.push_back(K);
+        s.mid.push_back(vol::bs::price(S, K, r, 0.0, T, iv, call));
+        s.is_call.push_back(call ? 1 : 0);
+    }
+    return s;
+}
+
+vol::svi::FitResult fit_of(double tag) {
+    return {{tag, 0.1, -0.3, 0.0, 0.2}, 1e-4 * tag, 17, 11, true};
+}
+
+std::string temp_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+}
+
+TEST_CASE("Surface file round-trips fits sorted by underlying and expiry", "[surface_file]") {
+    vol::io::SurfaceFileWriter writer;
+    writer.add(9, 1.0, 101.0, 0.99, fit_of(3.0));
+    writer.add(2, 0.5, 100.5, 0.995, fit_of(2.0));
+    writer.add(9, 0.25, 100.2, 0.998, fit_of(1.0));
+    auto unconverged = fit_of(4.0);
+    unconverged.converged = false;
+    writer.add(2, 0.25, 100.2, 0.998, unconverged);
+    const std::string path = temp_path("libvol_test_surfaces.bin");
+    writer.write(path, 123456789);
+    REQUIRE_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    const auto file = vol::io::SurfaceFile::open(path);
+    REQUIRE(file.version() == vol::io::SURFACE_FILE_VERSION);
+    REQUIRE(file.timestamp() == 123456789);
+    REQUIRE(file.size() == 4);
+    const auto recs = file.records();
+    REQUIRE(recs[0].underlying == 2);
+    REQUIRE(recs[0].T == 0.25);
+    REQUIRE(recs[0].flags == 0);
+    REQUIRE(recs[3].underlying == 9);
+    REQUIRE(recs[3].T == 1.0);
+    REQUIRE(recs[3].flags == vol::io::SURFACE_CONVERGED);
+    REQUIRE(recs[3].forward == 101.0);
+    REQUIRE(recs[3].discount == 0.99);
+    REQUIRE(recs[3].params == fit_of(3.0).params);
+    REQUIRE(recs[3].rmse == fit_of(3.0).rmse);
+    REQUIRE(recs[3].iterations == 17);
+    REQUIRE(recs[3].n_points == 11);
+
+    REQUIRE(file.underlying(9).size() == 2);
+    REQUIRE(file.underlying(9)[0].T == 0.25);
+    REQUIRE(file.underlying(2).size() == 2);
+    REQUIRE(file.underlying(5).empty());
+    REQUIRE(file.underlying(10).empty());
+
+    // the file can be rewritten while a previous version is still mapped
+    writer.add(5, 2.0, 102.0, 0.98, fit_of(5.0));
+    writer.write(path);
+    REQUIRE(file.records()[3].params[0] == 3.0);
+    REQUIRE(vol::io::SurfaceFile::open(path).underlying(5).size() == 1);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Surface file rejects corrupt, truncated and foreign files", "[surface_file]") {
+    vol::io::SurfaceFileWriter writer;
+    REQUIRE_THROWS_AS(writer.add(0, 0.0, 100.0, 1.0, fit_of(1.0)), std::invalid_argument);
+    REQUIRE_THROWS_AS(writer.add(0, 1.0, -1.0, 1.0, fit_of(1.0)), std::invalid_argument);
+    for (std::uint32_t u = 0; u < 8; ++u) writer.add(u, 1.0, 100.0, 0.99, fit_of(u));
+    const std::string path = temp_path("libvol_test_surfaces_corrupt.bin");
+    writer.write(path);
+    REQUIRE_NOTHROW(vol::io::SurfaceFile::open(path));
+    REQUIRE_THROWS_AS(writer.write(temp_path("libvol_no_such_dir/surfaces.bin")), std::runtime_error);
+
+    // flip one bit of one parameter
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekg(128 + 3 * sizeof(vol::io::SurfaceRecord) + 40);
+        char c = 0;
+        f.read(&c, 1);
+        c ^= 0x04;
+        f.seekp(128 + 3 * sizeof(vol::io::SurfaceRecord) + 40);
+        f.write(&c, 1);
+    }
+    REQUIRE_THROWS_AS(vol::io::SurfaceFile::open(path), std::runtime_error);
+    REQUIRE_NOTHROW(vol::io::SurfaceFile::open(path, false));
+
+    // record_offset past the end: (size - offset) and offset + n * 96 both wrap to pass the
+    // size checks unless the offset is bounded first
+    {
+        writer.write(path);
+        const std::uint64_t offset = ~std::uint64_t{63}, n = 10;   // 2^64 - 64 + 960 == 896
+        REQUIRE(std::filesystem::file_size(path) == 128 + 8 * sizeof(vol::io::SurfaceRecord));
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(24);
+        f.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        f.seekp(40);
+        f.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+    REQUIRE_THROWS_AS(vol::io::SurfaceFile::open(path), std::runtime_error);
+    REQUIRE_THROWS_AS(vol::io::SurfaceFile::open(path, false), std::runtime_error);
+
+    std::filesystem::resize_file(path, 128 + 2 * sizeof(vol::io::SurfaceRecord));
+    REQUIRE_THROWS_AS(vol::io::SurfaceFile::open(path, false), std::runtime_error);
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        const std::string junk(256, 'x');
+        f.write(junk.data(), static_cast<std::streamsize>(junk.size()));
+    }
+    REQUIRE_THROWS_AS(vol::io::SurfaceFile::open(path), std::runtime_error);
+    std::filesystem::remove(path);
+    REQUIRE_THROWS_AS(vol::io::SurfaceFile::open(path), std::runtime_error);
+}
+
+TEST_CASE("Loaded fits warm-start the next session's calibration", "[surface_file][svi]") {
+    const vol::svi::Params yesterday{0.035, 0.18, -0.35, -0.05, 0.22};
+    const vol::svi::Params today{0.037, 0.185, -0.34, -0.04, 0.22};
+    const double S = 100.0, r = 0.01, T = 0.5;
+
+    const Quotes q0 = make_quotes(yesterday, S, r, T);
+    const auto cold0 = vol::svi::calibrate_slice_report(q0.view());
+    REQUIRE(cold0.n_points == static_cast<int>(q0.strike.size()));
+    REQUIRE(cold0.iterations > 0);
+    REQUIRE(std::isfinite(cold0.rmse));
+    REQUIRE(cold0.params == vol::svi::calibrate_slice(q0.view()));
+
+    vol::io::SurfaceFileWriter writer;
+    writer.add(0, T, q0.forward, q0.discount, cold0);
+    const std::string path = temp_path("libvol_test_surfaces_warm.bin");
+    writer.write(path);
+    const auto file = vol::io::SurfaceFile::open(path);
+    const auto& rec = file.underlying(0)[0];
+    REQUIRE(rec.rmse == cold0.rmse);
+
+    // a warm start never ends worse than the stored fit on the same quotes
+    vol::svi::SliceConfig warm_cfg;
+    warm_cfg.warm_start = rec.params;
+    const auto again = vol::svi::calibrate_slice_report(q0.view(), warm_cfg);
+    REQUIRE(again.rmse <= rec.rmse);
+
+    // restart: the market moved a little overnight, one local solve from the stored fit
+    const Quotes q1 = make_quotes(today, S, r, T);
+    warm_cfg.warm_start = again.params;
+    const auto warm = vol::svi::calibrate_slice_report(q1.view(), warm_cfg);
+    const auto cold = vol::svi::calibrate_slice_report(q1.view());
+    REQUIRE(warm.iterations < cold.iterations);
+    REQUIRE(warm.rmse <= cold.rmse);
+    for (double k = -0.5; k <= 0.5; k += 0.25) {
+        REQUIRE_THAT(vol::svi::total_variance(k, warm.params),
+                     Catch::Matchers::WithinAbs(vol::svi::total_variance(k, today), 2e-3));
+    }
+
+    // too few points to solve: the warm start is ignored like any other fit input
+    Quotes thin = q1;
+    thin.strike.resize(3);
+    thin.mid.resize(3);
+    thin.is_call.resize(3);
+    REQUIRE(vol::svi::calibrate_slice_report(thin.view(), warm_cfg).iterations == 0);
+    std::filesystem::remove(path);
+}
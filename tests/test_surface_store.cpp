@@ -0,0 +1,160 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/models/svi.hpp"
+#include "libvol/stream/surface_store.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+
+// Every parameter equals tag, so a torn or freed surface shows up as a mismatch
+std::vector<vol::stream::SurfaceSlice> tagged(double tag, int n_slices = 4) {
+    std::vector<vol::stream::SurfaceSlice> out;
+    for (int i = n_slices; i >= 1; --i) out.push_back({0.25 * i, {tag, tag, tag, tag, tag}});
+    return out;
+}
+
+bool consistent(const vol::stream::Surface& s) {
+    const double tag = s.slices.front().params[0];
+    for (const auto& slice : s.slices) {
+        for (double p : slice.params) {
+            if (p != tag) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("SurfaceStore: publish, read and per-underlying versions", "[surface_store]") {
+    vol::stream::SurfaceStore store(3);
+    auto reader = store.reader();
+    REQUIRE(store.version(1) == 0);
+    REQUIRE_FALSE(reader.read(1));
+
+    REQUIRE(store.publish(1, tagged(1.0)) == 1);
+    REQUIRE(store.publish(1, tagged(2.0)) == 2);
+    REQUIRE(store.publish(2, tagged(5.0)) == 1);
+    REQUIRE(store.version(0) == 0);
+    REQUIRE(store.version(1) == 2);
+    REQUIRE(store.version(2) == 1);
+
+    const auto snap = reader.read(1);
+    REQUIRE(snap);
+    REQUIRE(snap->version == 2);
+    REQUIRE(snap->underlying == 1);
+    REQUIRE(snap->slices.size() == 4);
+    REQUIRE(snap->slices.front().T == 0.25);   // sorted on publish
+    REQUIRE(snap->slices.back().T == 1.0);
+    REQUIRE(snap->slices[0].params[0] == 2.0);
+
+    REQUIRE_THROWS_AS(store.publish(3, tagged(1.0)), std::invalid_argument);
+    REQUIRE_THROWS_AS(reader.read(7), std::invalid_argument);
+    REQUIRE_THROWS_AS(vol::stream::SurfaceStore(0), std::invalid_argument);
+}
+
+TEST_CASE("SurfaceStore: publish_slice inserts and replaces by expiry", "[surface_store]") {
+    vol::stream::SurfaceStore store(1);
+    const vol::svi::Params a{0.01, 0.1, -0.3, 0.0, 0.2}, b{0.04, 0.12, -0.2, 0.0, 0.25}, c{0.02, 0.1, -0.3, 0.0, 0.2};
+    store.publish_slice(0, 1.0, b);
+    store.publish_slice(0, 0.25, a);
+    REQUIRE(store.publish_slice(0, 0.25, c) == 3);
+    auto reader = store.reader();
+    const auto s = reader.read(0);
+    REQUIRE(s->slices.size() == 2);
+    REQUIRE(s->slices[0].T == 0.25);
+    REQUIRE(s->slices[0].params == c);
+    REQUIRE(s->slices[1].params == b);
+
+    // total variance: exact at slices, linear in T between, proportional to T outside
+    const double k = 0.1;
+    const double w0 = vol::svi::total_variance(k, c), w1 = vol::svi::total_variance(k, b);
+    REQUIRE(s->total_variance(k, 0.25) == Approx(w0));
+    REQUIRE(s->total_variance(k, 1.0) == Approx(w1));
+    REQUIRE(s->total_variance(k, 0.625) == Approx(0.5 * (w0 + w1)));
+    REQUIRE(s->total_variance(k, 0.125) == Approx(0.5 * w0));
+    REQUIRE(s->total_variance(k, 2.0) == Approx(2.0 * w1));
+}
+
+TEST_CASE("SurfaceStore: a pinned snapshot outlives later publishes", "[surface_store]") {
+    vol::stream::SurfaceStore store(1);
+    store.publish(0, tagged(1.0));
+    auto reader = store.reader();
+    {
+        const auto held = reader.read(0);
+        for (int i = 2; i <= 50; ++i) store.publish(0, tagged(i));
+        // everything retired while we are pinned has to wait
+        REQUIRE(store.pending_reclaim() == 49);
+        REQUIRE(held->version == 1);
+        REQUIRE(consistent(*held));
+        REQUIRE(held->slices[0].params[0] == 1.0);
+
+        // nested reads see the latest surface and keep the pin
+        const auto latest = reader.read(0);
+        REQUIRE(latest->version == 50);
+    }
+    store.reclaim();
+    REQUIRE(store.pending_reclaim() == 0);
+
+    // without pinned readers a publish frees its predecessor immediately
+    store.publish(0, tagged(51.0));
+    REQUIRE(store.pending_reclaim() == 0);
+}
+
+TEST_CASE("SurfaceStore: reader slots are bounded and recycled", "[surface_store]") {
+    vol::stream::SurfaceStore store(1, 2);
+    {
+        auto r1 = store.reader();
+        auto r2 = store.reader();
+        REQUIRE_THROWS_AS(store.reader(), std::runtime_error);
+        auto moved = std::move(r2);
+        REQUIRE_THROWS_AS(store.reader(), std::runtime_error);
+    }
+    REQUIRE_NOTHROW(store.reader());
+}
+
+TEST_CASE("SurfaceStore: concurrent readers never see a torn or freed surface", "[surface_store]") {
+    vol::stream::SurfaceStore store(2);
+    store.publish(0, tagged(1.0));
+    store.publish(1, tagged(1.0));
+    std::atomic<bool> done{false};
+    std::atomic<int> bad{0};
+    std::atomic<std::uint64_t> reads{0};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&, t] {
+            auto reader = store.reader();
+            std::uint64_t last[2] = {0, 0};
+            while (!done.load(std::memory_order_relaxed)) {
+                const std::uint32_t u = static_cast<std::uint32_t>(t & 1);
+                const auto s = reader.read(u);
+                // versions never go backwards for one reader, and the content matches the version
+                if (!consistent(*s) || s->version < last[u] || s->slices[0].params[0] != double(s->version)) {
+                    bad.fetch_add(1);
+                }
+                last[u] = s->version;
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (int v = 2; v <= 3000; ++v) {
+        store.publish(0, tagged(v));
+        store.publish(1, tagged(v));
+        if (v % 256 == 0) std::this_thread::yield();
+    }
+    done = true;
+    for (auto& t : readers) t.join();
+    REQUIRE(bad.load() == 0);
+    REQUIRE(reads.load() > 0);
+    REQUIRE(store.version(0) == 3000);
+    store.reclaim();
+    REQUIRE(store.pending_reclaim() == 0);
+}
@@ -1,10 +1,13 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "libvol/calib/svi_slice.hpp"
+#include "libvol/models/american.hpp"
 #include "libvol/models/black_scholes.hpp"
 #include "libvol/models/svi.hpp"
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <stdexcept>
 #include <vector>
 
 using vol::OptionSpec;
@@ -88,4 +91,59 @@ TEST_CASE("SVI slice calibration falls back when no data", "[svi][slice]"){
     REQUIRE(params[0] >= 0.0);
     REQUIRE(params[1] > 0.0);
     REQUIRE(params[4] > 0.0);
-}
\ No newline at end of file
+}
+
+TEST_CASE("SVI slice calibration from a precomputed chain matches OptionSpec input", "[svi][slice][chain]"){
+    const vol::svi::Params truth {0.035, 0.18, -0.35, -0.05, 0.22 };
+    const auto market = make_slice(truth, 100.0, 0.01, 0.0, 0.75);
+
+    std::vector<double> strikes;
+    for (const auto& o : market.options) strikes.push_back(o.K);
+    const std::vector<std::uint8_t> calls(strikes.size(), 1);
+    const auto chain = vol::make_chain(vol::make_expiry(100.0, 0.01, 0.0, 0.75), strikes, calls);
+
+    const auto from_chain = vol::svi::calibrate_slice(chain, market.mids);
+    const auto from_rows = vol::svi::calibrate_slice_from_prices(market.options, market.mids);
+    for (double k : market.log_moneyness) {
+        REQUIRE_THAT(vol::svi::total_variance(k, from_chain),
+                     Catch::Matchers::WithinRel(vol::svi::total_variance(k, from_rows), 1e-6));
+    }
+}
+TEST_CASE("SVI slice calibration from American prices", "[svi][slice]") {
+    const vol::svi::Params truth {0.035, 0.18, -0.35, -0.05, 0.22 };
+    const double S = 100.0, r = 0.05, q = 0.0, T = 0.75;
+    const double F = S * std::exp((r - q) * T);
+    std::vector<OptionSpec> options;
+    std::vector<double> mids, euro_mids;
+    for (double k : {-0.6, -0.4, -0.2, -0.1, 0.0, 0.1, 0.2, 0.4}) {
+        // OTM puts carry the early-exercise premium
+        const double K = F * std::exp(k);
+        const bool is_call = k > 0.0;
+        const double iv = std::sqrt(vol::svi::total_variance(k, truth) / T);
+        options.push_back(OptionSpec{S, K, r, q, T, is_call});
+        mids.push_back(vol::american::price(S, K, r, q, T, iv, is_call, vol::american::FAST));
+        euro_mids.push_back(vol::bs::price(S, K, r, q, T, iv, is_call));
+    }
+
+    vol::svi::SliceConfig cfg;
+    cfg.american = true;
+    cfg.american_scheme = vol::american::FAST;
+    const auto params = vol::svi::calibrate_slice_from_prices(options, mids, cfg);
+    // same fit as the European calibration on European prices at the same vols
+    const auto ref = vol::svi::calibrate_slice_from_prices(options, euro_mids, vol::svi::SliceConfig{});
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        const double k = std::log(options[i].K / F);
+        REQUIRE_THAT(vol::svi::total_variance(k, params),
+                     Catch::Matchers::WithinRel(vol::svi::total_variance(k, ref), 1e-4));
+    }
+
+    // treating the same mids as European overstates the put-wing variance
+    const auto euro = vol::svi::calibrate_slice_from_prices(options, mids, vol::svi::SliceConfig{});
+    REQUIRE(vol::svi::total_variance(-0.6, euro) > vol::svi::total_variance(-0.6, params));
+
+    const std::vector<std::uint8_t> flags(options.size(), 0);
+    std::vector<double> strikes;
+    for (const auto& o : options) strikes.push_back(o.K);
+    const vol::svi::SliceQuotes quotes{T, F, std::exp(-r * T), strikes, mids, flags};
+    REQUIRE_THROWS_AS(vol::svi::calibrate_slice(quotes, cfg), std::invalid_argument);
+}
@@ -0,0 +1,87 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include "libvol/util/synthetic_market.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+TEST_CASE("Synthetic market: shape and reproducibility", "[synth]") {
+    vol::synth::MarketConfig cfg;
+    cfg.underlyings = 4;
+    cfg.expiries = 6;
+    cfg.strikes = 40;
+    const auto a = vol::synth::generate_market(cfg);
+    REQUIRE(a.slices.size() == 24);
+    REQUIRE(a.quotes() == 24 * 40);
+    REQUIRE(a.slices.front().T == Catch::Approx(cfg.min_T));
+    REQUIRE(a.slices[5].T == Catch::Approx(cfg.max_T));
+    REQUIRE(a.slices[6].underlying == 1);
+
+    const auto b = vol::synth::generate_market(cfg);
+    for (std::size_t s = 0; s < a.slices.size(); ++s) {
+        REQUIRE(a.slices[s].bid == b.slices[s].bid);
+        REQUIRE(a.slices[s].ask == b.slices[s].ask);
+        REQUIRE(a.slices[s].truth == b.slices[s].truth);
+    }
+
+    // each underlying has its own stream: a larger market extends a smaller one
+    cfg.underlyings = 5;
+    const auto c = vol::synth::generate_market(cfg);
+    REQUIRE(c.slices[23].ask == a.slices[23].ask);
+
+    cfg.seed = 2;
+    const auto d = vol::synth::generate_market(cfg);
+    REQUIRE(d.slices[0].S != a.slices[0].S);
+
+    cfg.strikes = 1;
+    REQUIRE_THROWS_AS(vol::synth::generate_market(cfg), std::invalid_argument);
+    cfg.strikes = 40;
+    cfg.min_T = 2.0;
+    cfg.max_T = 1.0;
+    REQUIRE_THROWS_AS(vol::synth::generate_market(cfg), std::invalid_argument);
+}
+
+TEST_CASE("Synthetic market: quotes follow the true smile, with crossed and no-bid quotes", "[synth]") {
+    vol::synth::MarketConfig cfg;
+    cfg.underlyings = 20;
+    cfg.expiries = 10;
+    cfg.strikes = 80;
+    const auto m = vol::synth::generate_market(cfg);
+
+    std::size_t crossed = 0, no_bid = 0, n = 0, bad = 0, checked = 0;
+    for (const auto& s : m.slices) {
+        bad += vol::svi::basic_no_arb(s.truth) ? 0 : 1;
+        const auto ex = s.expiry();
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            ++n;
+            bad += s.ask[i] > 0.0 ? 0 : 1;
+            bad += s.is_call[i] == (s.strike[i] >= ex.forward ? 1 : 0) ? 0 : 1;
+            if (s.bid[i] > s.ask[i]) {
+                ++crossed;
+                continue;
+            }
+            if (s.bid[i] == 0.0) {
+                ++no_bid;
+                continue;
+            }
+            // near the money the mid inverts to the true vol up to the quote noise
+            const double k = std::log(s.strike[i] / ex.forward);
+            const double sd = std::sqrt(vol::svi::total_variance(0.0, s.truth));
+            if (std::abs(k) < 0.5 * sd && s.mid[i] > 20 * cfg.tick) {
+                const double truth = std::sqrt(vol::svi::total_variance(k, s.truth) / s.T);
+                const auto iv = vol::bs::implied_vol(s.S, s.strike[i], s.r, s.q, s.T, s.mid[i], s.is_call[i] != 0);
+                bad += iv.converged && std::abs(iv.iv - truth) < 0.1 * truth ? 0 : 1;
+                ++checked;
+            }
+        }
+    }
+    REQUIRE(bad == 0);
+    REQUIRE(checked > 1000);
+    const double crossed_frac = static_cast<double>(crossed) / static_cast<double>(n);
+    REQUIRE(crossed_frac > 0.5 * cfg.crossed_fraction);
+    REQUIRE(crossed_frac < 2.0 * cfg.crossed_fraction);
+    REQUIRE(no_bid > 0);   // wide wings run below one tick
+}
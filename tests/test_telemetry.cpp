@@ -0,0 +1,107 @@
+#include <catch2/catch_all.hpp>
+
+#include "libvol/calib/svi_slice.hpp"
+#include "libvol/models/black_scholes.hpp"
+#include "libvol/models/svi.hpp"
+#include "libvol/util/telemetry.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tel = vol::telemetry;
+
+TEST_CASE("Telemetry: counters and histograms sum over threads", "[telemetry]") {
+    tel::reset();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (std::uint64_t v = 1; v <= 1000; ++v) {
+                tel::add(tel::Counter::LbfgsbRuns);
+                tel::record(tel::Stage::PipelinePublish, v);
+            }
+            tel::add(tel::Counter::SviFits, 10);
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    // exited threads' slabs keep their counts
+    const auto s = tel::snapshot();
+    REQUIRE(s[tel::Counter::LbfgsbRuns] == 4000);
+    REQUIRE(s[tel::Counter::SviFits] == 40);
+    const auto& h = s[tel::Stage::PipelinePublish];
+    REQUIRE(h.count == 4000);
+    REQUIRE(h.sum_ns == 4 * 500500);
+    REQUIRE(h.min_ns == 1);
+    REQUIRE(h.max_ns == 1000);
+    REQUIRE(h.mean_ns() == Catch::Approx(500.5));
+    // log-linear buckets: within 1/16 of the exact quantile
+    REQUIRE(std::abs(static_cast<double>(h.percentile(0.5)) - 500.0) <= 500.0 / 16);
+    REQUIRE(std::abs(static_cast<double>(h.percentile(0.99)) - 990.0) <= 990.0 / 16);
+    REQUIRE(h.percentile(0.0) == 1);
+    REQUIRE(h.percentile(1.0) == 1000);
+    REQUIRE(s[tel::Stage::PipelineFit].count == 0);
+    REQUIRE(s[tel::Stage::PipelineFit].percentile(0.5) == 0);
+
+    tel::reset();
+    const auto z = tel::snapshot();
+    REQUIRE(z[tel::Counter::LbfgsbRuns] == 0);
+    REQUIRE(z[tel::Stage::PipelinePublish].count == 0);
+    REQUIRE(z[tel::Stage::PipelinePublish].min_ns == 0);
+}
+
+TEST_CASE("Telemetry: histogram buckets are exact for small values and bounded above", "[telemetry]") {
+    for (std::uint64_t v = 0; v < 16; ++v) REQUIRE(tel::detail::bucket_of(v) == v);
+    REQUIRE(tel::detail::bucket_of(16) == 16);
+    REQUIRE(tel::detail::bucket_of(17) == 17);
+    REQUIRE(tel::detail::bucket_of(32) == 32);
+    REQUIRE(tel::detail::bucket_of(33) == 32);   // width 2 from 32 on
+    REQUIRE(tel::detail::bucket_of(~0ull) == tel::detail::N_BUCKETS - 1);
+
+    tel::reset();
+    tel::record(tel::Stage::SliceFit, 1'000'000'000'000ull);
+    const auto h = tel::snapshot()[tel::Stage::SliceFit];
+    REQUIRE(h.percentile(0.5) == 1'000'000'000'000ull);   // clamped to [min, max]
+    tel::reset();
+}
+
+TEST_CASE("Telemetry: solver sites report when compiled in", "[telemetry]") {
+    tel::reset();
+    // price above the upper bound, then a clean slice fit
+    const auto bad = vol::bs::implied_vol(100.0, 100.0, 0.01, 0.0, 0.5, 150.0, true);
+    REQUIRE_FALSE(bad.converged);
+    const vol::svi::Params p{0.02, 0.15, -0.3, 0.0, 0.2};
+    std::vector<vol::OptionSpec> opts;
+    std::vector<double> mids;
+    for (double k = -0.4; k <= 0.41; k += 0.1) {
+        const double K = 100.0 * std::exp(k);
+        opts.push_back({100.0, K, 0.0, 0.0, 0.5, k >= 0.0});
+        mids.push_back(vol::bs::price(100.0, K, 0.0, 0.0, 0.5, std::sqrt(vol::svi::total_variance(k, p) / 0.5), k >= 0.0));
+    }
+    vol::svi::calibrate_slice_from_prices(opts, mids);
+
+    const auto s = tel::snapshot();
+    if (tel::compiled_in()) {
+        REQUIRE(s[tel::Counter::IvSolves] >= opts.size() + 1);
+        REQUIRE(s[tel::Counter::IvNoSolution] >= 1);
+        REQUIRE(s[tel::Counter::SviFits] == 1);
+        REQUIRE(s[tel::Counter::LbfgsbRuns] == 3);
+        // every unconverged start is an lbfgsb run that ended at maxit or a collapsed step
+        REQUIRE(s[tel::Counter::SviStartUnconverged] ==
+                s[tel::Counter::LbfgsbMaxIter] + s[tel::Counter::LbfgsbStepCollapse]);
+        REQUIRE(s[tel::Stage::SliceFit].count == 1);
+        REQUIRE(s[tel::Stage::SliceFit].max_ns > 0);
+    } else {
+        for (std::size_t c = 0; c < tel::N_COUNTERS; ++c) REQUIRE(s.counters[c] == 0);
+        for (const auto& h : s.stages) REQUIRE(h.count == 0);
+    }
+
+    const std::string json = tel::to_json(s);
+    REQUIRE(json.find("\"iv_brent_fallbacks\": ") != std::string::npos);
+    REQUIRE(json.find("\"pipeline_tick_to_publish\": {\"count\": ") != std::string::npos);
+    REQUIRE(json.find(tel::compiled_in() ? "\"compiled_in\": true" : "\"compiled_in\": false") != std::string::npos);
+    REQUIRE(std::string(tel::name(tel::Counter::SliceFewQuotes)) == "slice_few_quotes");
+    REQUIRE(std::string(tel::name(tel::Stage::PipelineFit)) == "pipeline_fit");
+}